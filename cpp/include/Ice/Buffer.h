@@ -11,6 +11,7 @@
 #define ICE_BUFFER_H
 
 #include <Ice/Config.h>
+#include <Ice/BufferPoolF.h>
 
 namespace IceInternal
 {
@@ -83,6 +84,13 @@ public:
 
         void clear();
 
+        //
+        // Allocate the memory of the container from the given pool. The
+        // pool is only set if the container doesn't own memory
+        // allocated outside the pool.
+        //
+        void setPool(const BufferPoolPtr&);
+
         void resize(size_type n) // Inlined for performance reasons.
         {
             if(n == 0)
@@ -142,12 +150,14 @@ public:
         Container(const Container&);
         void operator=(const Container&);
         void reserve(size_type);
+        void deallocate();
 
         pointer _buf;
         size_type _size;
         size_type _capacity;
         int _shrinkCounter;
         bool _owned;
+        BufferPoolPtr _pool;
     };
 
     Container b;
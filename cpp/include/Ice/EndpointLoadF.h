@@ -0,0 +1,30 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ENDPOINT_LOAD_F_H
+#define ICE_ENDPOINT_LOAD_F_H
+
+#include <IceUtil/Shared.h>
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class EndpointLoad;
+ICE_API IceUtil::Shared* upCast(EndpointLoad*);
+typedef IceInternal::Handle<EndpointLoad> EndpointLoadPtr;
+
+class EndpointLoadTable;
+ICE_API IceUtil::Shared* upCast(EndpointLoadTable*);
+typedef IceInternal::Handle<EndpointLoadTable> EndpointLoadTablePtr;
+
+}
+
+#endif
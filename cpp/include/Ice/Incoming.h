@@ -21,6 +21,7 @@
 #include <Ice/IncomingAsyncF.h>
 #include <Ice/ObserverHelper.h>
 #include <Ice/ResponseHandlerF.h>
+#include <IceUtil/Time.h>
 
 #include <deque>
 
@@ -52,6 +53,18 @@ protected:
 namespace IceInternal
 {
 
+//
+// The reserved request context entry used to send the remaining time
+// in milliseconds of the invocation timeout to the server.
+//
+const char* const deadlineContextKey = "_deadline";
+
+//
+// Returns the deadline of the request dispatched by the calling thread,
+// or 0 if the thread isn't dispatching a request with a deadline.
+//
+Ice::Long getDispatchDeadline();
+
 class ICE_API IncomingBase : private IceUtil::noncopyable
 {
 public:
@@ -163,7 +176,7 @@ public:
         _format = format;
     }
 
-    void invoke(const ServantManagerPtr&, Ice::InputStream*);
+    void invoke(const ServantManagerPtr&, Ice::InputStream*, const IceUtil::Time& = IceUtil::Time());
 
     // Inlined for speed optimization.
     void skipReadParams()
@@ -194,6 +207,8 @@ public:
 
 private:
 
+    void discard(const std::string&);
+
     friend class IncomingAsync;
 
     Ice::InputStream* _is;
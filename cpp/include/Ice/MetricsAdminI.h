@@ -626,20 +626,11 @@ public:
     template<class MetricsType> void
     registerMap(const std::string& map, IceMX::Updater* updater)
     {
-        bool updated;
-        MetricsMapFactoryPtr factory;
-        {
-            Lock sync(*this);
-            factory = ICE_MAKE_SHARED(MetricsMapFactoryT<MetricsType>, updater);
-            _factories[map] = factory;
-            updated = addOrUpdateMap(map, factory);
-        }
-        if(updated)
-        {
-            factory->update();
-        }
+        registerMap(map, ICE_MAKE_SHARED(MetricsMapFactoryT<MetricsType>, updater));
     }
 
+    void registerMap(const std::string&, const MetricsMapFactoryPtr&);
+
     template<class MemberMetricsType, class MetricsType> void
     registerSubMap(const std::string& map, const std::string& subMap, IceMX::MetricsMap MetricsType::* member)
     {
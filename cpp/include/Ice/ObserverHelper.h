@@ -125,6 +125,9 @@ public:
             _observer->reply(size);
         }
     }
+
+    void expired();
+    void rejected();
 };
 
 class ICE_API InvocationObserver : public ObserverHelperT<Ice::Instrumentation::InvocationObserver>
@@ -177,6 +180,10 @@ public:
         }
     }
 
+    void batchRequests(int);
+    void hedged();
+    void hedgeWon();
+
 private:
 
     using ObserverHelperT<Ice::Instrumentation::InvocationObserver>::attach;
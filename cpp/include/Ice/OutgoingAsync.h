@@ -17,6 +17,7 @@
 #include <Ice/ConnectionIF.h>
 #include <Ice/ObjectAdapterF.h>
 #include <Ice/RequestHandlerF.h>
+#include <Ice/EndpointLoadF.h>
 #include <Ice/ConnectionF.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
@@ -211,6 +212,25 @@ public:
     void retry();
     void abort(const Ice::Exception&);
 
+    //
+    // Hedging of idempotent invocations. sendHedge is called once the
+    // hedging delay elapsed, completeHedge returns false if the reply
+    // or exception of the request (hedge = false) or of the hedged
+    // request (hedge = true) must be ignored because the invocation
+    // already completed with the other one, and hedgeResponse completes
+    // the invocation with the reply of the hedged request.
+    //
+    void sendHedge();
+    bool completeHedge(bool);
+    void hedgeResponse(Ice::InputStream&);
+
+    //
+    // Called by the request handler of a proxy with the Adaptive endpoint
+    // selection with the load of the endpoint selected for the request.
+    // The load is updated when the request completes or is retried.
+    //
+    virtual void endpointSelected(const EndpointLoadPtr&);
+
 #ifdef ICE_CPP11_MAPPING
     std::shared_ptr<ProxyOutgoingAsyncBase> shared_from_this()
     {
@@ -233,14 +253,42 @@ protected:
 
     virtual void runTimerTask();
 
+    void scheduleHedge(const std::string&);
+    virtual ProxyOutgoingAsyncBasePtr createHedge(const Ice::ObjectPrxPtr&);
+
     const Ice::ObjectPrxPtr _proxy;
     RequestHandlerPtr _handler;
     Ice::OperationMode _mode;
 
+    //
+    // The remaining time in milliseconds of the deadline of the request
+    // dispatched by the thread that makes the invocation, or 0.
+    //
+    int _deadlineTimeout;
+
 private:
 
+    bool hasTimeout() const;
+    bool hedgeWon();
+    void endpointLoadCompleted(bool);
+
     int _cnt;
     bool _sent;
+
+    //
+    // The hedging timer task is set by scheduleHedge before invokeImpl if
+    // the invocation can be hedged and isn't modified afterwards, so it's
+    // read without locking. The hedged request is set while it's pending.
+    //
+    IceUtil::TimerTaskPtr _hedgeTask;
+    ProxyOutgoingAsyncBasePtr _hedge;
+    std::string _hedgeOperation;
+    IceUtil::Time _hedgeStart;
+    bool _hedgeCompleted;
+    bool _hedgeWon;
+
+    EndpointLoadPtr _endpointLoad;
+    IceUtil::Time _endpointLoadStart;
 };
 
 //
@@ -295,6 +343,10 @@ public:
 
 protected:
 
+    virtual ProxyOutgoingAsyncBasePtr createHedge(const Ice::ObjectPrxPtr&);
+
+    void copyRequest(OutgoingAsync&);
+
     const Ice::EncodingVersion _encoding;
 
 #ifdef ICE_CPP11_MAPPING
@@ -302,6 +354,23 @@ protected:
 #endif
 
     bool _synchronous;
+
+private:
+
+    void writeContext(const Ice::Context&, Ice::Long);
+    void updateDeadline();
+
+    //
+    // If the request carries the remaining time of its invocation timeout,
+    // the time (monotonic, in milliseconds) at which it expires and the
+    // request context with its position in the request. The remaining time
+    // is updated each time the request is sent. The expiration is 0 if the
+    // request doesn't carry the remaining time.
+    //
+    Ice::Long _requestDeadline;
+    Ice::Context _requestContext;
+    size_t _requestContextStart;
+    size_t _requestContextEnd;
 };
 
 }
@@ -289,11 +289,7 @@ public:
 
     template<typename T> void write(const T* begin, const T* end)
     {
-        writeSize(static_cast<Int>(end - begin));
-        for(const T* p = begin; p != end; ++p)
-        {
-            write(*p);
-        }
+        StreamSequenceHelper<T, StreamableTraits<T>::helper>::write(this, begin, end);
     }
 
 #ifdef ICE_CPP11_MAPPING
@@ -93,6 +93,8 @@ public:
 
     virtual Ice::ConnectionPtr getConnection() const;
 
+    virtual void endpointSelected(const EndpointLoadPtr&);
+
     void invoke(const std::string&);
 };
 typedef IceUtil::Handle<ProxyGetConnection> ProxyGetConnectionPtr;
@@ -545,6 +547,12 @@ public:
     ::Ice::Int ice_getLocatorCacheTimeout() const;
     ::std::shared_ptr<::Ice::ObjectPrx> ice_locatorCacheTimeout(::Ice::Int) const;
 
+    ::Ice::Int ice_getParallelConnect() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_parallelConnect(::Ice::Int) const;
+
+    ::Ice::Int ice_getConnectionPoolSize() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_connectionPoolSize(::Ice::Int) const;
+
     bool ice_isConnectionCached() const;
     ::std::shared_ptr<::Ice::ObjectPrx> ice_connectionCached(bool) const;
 
@@ -572,6 +580,12 @@ public:
     ::Ice::Int ice_getInvocationTimeout() const;
     ::std::shared_ptr<::Ice::ObjectPrx> ice_invocationTimeout(::Ice::Int) const;
 
+    ::Ice::Int ice_getBatchAutoFlushDelay() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_batchAutoFlushDelay(::Ice::Int) const;
+
+    ::Ice::Int ice_getHedgingDelay() const;
+    ::std::shared_ptr<::Ice::ObjectPrx> ice_hedgingDelay(::Ice::Int) const;
+
     ::std::shared_ptr<::Ice::ObjectPrx> ice_twoway() const;
     bool ice_isTwoway() const;
     ::std::shared_ptr<::Ice::ObjectPrx> ice_oneway() const;
@@ -746,6 +760,16 @@ public:
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_locatorCacheTimeout(timeout));
     }
 
+    ::std::shared_ptr<Prx> ice_parallelConnect(int attempts) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_parallelConnect(attempts));
+    }
+
+    ::std::shared_ptr<Prx> ice_connectionPoolSize(int size) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_connectionPoolSize(size));
+    }
+
     ::std::shared_ptr<Prx> ice_connectionCached(bool cached) const
     {
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_connectionCached(cached));
@@ -786,6 +810,16 @@ public:
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_invocationTimeout(timeout));
     }
 
+    ::std::shared_ptr<Prx> ice_batchAutoFlushDelay(int delay) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_batchAutoFlushDelay(delay));
+    }
+
+    ::std::shared_ptr<Prx> ice_hedgingDelay(int delay) const
+    {
+        return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_hedgingDelay(delay));
+    }
+
     ::std::shared_ptr<Prx> ice_twoway() const
     {
         return ::std::dynamic_pointer_cast<Prx>(ObjectPrx::ice_twoway());
@@ -1329,6 +1363,12 @@ public:
     ::Ice::Int ice_getLocatorCacheTimeout() const;
     ::Ice::ObjectPrx ice_locatorCacheTimeout(::Ice::Int) const;
 
+    ::Ice::Int ice_getParallelConnect() const;
+    ::Ice::ObjectPrx ice_parallelConnect(::Ice::Int) const;
+
+    ::Ice::Int ice_getConnectionPoolSize() const;
+    ::Ice::ObjectPrx ice_connectionPoolSize(::Ice::Int) const;
+
     bool ice_isConnectionCached() const;
     ::Ice::ObjectPrx ice_connectionCached(bool) const;
 
@@ -1356,6 +1396,12 @@ public:
     ::Ice::Int ice_getInvocationTimeout() const;
     ::Ice::ObjectPrx ice_invocationTimeout(::Ice::Int) const;
 
+    ::Ice::Int ice_getBatchAutoFlushDelay() const;
+    ::Ice::ObjectPrx ice_batchAutoFlushDelay(::Ice::Int) const;
+
+    ::Ice::Int ice_getHedgingDelay() const;
+    ::Ice::ObjectPrx ice_hedgingDelay(::Ice::Int) const;
+
     ::Ice::ObjectPrx ice_twoway() const;
     bool ice_isTwoway() const;
     ::Ice::ObjectPrx ice_oneway() const;
@@ -1533,6 +1579,16 @@ public:
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_locatorCacheTimeout(timeout).get());
     }
 
+    IceInternal::ProxyHandle<Prx> ice_parallelConnect(int attempts) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_parallelConnect(attempts).get());
+    }
+
+    IceInternal::ProxyHandle<Prx> ice_connectionPoolSize(int size) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_connectionPoolSize(size).get());
+    }
+
     IceInternal::ProxyHandle<Prx> ice_connectionCached(bool cached) const
     {
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_connectionCached(cached).get());
@@ -1573,6 +1629,16 @@ public:
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_invocationTimeout(timeout).get());
     }
 
+    IceInternal::ProxyHandle<Prx> ice_batchAutoFlushDelay(int delay) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_batchAutoFlushDelay(delay).get());
+    }
+
+    IceInternal::ProxyHandle<Prx> ice_hedgingDelay(int delay) const
+    {
+        return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_hedgingDelay(delay).get());
+    }
+
     IceInternal::ProxyHandle<Prx> ice_twoway() const
     {
         return dynamic_cast<Prx*>(::IceProxy::Ice::Object::ice_twoway().get());
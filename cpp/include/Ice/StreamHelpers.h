@@ -12,6 +12,8 @@
 
 #include <Ice/ObjectF.h>
 
+#include <cstring>
+
 #ifndef ICE_CPP11_MAPPING
 #   include <IceUtil/ScopedArray.h>
 #   include <IceUtil/Iterator.h>
@@ -37,6 +39,7 @@ const StreamHelperCategory StreamHelperCategoryDictionary = 6;
 const StreamHelperCategory StreamHelperCategoryProxy = 7;
 const StreamHelperCategory StreamHelperCategoryClass = 8;
 const StreamHelperCategory StreamHelperCategoryUserException = 9;
+const StreamHelperCategory StreamHelperCategoryStructPacked = 10; // struct with the same C++ layout as its encoding
 
 //
 // The optional format.
@@ -415,6 +418,12 @@ struct StreamHelper<T, StreamHelperCategoryStruct>
     }
 };
 
+// Helper for packed structs, they are encoded like structs
+template<typename T>
+struct StreamHelper<T, StreamHelperCategoryStructPacked> : StreamHelper<T, StreamHelperCategoryStruct>
+{
+};
+
 // Helper for class structs
 template<typename T>
 struct StreamHelper<T, StreamHelperCategoryStructClass>
@@ -485,6 +494,90 @@ struct StreamHelper<T, StreamHelperCategorySequence>
     }
 };
 
+//
+// Helpers for the elements of vector and array sequences. The elements
+// are read/written one by one unless the element type is a packed
+// struct, see below.
+//
+template<typename T, StreamHelperCategory st>
+struct StreamSequenceHelper
+{
+    template<class S> static inline void
+    write(S* stream, const T* begin, const T* end)
+    {
+        stream->writeSize(static_cast<Int>(end - begin));
+        for(const T* p = begin; p != end; ++p)
+        {
+            stream->write(*p);
+        }
+    }
+
+    template<class S> static inline void
+    read(S* stream, std::vector<T>& v)
+    {
+        Int sz = stream->readAndCheckSeqSize(StreamableTraits<T>::minWireSize);
+        std::vector<T>(sz).swap(v);
+        for(typename std::vector<T>::iterator p = v.begin(); p != v.end(); ++p)
+        {
+            stream->read(*p);
+        }
+    }
+};
+
+#ifndef ICE_BIG_ENDIAN
+//
+// The C++ layout of a packed struct matches its encoding on little
+// endian hosts, the elements are copied with a single memcpy.
+//
+template<typename T>
+struct StreamSequenceHelper<T, StreamHelperCategoryStructPacked>
+{
+    template<class S> static inline void
+    write(S* stream, const T* begin, const T* end)
+    {
+        stream->writeSize(static_cast<Int>(end - begin));
+        stream->writeBlob(reinterpret_cast<const Byte*>(begin), static_cast<size_t>(end - begin) * sizeof(T));
+    }
+
+    template<class S> static inline void
+    read(S* stream, std::vector<T>& v)
+    {
+        Int sz = stream->readAndCheckSeqSize(StreamableTraits<T>::minWireSize);
+        std::vector<T>(sz).swap(v);
+        if(sz > 0)
+        {
+            const Byte* p;
+            stream->readBlob(p, static_cast<size_t>(sz) * sizeof(T));
+            memcpy(&v[0], p, static_cast<size_t>(sz) * sizeof(T));
+        }
+    }
+};
+#endif
+
+// Helper for vector sequences
+template<typename T>
+struct StreamHelper<std::vector<T>, StreamHelperCategorySequence>
+{
+    template<class S> static inline void
+    write(S* stream, const std::vector<T>& v)
+    {
+        if(v.empty())
+        {
+            stream->writeSize(0);
+        }
+        else
+        {
+            StreamSequenceHelper<T, StreamableTraits<T>::helper>::write(stream, &v[0], &v[0] + v.size());
+        }
+    }
+
+    template<class S> static inline void
+    read(S* stream, std::vector<T>& v)
+    {
+        StreamSequenceHelper<T, StreamableTraits<T>::helper>::read(stream, v);
+    }
+};
+
 // Helper for array custom sequence parameters
 template<typename T>
 struct StreamHelper<std::pair<const T*, const T*>, StreamHelperCategorySequence>
@@ -759,6 +852,12 @@ struct StreamOptionalHelper<T, StreamHelperCategoryStruct, false>
     }
 };
 
+// Packed structs are encoded like structs
+template<typename T, bool fixedLength>
+struct StreamOptionalHelper<T, StreamHelperCategoryStructPacked, fixedLength> : StreamOptionalHelper<T, StreamHelperCategoryStruct, fixedLength>
+{
+};
+
 // Class structs are encoded like structs
 template<typename T, bool fixedLength>
 struct StreamOptionalHelper<T, StreamHelperCategoryStructClass, fixedLength> : StreamOptionalHelper<T, StreamHelperCategoryStruct, fixedLength>
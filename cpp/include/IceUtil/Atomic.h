@@ -47,6 +47,40 @@ namespace IceUtilInternal
 
 #ifdef ICE_CPP11_COMPILER_HAS_ATOMIC
 typedef std::atomic<int> Atomic;
+
+//
+// An atomic pointer, loads have acquire semantics and stores have
+// release semantics.
+//
+template<typename T>
+class AtomicPtr : public IceUtil::noncopyable
+{
+public:
+
+    AtomicPtr(T* desired = 0) :
+        _ptr(desired)
+    {
+    }
+
+    inline T* load() const
+    {
+        return _ptr.load(std::memory_order_acquire);
+    }
+
+    inline void store(T* desired)
+    {
+        _ptr.store(desired, std::memory_order_release);
+    }
+
+    inline T* exchange(T* desired)
+    {
+        return _ptr.exchange(desired);
+    }
+
+private:
+
+    std::atomic<T*> _ptr;
+};
 #else
 
 #if defined(_WIN32)
@@ -119,7 +153,11 @@ public:
 #if defined(_WIN32)
         return InterlockedExchangeAdd(const_cast<ATOMIC_T*>(&_ref), 0);
 #elif defined(ICE_HAS_GCC_BUILTINS)
+#  if defined(__ATOMIC_SEQ_CST)
+        return __atomic_load_n(&_ref, __ATOMIC_SEQ_CST);
+#  else
         return __sync_fetch_and_add(const_cast<ATOMIC_T*>(&_ref), 0);
+#  endif
 #else
         IceUtil::Mutex::Lock sync(_mutex);
         return _ref;
@@ -179,6 +217,79 @@ private:
 #endif
 };
 
+//
+// An atomic pointer, loads have acquire semantics and stores have
+// release semantics.
+//
+template<typename T>
+class AtomicPtr : public IceUtil::noncopyable
+{
+public:
+
+    AtomicPtr(T* desired = 0) :
+        _ptr(desired)
+    {
+    }
+
+    inline T* load() const
+    {
+#if defined(_WIN32)
+        return static_cast<T*>(InterlockedCompareExchangePointer(
+                                   reinterpret_cast<PVOID volatile*>(const_cast<T**>(&_ptr)), 0, 0));
+#elif defined(ICE_HAS_GCC_BUILTINS)
+#  if defined(__ATOMIC_ACQUIRE)
+        return __atomic_load_n(&_ptr, __ATOMIC_ACQUIRE);
+#  else
+        T* ptr = *const_cast<T* volatile*>(&_ptr);
+        __sync_synchronize();
+        return ptr;
+#  endif
+#else
+        IceUtil::Mutex::Lock sync(_mutex);
+        return _ptr;
+#endif
+    }
+
+    inline void store(T* desired)
+    {
+#if defined(_WIN32)
+        InterlockedExchangePointer(reinterpret_cast<PVOID volatile*>(&_ptr), desired);
+#elif defined(ICE_HAS_GCC_BUILTINS)
+#  if defined(__ATOMIC_RELEASE)
+        __atomic_store_n(&_ptr, desired, __ATOMIC_RELEASE);
+#  else
+        __sync_synchronize();
+        *const_cast<T* volatile*>(&_ptr) = desired;
+#  endif
+#else
+        IceUtil::Mutex::Lock sync(_mutex);
+        _ptr = desired;
+#endif
+    }
+
+    inline T* exchange(T* desired)
+    {
+#if defined(_WIN32)
+        return static_cast<T*>(InterlockedExchangePointer(reinterpret_cast<PVOID volatile*>(&_ptr), desired));
+#elif defined(ICE_HAS_GCC_BUILTINS)
+        __sync_synchronize();
+        return __sync_lock_test_and_set(&_ptr, desired);
+#else
+        IceUtil::Mutex::Lock sync(_mutex);
+        T* tmp = _ptr;
+        _ptr = desired;
+        return tmp;
+#endif
+    }
+
+private:
+
+    T* _ptr;
+#if !defined(_WIN32) && !defined(ICE_HAS_GCC_BUILTINS)
+    mutable IceUtil::Mutex _mutex;
+#endif
+};
+
 #endif
 
 }
@@ -46,6 +46,13 @@ ICE_DEFINE_PTR(TimerTaskPtr, TimerTask);
 // repeated execution. Tasks are executed by the dedicated timer thread 
 // sequentially.
 //
+// By default, tasks are kept in a queue sorted by execution time. A
+// timer can instead be constructed with a tick to keep the tasks in a
+// hierarchical timing wheel. Scheduling and cancelling a task is then
+// a constant time operation, and tasks which expire during the same
+// tick are run together. The execution time of the tasks is rounded up
+// to the tick.
+//
 class ICE_API Timer : public virtual IceUtil::Shared, private IceUtil::Thread
 {
 public:
@@ -61,6 +68,20 @@ public:
     //
     Timer(int priority);
 
+    //
+    // Construct a timing wheel timer with the given tick and starts its
+    // execution thread.
+    //
+    explicit Timer(const IceUtil::Time&);
+
+    //
+    // Construct a timing wheel timer with the given tick and starts its
+    // execution thread with the priority.
+    //
+    Timer(const IceUtil::Time&, int priority);
+
+    virtual ~Timer();
+
     //
     // Destroy the timer and detach its execution thread if the calling thread 
     // is the timer thread, join the timer execution thread otherwise.
@@ -116,6 +137,14 @@ protected:
     };
     std::map<TimerTaskPtr, IceUtil::Time, TimerTaskCompare> _tasks;
     IceUtil::Time _wakeUpTime;
+
+private:
+
+    void runWheel();
+    void runTask(const TimerTaskPtr&);
+
+    class TimingWheel;
+    TimingWheel* _wheel;
 };
 typedef IceUtil::Handle<Timer> TimerPtr;
 
@@ -0,0 +1,116 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/AdaptiveRequestHandler.h>
+#include <Ice/EndpointLoad.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/OutgoingAsync.h>
+#include <IceUtil/Random.h>
+
+using namespace std;
+using namespace IceInternal;
+
+AdaptiveRequestHandler::AdaptiveRequestHandler(const ReferencePtr& reference,
+                                               const vector<RequestHandlerPtr>& handlers,
+                                               const vector<EndpointLoadPtr>& loads) :
+    RequestHandler(reference),
+    _handlers(handlers),
+    _loads(loads),
+    _random(IceUtilInternal::random() | 1)
+{
+    assert(!_handlers.empty() && _handlers.size() == _loads.size());
+}
+
+RequestHandlerPtr
+AdaptiveRequestHandler::update(const RequestHandlerPtr& previousHandler, const RequestHandlerPtr& newHandler)
+{
+    if(previousHandler.get() == this)
+    {
+        return newHandler;
+    }
+
+    //
+    // The connect request handler of an endpoint is replaced by the
+    // connection request handler once the connection is established.
+    //
+    Lock sync(*this);
+    for(vector<RequestHandlerPtr>::iterator p = _handlers.begin(); p != _handlers.end(); ++p)
+    {
+        if(p->get() == previousHandler.get())
+        {
+            *p = newHandler;
+        }
+    }
+    return ICE_SHARED_FROM_THIS;
+}
+
+AsyncStatus
+AdaptiveRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
+{
+    EndpointLoadPtr load;
+    RequestHandlerPtr handler = getRequestHandler(load);
+    out->endpointSelected(load);
+    return handler->sendAsyncRequest(out);
+}
+
+void
+AdaptiveRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&)
+{
+    //
+    // Requests are registered for cancellation with the request handler
+    // or the connection of the endpoint which sent them.
+    //
+    assert(false);
+}
+
+Ice::ConnectionIPtr
+AdaptiveRequestHandler::getConnection()
+{
+    RequestHandlerPtr handler;
+    {
+        Lock sync(*this);
+        handler = _handlers.front();
+    }
+    return handler->getConnection();
+}
+
+Ice::ConnectionIPtr
+AdaptiveRequestHandler::waitForConnection()
+{
+    EndpointLoadPtr load;
+    return getRequestHandler(load)->waitForConnection();
+}
+
+RequestHandlerPtr
+AdaptiveRequestHandler::getRequestHandler(EndpointLoadPtr& load)
+{
+    Lock sync(*this);
+    size_t best = 0;
+    if(_handlers.size() > 1)
+    {
+        //
+        // Pick two distinct endpoints with a xorshift generator and keep
+        // the endpoint with the lowest cost.
+        //
+        _random ^= _random << 13;
+        _random ^= _random >> 17;
+        _random ^= _random << 5;
+        size_t i = _random % _handlers.size();
+        size_t j = (_random / _handlers.size()) % (_handlers.size() - 1);
+        if(j >= i)
+        {
+            ++j;
+        }
+
+        const IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        best = _loads[j]->cost(now) < _loads[i]->cost(now) ? j : i;
+    }
+    load = _loads[best];
+    return _handlers[best];
+}
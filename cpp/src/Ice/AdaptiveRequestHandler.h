@@ -0,0 +1,60 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ADAPTIVE_REQUEST_HANDLER_H
+#define ICE_ADAPTIVE_REQUEST_HANDLER_H
+
+#include <IceUtil/Mutex.h>
+#include <Ice/RequestHandler.h>
+#include <Ice/ReferenceF.h>
+#include <Ice/EndpointLoadF.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The request handler of a two-way proxy with the Adaptive endpoint
+// selection. It holds a request handler for each endpoint of the proxy
+// (a connect request handler until the connection is established) and
+// sends each request with the endpoint which has the lowest load of
+// two endpoints picked at random.
+//
+class AdaptiveRequestHandler : public RequestHandler, private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+                             , public std::enable_shared_from_this<AdaptiveRequestHandler>
+#endif
+{
+public:
+
+    AdaptiveRequestHandler(const ReferencePtr&, const std::vector<RequestHandlerPtr>&,
+                           const std::vector<EndpointLoadPtr>&);
+
+    virtual RequestHandlerPtr update(const RequestHandlerPtr&, const RequestHandlerPtr&);
+
+    virtual AsyncStatus sendAsyncRequest(const ProxyOutgoingAsyncBasePtr&);
+
+    virtual void asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&);
+
+    virtual Ice::ConnectionIPtr getConnection();
+    virtual Ice::ConnectionIPtr waitForConnection();
+
+private:
+
+    RequestHandlerPtr getRequestHandler(EndpointLoadPtr&);
+
+    std::vector<RequestHandlerPtr> _handlers;
+    const std::vector<EndpointLoadPtr> _loads;
+    unsigned int _random;
+};
+
+}
+
+#endif
@@ -0,0 +1,97 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/AdmissionController.h>
+#include <Ice/Instance.h>
+#include <Ice/ThreadPool.h>
+#include <Ice/TraceLevels.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/Properties.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(AdmissionController* p) { return p; }
+
+IceInternal::AdmissionController::AdmissionController(const InstancePtr& instance,
+                                                      const string& adapterName,
+                                                      const ThreadPoolPtr& threadPool) :
+    _instance(instance),
+    _adapterName(adapterName),
+    _threadPool(threadPool),
+    _target(IceUtil::Time::milliSeconds(
+                instance->initializationData().properties->getPropertyAsInt(adapterName + ".AdmissionControl.Target"))),
+    _interval(IceUtil::Time::milliSeconds(
+                instance->initializationData().properties->getPropertyAsIntWithDefault(
+                    adapterName + ".AdmissionControl.Interval", 100))),
+    _maxQueue(instance->initializationData().properties->getPropertyAsInt(adapterName + ".AdmissionControl.MaxQueue")),
+    _priorityContext(instance->initializationData().properties->getProperty(
+                         adapterName + ".AdmissionControl.PriorityContext")),
+    _overloaded(false)
+{
+    StringSeq operations;
+    operations.push_back("ice_ping");
+    operations = instance->initializationData().properties->getPropertyAsListWithDefault(
+        adapterName + ".AdmissionControl.PriorityOperations", operations);
+    _priorityOperations.insert(operations.begin(), operations.end());
+}
+
+bool
+IceInternal::AdmissionController::admit(const Current& current, const IceUtil::Time& now, const IceUtil::Time& wait)
+{
+    if(_priorityOperations.find(current.operation) != _priorityOperations.end() ||
+       (!_priorityContext.empty() && current.ctx.find(_priorityContext) != current.ctx.end()))
+    {
+        return true;
+    }
+
+    if(_maxQueue > 0 && _threadPool->dispatchQueueSize() > _maxQueue)
+    {
+        return false;
+    }
+
+    if(_target <= IceUtil::Time())
+    {
+        return true;
+    }
+
+    IceUtil::Mutex::Lock sync(*this);
+    if(now >= _intervalEnd)
+    {
+        //
+        // The interval is over, the adapter is overloaded if no request
+        // waited less than the target during the interval. It's not if
+        // no requests were dispatched during the last interval.
+        //
+        bool overloaded = now < _intervalEnd + _interval && _minWait > _target;
+        if(overloaded != _overloaded && _instance->traceLevels()->threadPool >= 1)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+            if(overloaded)
+            {
+                out << "object adapter `" << _adapterName << "' is overloaded, requests waited at least "
+                    << _minWait.toMilliSecondsDouble() << "ms for dispatch";
+            }
+            else
+            {
+                out << "object adapter `" << _adapterName << "' is no longer overloaded";
+            }
+        }
+        _overloaded = overloaded;
+        _intervalEnd = now + _interval;
+        _minWait = wait;
+    }
+    else if(wait < _minWait)
+    {
+        _minWait = wait;
+    }
+
+    return !_overloaded || wait <= _target * 2;
+}
@@ -0,0 +1,74 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ADMISSION_CONTROLLER_H
+#define ICE_ADMISSION_CONTROLLER_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/AdmissionControllerF.h>
+#include <Ice/InstanceF.h>
+#include <Ice/ThreadPoolF.h>
+#include <Ice/Current.h>
+
+#include <set>
+
+namespace IceInternal
+{
+
+//
+// The admission controller of an object adapter rejects requests before
+// they are dispatched when the adapter falls behind. It's configured
+// with the <adapter>.AdmissionControl properties and only applies to the
+// requests queued for dispatch, with dispatch threads or a dispatcher.
+//
+// The controller works like CoDel on the time spent by the requests in
+// the dispatch queue: when no request waited less than the target during
+// an interval, the adapter is overloaded until a request waits less than
+// the target for a whole interval again. While the adapter is overloaded,
+// the requests which waited more than twice the target are rejected. The
+// controller also rejects requests when more than MaxQueue requests are
+// waiting in the dispatch queues of the thread pool.
+//
+// The requests for the operations of PriorityOperations or with the
+// PriorityContext context entry are always admitted.
+//
+class AdmissionController : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    AdmissionController(const InstancePtr&, const std::string&, const ThreadPoolPtr&);
+
+    //
+    // Returns true if the request can be dispatched, given the current
+    // time and the time the request waited in the dispatch queue.
+    //
+    bool admit(const Ice::Current&, const IceUtil::Time&, const IceUtil::Time&);
+
+private:
+
+    const InstancePtr _instance;
+    const std::string _adapterName;
+    const ThreadPoolPtr _threadPool;
+
+    const IceUtil::Time _target;
+    const IceUtil::Time _interval;
+    const int _maxQueue;
+    std::set<std::string> _priorityOperations;
+    const std::string _priorityContext;
+
+    IceUtil::Time _intervalEnd;
+    IceUtil::Time _minWait;
+    bool _overloaded;
+};
+
+}
+
+#endif
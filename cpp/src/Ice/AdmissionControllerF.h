@@ -0,0 +1,25 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ADMISSION_CONTROLLER_F_H
+#define ICE_ADMISSION_CONTROLLER_F_H
+
+#include <IceUtil/Shared.h>
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class AdmissionController;
+IceUtil::Shared* upCast(AdmissionController*);
+typedef IceInternal::Handle<AdmissionController> AdmissionControllerPtr;
+
+}
+
+#endif
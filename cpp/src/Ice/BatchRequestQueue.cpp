@@ -64,9 +64,55 @@ private:
     const int _size;
 };
 
+//
+// Flushes the batch requests queued with a proxy once the batch
+// auto-flush delay of the proxy has elapsed.
+//
+class FlushTimerTask : public IceUtil::TimerTask
+{
+public:
+
+    FlushTimerTask(const BatchRequestQueuePtr& queue, const Ice::ObjectPrxPtr& proxy) : _queue(queue), _proxy(proxy)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        //
+        // The task is cleared from the queue before the flush, otherwise
+        // the failure of this flush would prevent the scheduling of the
+        // next flushes.
+        //
+        if(!_queue->flushTaskRunning(this))
+        {
+            return; // The batch was already sent or the queue is destroyed.
+        }
+
+        try
+        {
+#ifdef ICE_CPP11_MAPPING
+            _proxy->ice_flushBatchRequestsAsync();
+#else
+            _proxy->begin_ice_flushBatchRequests();
+#endif
+        }
+        catch(const Ice::LocalException&)
+        {
+            // Ignore, the communicator is being destroyed.
+        }
+    }
+
+private:
+
+    const BatchRequestQueuePtr _queue;
+    const Ice::ObjectPrxPtr _proxy;
+};
+
 }
 
 BatchRequestQueue::BatchRequestQueue(const InstancePtr& instance, bool datagram) :
+    _instance(instance),
     _interceptor(instance->initializationData().batchRequestInterceptor),
     _batchStream(instance.get(), Ice::currentProtocolEncoding),
     _batchStreamInUse(false),
@@ -152,6 +198,10 @@ BatchRequestQueue::finishBatchRequest(OutputStream* os,
         _batchStream.resize(_batchMarker);
         _batchStreamInUse = false;
         _batchStreamCanFlush = false;
+        if(_batchRequestNum > 0 && !_flushTask)
+        {
+            scheduleFlush(proxy);
+        }
         notifyAll();
     }
     catch(const std::exception&)
@@ -199,6 +249,7 @@ BatchRequestQueue::swap(OutputStream* os, bool& compress)
     int requestNum = _batchRequestNum;
     _batchStream.swap(*os);
     compress = _batchCompress;
+    cancelFlush();
 
     //
     // Reset the batch.
@@ -223,6 +274,19 @@ BatchRequestQueue::destroy(const Ice::LocalException& ex)
 #else
     _exception.reset(ex.ice_clone());
 #endif
+    cancelFlush();
+}
+
+bool
+BatchRequestQueue::flushTaskRunning(const IceUtil::TimerTask* task)
+{
+    Lock sync(*this);
+    if(_flushTask.get() != task)
+    {
+        return false;
+    }
+    _flushTask = ICE_NULLPTR;
+    return true;
 }
 
 bool
@@ -241,6 +305,49 @@ BatchRequestQueue::waitStreamInUse(bool flush)
     }
 }
 
+void
+BatchRequestQueue::scheduleFlush(const Ice::ObjectPrxPtr& proxy)
+{
+    //
+    // Schedule a flush of the batch when its first request is queued, the
+    // batch is sent once it reaches the auto-flush size or once the
+    // auto-flush delay of the proxy elapsed, whichever comes first.
+    //
+    int delay = proxy->_getReference()->getBatchAutoFlushDelay();
+    if(delay > 0)
+    {
+        try
+        {
+            _flushTask = ICE_MAKE_SHARED(FlushTimerTask, this, proxy);
+            _instance->timer()->schedule(_flushTask, IceUtil::Time::milliSeconds(delay));
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+            _flushTask = ICE_NULLPTR;
+        }
+        catch(const IceUtil::IllegalArgumentException&) // Expected if the communicator destroyed the timer.
+        {
+            _flushTask = ICE_NULLPTR;
+        }
+    }
+}
+
+void
+BatchRequestQueue::cancelFlush()
+{
+    if(_flushTask)
+    {
+        try
+        {
+            _instance->timer()->cancel(_flushTask);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+        }
+        _flushTask = ICE_NULLPTR;
+    }
+}
+
 void
 BatchRequestQueue::enqueueBatchRequest(const Ice::ObjectPrxPtr& proxy)
 {
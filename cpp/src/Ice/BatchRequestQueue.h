@@ -13,6 +13,7 @@
 #include <IceUtil/Shared.h>
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Timer.h>
 #include <Ice/UniquePtr.h>
 
 #include <Ice/BatchRequestInterceptor.h>
@@ -36,6 +37,7 @@ public:
     int swap(Ice::OutputStream*, bool&);
 
     void destroy(const Ice::LocalException&);
+    bool flushTaskRunning(const IceUtil::TimerTask*);
     bool isEmpty();
 
     void enqueueBatchRequest(const Ice::ObjectPrxPtr&);
@@ -43,6 +45,10 @@ public:
 private:
 
     void waitStreamInUse(bool);
+    void scheduleFlush(const Ice::ObjectPrxPtr&);
+    void cancelFlush();
+
+    const InstancePtr _instance;
 
 #ifdef ICE_CPP11_MAPPING
     std::function<void(const Ice::BatchRequest&, int, int)> _interceptor;
@@ -57,6 +63,7 @@ private:
     size_t _batchMarker;
     IceInternal::UniquePtr<Ice::LocalException> _exception;
     size_t _maxSize;
+    IceUtil::TimerTaskPtr _flushTask;
 };
 
 };
@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Buffer.h>
+#include <Ice/BufferPool.h>
 #include <Ice/LocalException.h>
 
 using namespace std;
@@ -67,6 +68,7 @@ IceInternal::Buffer::Container::Container(Container& other, bool adopt)
         _capacity = other._capacity;
         _shrinkCounter = other._shrinkCounter;
         _owned = other._owned;
+        _pool = other._pool;
 
         other._buf = 0;
         other._size = 0;
@@ -81,15 +83,13 @@ IceInternal::Buffer::Container::Container(Container& other, bool adopt)
         _capacity = other._capacity;
         _shrinkCounter = 0;
         _owned = false;
+        _pool = other._pool;
     }
 }
 
 IceInternal::Buffer::Container::~Container()
 {
-    if(_buf && _owned)
-    {
-        ::free(_buf);
-    }
+    deallocate();
 }
 
 void
@@ -100,15 +100,13 @@ IceInternal::Buffer::Container::swap(Container& other)
     std::swap(_capacity, other._capacity);
     std::swap(_shrinkCounter, other._shrinkCounter);
     std::swap(_owned, other._owned);
+    _pool.swap(other._pool);
 }
 
 void
 IceInternal::Buffer::Container::clear()
 {
-    if(_buf && _owned)
-    {
-        ::free(_buf);
-    }
+    deallocate();
 
     _buf = 0;
     _size = 0;
@@ -136,7 +134,27 @@ IceInternal::Buffer::Container::reserve(size_type n)
     }
 
     pointer p;
-    if(_owned)
+    if(_pool)
+    {
+        //
+        // The pool might return a larger block than requested, the
+        // capacity is the size of the block.
+        //
+        p = _pool->allocate(_capacity);
+        if(p)
+        {
+            if(_buf)
+            {
+                ::memcpy(p, _buf, std::min(_size, _capacity));
+                if(_owned)
+                {
+                    _pool->deallocate(_buf, c);
+                }
+            }
+            _owned = true;
+        }
+    }
+    else if(_owned)
     {
         p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
     }
@@ -158,3 +176,28 @@ IceInternal::Buffer::Container::reserve(size_type n)
 
     _buf = p;
 }
+
+void
+IceInternal::Buffer::Container::setPool(const BufferPoolPtr& pool)
+{
+    if(!_buf || !_owned)
+    {
+        _pool = pool;
+    }
+}
+
+void
+IceInternal::Buffer::Container::deallocate()
+{
+    if(_buf && _owned)
+    {
+        if(_pool)
+        {
+            _pool->deallocate(_buf, _capacity);
+        }
+        else
+        {
+            ::free(_buf);
+        }
+    }
+}
@@ -0,0 +1,283 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/BufferPool.h>
+#include <Ice/HashUtil.h>
+#include <Ice/MetricsObserverI.h>
+
+#include <sstream>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(BufferPool* p) { return p; }
+
+namespace
+{
+
+//
+// The BufferPool metrics map provides one BufferPoolMetrics object per
+// size class, the id of the metrics is the block size. The map doesn't
+// support the GroupBy, Accept and Reject properties.
+//
+class BufferPoolMetricsMap : public MetricsMapI
+{
+public:
+
+    BufferPoolMetricsMap(const string& mapPrefix, const PropertiesPtr& properties, const BufferPoolPtr& pool) :
+        MetricsMapI(mapPrefix, properties),
+        _pool(pool)
+    {
+    }
+
+    virtual void
+    destroy()
+    {
+    }
+
+    virtual IceMX::MetricsFailuresSeq
+    getFailures()
+    {
+        return IceMX::MetricsFailuresSeq();
+    }
+
+    virtual IceMX::MetricsFailures
+    getFailures(const string&)
+    {
+        return IceMX::MetricsFailures();
+    }
+
+    virtual IceMX::MetricsMap
+    getMetrics() const
+    {
+        IceMX::MetricsMap metrics;
+        vector<BufferPool::Statistics> stats = _pool->getStatistics();
+        for(vector<BufferPool::Statistics>::const_iterator p = stats.begin(); p != stats.end(); ++p)
+        {
+            ostringstream os;
+            os << p->size;
+
+            IceMX::BufferPoolMetricsPtr m = ICE_MAKE_SHARED(IceMX::BufferPoolMetrics);
+            m->id = os.str();
+            m->allocated = p->allocated;
+            m->misses = p->misses;
+            m->cached = static_cast<Int>(p->cached);
+            metrics.push_back(m);
+        }
+        return metrics;
+    }
+
+    virtual MetricsMapIPtr
+    clone() const
+    {
+        return ICE_MAKE_SHARED(BufferPoolMetricsMap, *this);
+    }
+
+private:
+
+    const BufferPoolPtr _pool;
+};
+
+class BufferPoolMetricsMapFactory : public MetricsMapFactory, public IceMX::Updater
+{
+public:
+
+    BufferPoolMetricsMapFactory(const BufferPoolPtr& pool) : MetricsMapFactory(this), _pool(pool)
+    {
+    }
+
+    virtual MetricsMapIPtr
+    create(const string& mapPrefix, const PropertiesPtr& properties)
+    {
+        return ICE_MAKE_SHARED(BufferPoolMetricsMap, mapPrefix, properties, _pool);
+    }
+
+    virtual void
+    update()
+    {
+        //
+        // Nothing to do, the statistics are computed when the metrics
+        // are retrieved.
+        //
+    }
+
+private:
+
+    const BufferPoolPtr _pool;
+};
+
+}
+
+IceInternal::BufferPool::BufferPool(size_t maxMemory) :
+    _cached(0),
+    _maxMemory(maxMemory)
+{
+    for(int i = 0; i < Stripes; ++i)
+    {
+        for(int j = 0; j < StripeClasses; ++j)
+        {
+            _stripes[i].blocks[j].reserve(StripeBlocks);
+            _stripes[i].allocated[j] = 0;
+        }
+    }
+
+    for(int i = 0; i < Classes; ++i)
+    {
+        _allocated[i] = 0;
+        _misses[i] = 0;
+    }
+}
+
+IceInternal::BufferPool::~BufferPool()
+{
+    for(int i = 0; i < Stripes; ++i)
+    {
+        for(int j = 0; j < StripeClasses; ++j)
+        {
+            for(vector<Byte*>::const_iterator p = _stripes[i].blocks[j].begin(); p != _stripes[i].blocks[j].end(); ++p)
+            {
+                ::free(*p);
+            }
+        }
+    }
+
+    for(int i = 0; i < Classes; ++i)
+    {
+        for(vector<Byte*>::const_iterator p = _blocks[i].begin(); p != _blocks[i].end(); ++p)
+        {
+            ::free(*p);
+        }
+    }
+}
+
+Byte*
+IceInternal::BufferPool::allocate(size_t& size)
+{
+    size_t c = classIndex(size);
+    if(c >= Classes)
+    {
+        return reinterpret_cast<Byte*>(::malloc(size));
+    }
+    size = MinSize << c;
+
+    if(c < StripeClasses)
+    {
+        Stripe& stripe = _stripes[hashThread() % Stripes];
+        IceUtil::Mutex::Lock sync(stripe.mutex);
+        ++stripe.allocated[c];
+        if(!stripe.blocks[c].empty())
+        {
+            Byte* p = stripe.blocks[c].back();
+            stripe.blocks[c].pop_back();
+            return p;
+        }
+    }
+
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(c >= StripeClasses)
+        {
+            ++_allocated[c];
+        }
+        if(!_blocks[c].empty())
+        {
+            Byte* p = _blocks[c].back();
+            _blocks[c].pop_back();
+            _cached -= size;
+            return p;
+        }
+        ++_misses[c];
+    }
+    return reinterpret_cast<Byte*>(::malloc(size));
+}
+
+void
+IceInternal::BufferPool::deallocate(Byte* p, size_t size)
+{
+    size_t c = classIndex(size);
+    if(c >= Classes || size != static_cast<size_t>(MinSize << c))
+    {
+        ::free(p);
+        return;
+    }
+
+    if(c < StripeClasses)
+    {
+        Stripe& stripe = _stripes[hashThread() % Stripes];
+        IceUtil::Mutex::Lock sync(stripe.mutex);
+        if(stripe.blocks[c].size() < StripeBlocks)
+        {
+            stripe.blocks[c].push_back(p);
+            return;
+        }
+    }
+
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        if(_cached + size <= _maxMemory)
+        {
+            _blocks[c].push_back(p);
+            _cached += size;
+            return;
+        }
+    }
+    ::free(p);
+}
+
+vector<BufferPool::Statistics>
+IceInternal::BufferPool::getStatistics()
+{
+    vector<Statistics> stats(Classes);
+    for(int i = 0; i < Classes; ++i)
+    {
+        stats[i].size = MinSize << i;
+        stats[i].allocated = 0;
+        stats[i].misses = 0;
+        stats[i].cached = 0;
+    }
+
+    for(int i = 0; i < Stripes; ++i)
+    {
+        IceUtil::Mutex::Lock sync(_stripes[i].mutex);
+        for(int j = 0; j < StripeClasses; ++j)
+        {
+            stats[j].allocated += _stripes[i].allocated[j];
+            stats[j].cached += _stripes[i].blocks[j].size();
+        }
+    }
+
+    IceUtil::Mutex::Lock sync(_mutex);
+    for(int i = 0; i < Classes; ++i)
+    {
+        stats[i].allocated += _allocated[i];
+        stats[i].misses = _misses[i];
+        stats[i].cached += _blocks[i].size();
+    }
+    return stats;
+}
+
+MetricsMapFactoryPtr
+IceInternal::BufferPool::createMetricsMapFactory()
+{
+    return ICE_MAKE_SHARED(BufferPoolMetricsMapFactory, this);
+}
+
+size_t
+IceInternal::BufferPool::classIndex(size_t size)
+{
+    size_t c = 0;
+    size_t s = MinSize;
+    while(s < size && c < Classes)
+    {
+        s <<= 1;
+        ++c;
+    }
+    return c;
+}
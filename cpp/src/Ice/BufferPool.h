@@ -0,0 +1,104 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_BUFFER_POOL_H
+#define ICE_BUFFER_POOL_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <Ice/BufferPoolF.h>
+#include <Ice/MetricsAdminI.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The buffer pool caches the memory of the stream buffers of a
+// communicator. Blocks are allocated in power of two size classes from
+// 256 bytes to 1MB, larger blocks are allocated and released with
+// malloc and free.
+//
+// Blocks of up to 64KB are first cached in a small per-thread cache
+// (the thread cache is one of several stripes selected with the hash of
+// the thread ID) and otherwise in the central cache of the pool. The
+// central cache holds at most Ice.BufferPool.MaxMemory bytes, blocks
+// which don't fit are released.
+//
+class BufferPool : public IceUtil::Shared
+{
+public:
+
+    BufferPool(size_t);
+    ~BufferPool();
+
+    //
+    // Allocate a block of at least the given size, the size is set to
+    // the size of the allocated block. Returns 0 if the allocation
+    // failed.
+    //
+    Ice::Byte* allocate(size_t&);
+
+    //
+    // Return a block allocated with allocate().
+    //
+    void deallocate(Ice::Byte*, size_t);
+
+    struct Statistics
+    {
+        size_t size;
+        Ice::Long allocated;
+        Ice::Long misses;
+        size_t cached;
+    };
+
+    //
+    // Returns the statistics of each size class.
+    //
+    std::vector<Statistics> getStatistics();
+
+    //
+    // Create the factory of the BufferPool metrics map.
+    //
+    MetricsMapFactoryPtr createMetricsMapFactory();
+
+private:
+
+    enum
+    {
+        MinSize = 256,
+        Classes = 13, // 256 bytes to 1MB
+        StripeClasses = 9, // 256 bytes to 64KB
+        StripeBlocks = 4,
+        Stripes = 8
+    };
+
+    struct Stripe
+    {
+        IceUtil::Mutex mutex;
+        std::vector<Ice::Byte*> blocks[StripeClasses];
+        Ice::Long allocated[StripeClasses];
+    };
+
+    static size_t classIndex(size_t);
+
+    Stripe _stripes[Stripes];
+
+    IceUtil::Mutex _mutex;
+    std::vector<Ice::Byte*> _blocks[Classes];
+    Ice::Long _allocated[Classes];
+    Ice::Long _misses[Classes];
+    size_t _cached;
+    const size_t _maxMemory;
+};
+
+}
+
+#endif
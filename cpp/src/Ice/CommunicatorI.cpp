@@ -138,6 +138,7 @@ CommunicatorFlushBatchAsync::flushConnection(const ConnectionIPtr& con, Ice::Com
         }
         else
         {
+            _observer.batchRequests(batchRequestNum);
             if(compressBatch == ICE_SCOPED_ENUM(CompressBatch, Yes))
             {
                 compress = true;
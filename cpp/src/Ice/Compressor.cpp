@@ -0,0 +1,480 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Compressor.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/LocalException.h>
+#include <Ice/DynamicLibrary.h>
+
+#ifdef ICE_HAS_BZIP2
+#  include <bzlib.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(Compressor* p) { return p; }
+IceUtil::Shared* IceInternal::upCast(CompressorManager* p) { return p; }
+
+namespace
+{
+
+#ifdef ICE_HAS_BZIP2
+string
+getBZ2Error(int bzError)
+{
+    if(bzError == BZ_RUN_OK)
+    {
+        return ": BZ_RUN_OK";
+    }
+    else if(bzError == BZ_FLUSH_OK)
+    {
+        return ": BZ_FLUSH_OK";
+    }
+    else if(bzError == BZ_FINISH_OK)
+    {
+        return ": BZ_FINISH_OK";
+    }
+    else if(bzError == BZ_STREAM_END)
+    {
+        return ": BZ_STREAM_END";
+    }
+    else if(bzError == BZ_CONFIG_ERROR)
+    {
+        return ": BZ_CONFIG_ERROR";
+    }
+    else if(bzError == BZ_SEQUENCE_ERROR)
+    {
+        return ": BZ_SEQUENCE_ERROR";
+    }
+    else if(bzError == BZ_PARAM_ERROR)
+    {
+        return ": BZ_PARAM_ERROR";
+    }
+    else if(bzError == BZ_MEM_ERROR)
+    {
+        return ": BZ_MEM_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR)
+    {
+        return ": BZ_DATA_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR_MAGIC)
+    {
+        return ": BZ_DATA_ERROR_MAGIC";
+    }
+    else if(bzError == BZ_IO_ERROR)
+    {
+        return ": BZ_IO_ERROR";
+    }
+    else if(bzError == BZ_UNEXPECTED_EOF)
+    {
+        return ": BZ_UNEXPECTED_EOF";
+    }
+    else if(bzError == BZ_OUTBUFF_FULL)
+    {
+        return ": BZ_OUTBUFF_FULL";
+    }
+    else
+    {
+        return "";
+    }
+}
+
+class BZip2Compressor : public Compressor
+{
+public:
+
+    BZip2Compressor(int level) : _level(level < 1 ? 1 : (level > 9 ? 9 : level))
+    {
+    }
+
+    virtual Byte
+    codec() const
+    {
+        return CompressionCodecBZip2;
+    }
+
+    virtual size_t
+    compressBound(size_t size) const
+    {
+        return static_cast<size_t>(size * 1.01 + 600);
+    }
+
+    virtual size_t
+    compress(const Byte* data, size_t size, Byte* compressed, size_t compressedSize) const
+    {
+        unsigned int compressedLen = static_cast<unsigned int>(compressedSize);
+        int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(compressed), &compressedLen,
+                                               const_cast<char*>(reinterpret_cast<const char*>(data)),
+                                               static_cast<unsigned int>(size), _level, 0, 0);
+        if(bzError != BZ_OK)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError);
+            throw ex;
+        }
+        return compressedLen;
+    }
+
+    virtual void
+    uncompress(const Byte* compressed, size_t compressedSize, Byte* data, size_t size) const
+    {
+        unsigned int uncompressedLen = static_cast<unsigned int>(size);
+        int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(data), &uncompressedLen,
+                                                 const_cast<char*>(reinterpret_cast<const char*>(compressed)),
+                                                 static_cast<unsigned int>(compressedSize), 0, 0);
+        if(bzError != BZ_OK)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError);
+            throw ex;
+        }
+    }
+
+private:
+
+    const int _level;
+};
+#endif
+
+#ifndef ICE_OS_UWP
+
+#if defined(_WIN32)
+const char* lz4Library = "liblz4.dll";
+const char* zstdLibrary = "libzstd.dll";
+#elif defined(__APPLE__)
+const char* lz4Library = "liblz4.1.dylib";
+const char* zstdLibrary = "libzstd.1.dylib";
+#else
+const char* lz4Library = "liblz4.so.1";
+const char* zstdLibrary = "libzstd.so.1";
+#endif
+
+//
+// The LZ4 codec uses the LZ4 block format, the size of the uncompressed
+// data is already provided by the message. The fast compressor is used
+// with level 1, the high compression compressor with higher levels.
+//
+class LZ4Compressor : public Compressor
+{
+public:
+
+    static CompressorPtr
+    load(int level)
+    {
+        DynamicLibraryPtr library = new DynamicLibrary();
+        if(!library->load(lz4Library))
+        {
+            return 0;
+        }
+
+        LZ4Compressor* compressor = new LZ4Compressor(library, level);
+        CompressorPtr p = compressor;
+        compressor->_compressBound = reinterpret_cast<CompressBound>(library->getSymbol("LZ4_compressBound"));
+        compressor->_compressDefault = reinterpret_cast<CompressDefault>(library->getSymbol("LZ4_compress_default"));
+        compressor->_compressHC = reinterpret_cast<CompressHC>(library->getSymbol("LZ4_compress_HC"));
+        compressor->_decompressSafe = reinterpret_cast<DecompressSafe>(library->getSymbol("LZ4_decompress_safe"));
+        if(!compressor->_compressBound || !compressor->_compressDefault || !compressor->_decompressSafe)
+        {
+            return 0;
+        }
+        return p;
+    }
+
+    virtual Byte
+    codec() const
+    {
+        return CompressionCodecLZ4;
+    }
+
+    virtual size_t
+    compressBound(size_t size) const
+    {
+        return static_cast<size_t>(_compressBound(static_cast<int>(size)));
+    }
+
+    virtual size_t
+    compress(const Byte* data, size_t size, Byte* compressed, size_t compressedSize) const
+    {
+        int ret;
+        if(_level > 1 && _compressHC)
+        {
+            ret = _compressHC(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(compressed),
+                              static_cast<int>(size), static_cast<int>(compressedSize), _level);
+        }
+        else
+        {
+            ret = _compressDefault(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(compressed),
+                                   static_cast<int>(size), static_cast<int>(compressedSize));
+        }
+        if(ret <= 0)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "LZ4 compression failed";
+            throw ex;
+        }
+        return static_cast<size_t>(ret);
+    }
+
+    virtual void
+    uncompress(const Byte* compressed, size_t compressedSize, Byte* data, size_t size) const
+    {
+        int ret = _decompressSafe(reinterpret_cast<const char*>(compressed), reinterpret_cast<char*>(data),
+                                  static_cast<int>(compressedSize), static_cast<int>(size));
+        if(ret != static_cast<int>(size))
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "LZ4_decompress_safe failed";
+            throw ex;
+        }
+    }
+
+private:
+
+    typedef int (*CompressBound)(int);
+    typedef int (*CompressDefault)(const char*, char*, int, int);
+    typedef int (*CompressHC)(const char*, char*, int, int, int);
+    typedef int (*DecompressSafe)(const char*, char*, int, int);
+
+    LZ4Compressor(const DynamicLibraryPtr& library, int level) :
+        _library(library), _level(level > 12 ? 12 : level)
+    {
+    }
+
+    const DynamicLibraryPtr _library;
+    const int _level;
+    CompressBound _compressBound;
+    CompressDefault _compressDefault;
+    CompressHC _compressHC;
+    DecompressSafe _decompressSafe;
+};
+
+class ZstdCompressor : public Compressor
+{
+public:
+
+    static CompressorPtr
+    load(int level)
+    {
+        DynamicLibraryPtr library = new DynamicLibrary();
+        if(!library->load(zstdLibrary))
+        {
+            return 0;
+        }
+
+        ZstdCompressor* compressor = new ZstdCompressor(library, level);
+        CompressorPtr p = compressor;
+        compressor->_compressBound = reinterpret_cast<CompressBound>(library->getSymbol("ZSTD_compressBound"));
+        compressor->_compress = reinterpret_cast<Compress>(library->getSymbol("ZSTD_compress"));
+        compressor->_decompress = reinterpret_cast<Decompress>(library->getSymbol("ZSTD_decompress"));
+        compressor->_isError = reinterpret_cast<IsError>(library->getSymbol("ZSTD_isError"));
+        compressor->_getErrorName = reinterpret_cast<GetErrorName>(library->getSymbol("ZSTD_getErrorName"));
+        if(!compressor->_compressBound || !compressor->_compress || !compressor->_decompress ||
+           !compressor->_isError || !compressor->_getErrorName)
+        {
+            return 0;
+        }
+        return p;
+    }
+
+    virtual Byte
+    codec() const
+    {
+        return CompressionCodecZstd;
+    }
+
+    virtual size_t
+    compressBound(size_t size) const
+    {
+        return _compressBound(size);
+    }
+
+    virtual size_t
+    compress(const Byte* data, size_t size, Byte* compressed, size_t compressedSize) const
+    {
+        size_t ret = _compress(compressed, compressedSize, data, size, _level);
+        if(_isError(ret))
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = string("ZSTD_compress failed: ") + _getErrorName(ret);
+            throw ex;
+        }
+        return ret;
+    }
+
+    virtual void
+    uncompress(const Byte* compressed, size_t compressedSize, Byte* data, size_t size) const
+    {
+        size_t ret = _decompress(data, size, compressed, compressedSize);
+        if(_isError(ret) || ret != size)
+        {
+            CompressionException ex(__FILE__, __LINE__);
+            ex.reason = "ZSTD_decompress failed";
+            if(_isError(ret))
+            {
+                ex.reason += string(": ") + _getErrorName(ret);
+            }
+            throw ex;
+        }
+    }
+
+private:
+
+    typedef size_t (*CompressBound)(size_t);
+    typedef size_t (*Compress)(void*, size_t, const void*, size_t, int);
+    typedef size_t (*Decompress)(void*, size_t, const void*, size_t);
+    typedef unsigned int (*IsError)(size_t);
+    typedef const char* (*GetErrorName)(size_t);
+
+    ZstdCompressor(const DynamicLibraryPtr& library, int level) :
+        _library(library), _level(level > 22 ? 22 : level)
+    {
+    }
+
+    const DynamicLibraryPtr _library;
+    const int _level;
+    CompressBound _compressBound;
+    Compress _compress;
+    Decompress _decompress;
+    IsError _isError;
+    GetErrorName _getErrorName;
+};
+
+#endif
+
+}
+
+string
+IceInternal::codecName(Byte codec)
+{
+    switch(codec)
+    {
+    case CompressionCodecBZip2:
+        return "bzip2";
+    case CompressionCodecLZ4:
+        return "lz4";
+    case CompressionCodecZstd:
+        return "zstd";
+    default:
+        return "unknown";
+    }
+}
+
+IceInternal::Compressor::~Compressor()
+{
+    // Out of line to avoid weak vtable
+}
+
+IceInternal::CompressorManager::CompressorManager(const PropertiesPtr& properties, const LoggerPtr& logger)
+{
+    int level = properties->getPropertyAsIntWithDefault("Ice.Compression.Level", 1);
+    if(level < 1)
+    {
+        level = 1;
+    }
+
+    int minSize = properties->getPropertyAsIntWithDefault("Ice.Compression.MinSize", 100);
+    _minSize = minSize < 0 ? 0 : static_cast<size_t>(minSize);
+
+    //
+    // BZip2 is always loaded if supported, it's the codec used with peers
+    // which don't support the other codecs.
+    //
+#ifdef ICE_HAS_BZIP2
+    _bzip2 = new BZip2Compressor(level);
+#endif
+
+    //
+    // Only bzip2 is used by default, the LZ4 and Zstandard codecs must be
+    // enabled with Ice.Compression.Codecs.
+    //
+    StringSeq codecs = properties->getPropertyAsListWithDefault("Ice.Compression.Codecs", StringSeq(1, "bzip2"));
+    for(StringSeq::const_iterator p = codecs.begin(); p != codecs.end(); ++p)
+    {
+        CompressorPtr compressor;
+        if(*p == "bzip2")
+        {
+            compressor = _bzip2;
+        }
+#ifndef ICE_OS_UWP
+        else if(*p == "lz4")
+        {
+            compressor = LZ4Compressor::load(level);
+        }
+        else if(*p == "zstd")
+        {
+            compressor = ZstdCompressor::load(level);
+        }
+#endif
+        else
+        {
+            Warning out(logger);
+            out << "unknown compression codec `" << *p << "' in Ice.Compression.Codecs";
+            continue;
+        }
+
+        //
+        // Codecs which are not supported or whose library can't be loaded
+        // are ignored.
+        //
+        if(compressor)
+        {
+            _compressors.push_back(compressor);
+        }
+    }
+}
+
+CompressorPtr
+IceInternal::CompressorManager::get(Byte codec) const
+{
+    if(codec == CompressionCodecBZip2)
+    {
+        return _bzip2;
+    }
+    for(vector<CompressorPtr>::const_iterator p = _compressors.begin(); p != _compressors.end(); ++p)
+    {
+        if((*p)->codec() == codec)
+        {
+            return *p;
+        }
+    }
+    return 0;
+}
+
+CompressorPtr
+IceInternal::CompressorManager::negotiate(Byte status) const
+{
+    for(vector<CompressorPtr>::const_iterator p = _compressors.begin(); p != _compressors.end(); ++p)
+    {
+        Byte codec = (*p)->codec();
+        if(codec == CompressionCodecBZip2 || (status >> 4) & (1 << (codec - 1)))
+        {
+            return *p;
+        }
+    }
+    return _bzip2;
+}
+
+Byte
+IceInternal::CompressorManager::advertise() const
+{
+    Byte status = 0;
+    for(vector<CompressorPtr>::const_iterator p = _compressors.begin(); p != _compressors.end(); ++p)
+    {
+        Byte codec = (*p)->codec();
+        if(codec != CompressionCodecBZip2)
+        {
+            status = static_cast<Byte>(status | (1 << (codec - 1 + 4)));
+        }
+    }
+    return status;
+}
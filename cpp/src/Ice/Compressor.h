@@ -0,0 +1,120 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_COMPRESSOR_H
+#define ICE_COMPRESSOR_H
+
+#include <Ice/CompressorF.h>
+#include <Ice/PropertiesF.h>
+#include <Ice/LoggerF.h>
+#include <Ice/Config.h>
+
+#include <vector>
+
+#if !defined(ICE_OS_UWP)
+#    ifndef ICE_HAS_BZIP2
+#        define ICE_HAS_BZIP2
+#    endif
+#endif
+
+namespace IceInternal
+{
+
+//
+// The compression codecs. The codec of a message is sent in the upper
+// 4 bits of the compression status of the message header, the lower 4
+// bits are the compression status (0, 1 or 2). BZip2 uses 0 to remain
+// compatible with peers which only support bzip2.
+//
+// The compression status of the validate connection message, which is
+// always 0 with older peers, advertises the other codecs supported by
+// the peer: bit N of the upper 4 bits is set if codec N + 1 is supported.
+//
+const Ice::Byte CompressionCodecBZip2 = 0;
+const Ice::Byte CompressionCodecLZ4 = 1;
+const Ice::Byte CompressionCodecZstd = 2;
+
+std::string codecName(Ice::Byte);
+
+class Compressor : public IceUtil::Shared
+{
+public:
+
+    virtual ~Compressor();
+
+    //
+    // The codec of this compressor.
+    //
+    virtual Ice::Byte codec() const = 0;
+
+    //
+    // Returns the maximum size of the compressed data for the given
+    // uncompressed data size.
+    //
+    virtual size_t compressBound(size_t) const = 0;
+
+    //
+    // Compress the given data in the given buffer and return the size of
+    // the compressed data. Raises CompressionException on failure.
+    //
+    virtual size_t compress(const Ice::Byte*, size_t, Ice::Byte*, size_t) const = 0;
+
+    //
+    // Uncompress the given data in the given buffer, the buffer size is
+    // the size of the uncompressed data. Raises CompressionException on
+    // failure.
+    //
+    virtual void uncompress(const Ice::Byte*, size_t, Ice::Byte*, size_t) const = 0;
+};
+
+//
+// The compressor manager loads the codecs configured with the
+// Ice.Compression.Codecs property. The LZ4 and Zstandard codecs are
+// loaded at runtime from the liblz4 and libzstd shared libraries.
+//
+class CompressorManager : public IceUtil::Shared
+{
+public:
+
+    CompressorManager(const Ice::PropertiesPtr&, const Ice::LoggerPtr&);
+
+    //
+    // Returns the compressor for the given codec or 0 if the codec isn't
+    // supported.
+    //
+    CompressorPtr get(Ice::Byte) const;
+
+    //
+    // Returns the preferred compressor for a connection given the
+    // compression status of the validate connection message received
+    // from the peer.
+    //
+    CompressorPtr negotiate(Ice::Byte) const;
+
+    //
+    // Returns the compression status to send with the validate
+    // connection message to advertise the supported codecs.
+    //
+    Ice::Byte advertise() const;
+
+    //
+    // Messages smaller than this size are not compressed.
+    //
+    size_t minSize() const { return _minSize; }
+
+private:
+
+    std::vector<CompressorPtr> _compressors; // The configured compressors, in order of preference.
+    CompressorPtr _bzip2;
+    size_t _minSize;
+};
+
+}
+
+#endif
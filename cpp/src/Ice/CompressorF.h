@@ -0,0 +1,30 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_COMPRESSOR_F_H
+#define ICE_COMPRESSOR_F_H
+
+#include <IceUtil/Shared.h>
+
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class Compressor;
+IceUtil::Shared* upCast(Compressor*);
+typedef Handle<Compressor> CompressorPtr;
+
+class CompressorManager;
+IceUtil::Shared* upCast(CompressorManager*);
+typedef Handle<CompressorManager> CompressorManagerPtr;
+
+}
+
+#endif
@@ -227,6 +227,7 @@ void
 IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpts,
                                                bool hasMore,
                                                Ice::EndpointSelectionType selType,
+                                               int parallelConnect,
                                                const CreateConnectionCallbackPtr& callback)
 {
     assert(!endpts.empty());
@@ -256,9 +257,10 @@ IceInternal::OutgoingConnectionFactory::create(const vector<EndpointIPtr>& endpt
     }
 
 #ifdef ICE_CPP11_MAPPING
-    auto cb = make_shared<ConnectCallback>(_instance, this, endpoints, hasMore, callback, selType);
+    auto cb = make_shared<ConnectCallback>(_instance, this, endpoints, hasMore, callback, selType, parallelConnect);
 #else
-    ConnectCallbackPtr cb = new ConnectCallback(_instance, this, endpoints, hasMore, callback, selType);
+    ConnectCallbackPtr cb = new ConnectCallback(_instance, this, endpoints, hasMore, callback, selType,
+                                                parallelConnect);
 #endif
     cb->getConnectors();
 }
@@ -373,7 +375,10 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
     _destroyed(false),
-    _pendingConnectCount(0)
+    _pendingConnectCount(0),
+    _parallelConnectDelay(IceUtil::Time::milliSeconds(
+        max(instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.ParallelConnectDelay", 250),
+            0)))
 {
 }
 
@@ -866,13 +871,19 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
                                                                          const vector<EndpointIPtr>& endpoints,
                                                                          bool hasMore,
                                                                          const CreateConnectionCallbackPtr& cb,
-                                                                         Ice::EndpointSelectionType selType) :
+                                                                         Ice::EndpointSelectionType selType,
+                                                                         int parallelConnect) :
     _instance(instance),
     _factory(factory),
     _endpoints(endpoints),
     _hasMore(hasMore),
     _callback(cb),
-    _selType(selType)
+    _selType(selType),
+    _parallelConnect(parallelConnect),
+    _parallel(false),
+    _done(false),
+    _timerScheduled(false),
+    _active(0)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -883,6 +894,12 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(const I
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartCompleted(const ConnectionIPtr& connection)
 {
+    if(_parallel)
+    {
+        parallelConnectCompleted(connection);
+        return;
+    }
+
     if(_observer)
     {
         _observer->detach();
@@ -893,9 +910,15 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartComplete
 }
 
 void
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& /*connection*/,
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& connection,
                                                                                const LocalException& ex)
 {
+    if(_parallel)
+    {
+        parallelConnectFailed(connection, ex);
+        return;
+    }
+
     assert(_iter != _connectors.end());
     if(connectionStartFailedImpl(ex))
     {
@@ -1026,6 +1049,21 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::getConnection()
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
 {
+    //
+    // Try the connectors in parallel if enabled and if there's more than one connector,
+    // otherwise try them one after the other.
+    //
+    if(_parallelConnect > 1 && _connectors.size() > 1)
+    {
+        {
+            IceUtil::Mutex::Lock sync(*this);
+            _parallel = true;
+            _iter = _connectors.begin();
+        }
+        nextParallelConnector();
+        return;
+    }
+
     while(true)
     {
         try
@@ -1149,6 +1187,241 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
     return false;
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::runTimerTask()
+{
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        _timerScheduled = false;
+    }
+    nextParallelConnector();
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::nextParallelConnector()
+{
+    while(true)
+    {
+        ConnectorInfo ci(ICE_NULLPTR, ICE_NULLPTR);
+        {
+            IceUtil::Mutex::Lock sync(*this);
+            if(_done || _iter == _connectors.end() || _active >= _parallelConnect)
+            {
+                return;
+            }
+            ci = *_iter++;
+            ++_active;
+        }
+
+        ObserverPtr observer;
+        const CommunicatorObserverPtr& obsv = _factory->_instance->initializationData().observer;
+        if(obsv)
+        {
+            observer = obsv->getConnectionEstablishmentObserver(ci.endpoint, ci.connector->toString());
+            if(observer)
+            {
+                observer->attach();
+            }
+        }
+
+        Ice::ConnectionIPtr connection;
+        try
+        {
+            if(_instance->traceLevels()->network >= 2)
+            {
+                Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+                out << "trying to establish " << ci.endpoint->protocol() << " connection to "
+                    << ci.connector->toString();
+            }
+            connection = _factory->createConnection(ci.connector->connect(), ci);
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            if(_instance->traceLevels()->network >= 2)
+            {
+                Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+                out << "failed to establish " << ci.endpoint->protocol() << " connection to "
+                    << ci.connector->toString() << "\n" << ex;
+            }
+
+            if(observer)
+            {
+                observer->failed(ex.ice_id());
+                observer->detach();
+            }
+            parallelConnectFailed(ICE_NULLPTR, ex);
+            return; // parallelConnectFailed() starts the next attempt.
+        }
+
+        bool scheduleTimer = false;
+        {
+            IceUtil::Mutex::Lock sync(*this);
+            _attempts.push_back(ConnectAttempt(ci, connection, observer));
+
+            //
+            // Start the next attempt after the parallel connect delay if this attempt
+            // doesn't complete in the meantime.
+            //
+            if(!_done && !_timerScheduled && _iter != _connectors.end())
+            {
+                _timerScheduled = true;
+                scheduleTimer = true;
+            }
+        }
+
+        if(scheduleTimer)
+        {
+            try
+            {
+                _instance->timer()->schedule(ICE_SHARED_FROM_THIS, _factory->_parallelConnectDelay);
+            }
+            catch(const IceUtil::Exception&)
+            {
+                //
+                // The timer is destroyed if the communicator is being destroyed, the next
+                // connectors are only tried if this attempt fails.
+                //
+                IceUtil::Mutex::Lock sync(*this);
+                _timerScheduled = false;
+            }
+        }
+
+        connection->start(ICE_SHARED_FROM_THIS);
+        return;
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::parallelConnectCompleted(const ConnectionIPtr& connection)
+{
+    ConnectorInfo ci(ICE_NULLPTR, ICE_NULLPTR);
+    ObserverPtr observer;
+    vector<ConnectionIPtr> canceled;
+    bool cancelTimer = false;
+    bool first = false;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        for(vector<ConnectAttempt>::iterator p = _attempts.begin(); p != _attempts.end(); ++p)
+        {
+            if(p->connection == connection)
+            {
+                ci = p->connector;
+                observer = p->observer;
+                _attempts.erase(p);
+                break;
+            }
+        }
+        --_active;
+
+        if(!_done)
+        {
+            _done = true;
+            first = true;
+            cancelTimer = _timerScheduled;
+            _timerScheduled = false;
+            for(vector<ConnectAttempt>::const_iterator p = _attempts.begin(); p != _attempts.end(); ++p)
+            {
+                if(p->connection)
+                {
+                    canceled.push_back(p->connection);
+                }
+            }
+        }
+    }
+
+    if(observer)
+    {
+        observer->detach();
+    }
+
+    if(cancelTimer)
+    {
+        _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+    }
+
+    //
+    // Cancel the attempts still in progress, their connections are closed and they aren't
+    // used even if they complete concurrently with the first one.
+    //
+    for(vector<ConnectionIPtr>::const_iterator p = canceled.begin(); p != canceled.end(); ++p)
+    {
+        (*p)->close(ICE_SCOPED_ENUM(ConnectionClose, Forcefully));
+    }
+
+    connection->activate();
+    if(first)
+    {
+        _factory->finishGetConnection(_connectors, ci, connection, ICE_SHARED_FROM_THIS);
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::parallelConnectFailed(const ConnectionIPtr& connection,
+                                                                               const LocalException& ex)
+{
+    ObserverPtr observer;
+    bool canceled = false;
+    bool finished = false;
+    bool cancelTimer = false;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        if(connection)
+        {
+            for(vector<ConnectAttempt>::iterator p = _attempts.begin(); p != _attempts.end(); ++p)
+            {
+                if(p->connection == connection)
+                {
+                    observer = p->observer;
+                    _attempts.erase(p);
+                    break;
+                }
+            }
+        }
+        --_active;
+
+        if(_done)
+        {
+            canceled = true;
+        }
+        else if(dynamic_cast<const Ice::CommunicatorDestroyedException*>(&ex) ||
+                (_iter == _connectors.end() && _active == 0))
+        {
+            _done = true;
+            finished = true;
+            cancelTimer = _timerScheduled;
+            _timerScheduled = false;
+        }
+    }
+
+    if(observer)
+    {
+        if(!canceled)
+        {
+            observer->failed(ex.ice_id());
+        }
+        observer->detach();
+    }
+
+    if(canceled)
+    {
+        return; // The connection was established with another connector.
+    }
+
+    _factory->handleConnectionException(ex, _hasMore || !finished);
+    if(finished)
+    {
+        if(cancelTimer)
+        {
+            _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
+        }
+        _factory->finishGetConnection(_connectors, ex, ICE_SHARED_FROM_THIS);
+    }
+    else
+    {
+        nextParallelConnector();
+    }
+}
+
 void
 IceInternal::IncomingConnectionFactory::activate()
 {
@@ -12,6 +12,7 @@
 
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
+#include <IceUtil/Timer.h>
 #include <Ice/CommunicatorF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ConnectionI.h>
@@ -63,7 +64,8 @@ public:
 
     void waitUntilFinished();
 
-    void create(const std::vector<EndpointIPtr>&, bool, Ice::EndpointSelectionType, const CreateConnectionCallbackPtr&);
+    void create(const std::vector<EndpointIPtr>&, bool, Ice::EndpointSelectionType, int,
+                const CreateConnectionCallbackPtr&);
     void setRouterInfo(const RouterInfoPtr&);
     void removeAdapter(const Ice::ObjectAdapterPtr&);
     void flushAsyncBatchRequests(const CommunicatorFlushBatchAsyncPtr&, Ice::CompressBatch);
@@ -87,7 +89,9 @@ private:
     };
 
     class ConnectCallback : public Ice::ConnectionI::StartCallback,
-                            public IceInternal::EndpointI_connectors
+                            public IceInternal::EndpointI_connectors,
+                            public IceUtil::TimerTask,
+                            private IceUtil::Mutex
 #ifdef ICE_CPP11_MAPPING
                           , public std::enable_shared_from_this<ConnectCallback>
 #endif
@@ -96,7 +100,7 @@ private:
     public:
 
         ConnectCallback(const InstancePtr&, const OutgoingConnectionFactoryPtr&, const std::vector<EndpointIPtr>&, bool,
-                        const CreateConnectionCallbackPtr&, Ice::EndpointSelectionType);
+                        const CreateConnectionCallbackPtr&, Ice::EndpointSelectionType, int);
 
         virtual void connectionStartCompleted(const Ice::ConnectionIPtr&);
         virtual void connectionStartFailed(const Ice::ConnectionIPtr&, const Ice::LocalException&);
@@ -119,10 +123,32 @@ private:
 
         bool operator<(const ConnectCallback&) const;
 
+        virtual void runTimerTask();
+
     private:
 
         bool connectionStartFailedImpl(const Ice::LocalException&);
 
+        void nextParallelConnector();
+        void parallelConnectCompleted(const Ice::ConnectionIPtr&);
+        void parallelConnectFailed(const Ice::ConnectionIPtr&, const Ice::LocalException&);
+
+        //
+        // A connection attempt of the parallel connection establishment.
+        //
+        struct ConnectAttempt
+        {
+            ConnectAttempt(const ConnectorInfo& ci, const Ice::ConnectionIPtr& c,
+                           const Ice::Instrumentation::ObserverPtr& o) :
+                connector(ci), connection(c), observer(o)
+            {
+            }
+
+            ConnectorInfo connector;
+            Ice::ConnectionIPtr connection;
+            Ice::Instrumentation::ObserverPtr observer;
+        };
+
         const InstancePtr _instance;
         const OutgoingConnectionFactoryPtr _factory;
         const std::vector<EndpointIPtr> _endpoints;
@@ -133,6 +159,19 @@ private:
         std::vector<EndpointIPtr>::const_iterator _endpointsIter;
         std::vector<ConnectorInfo> _connectors;
         std::vector<ConnectorInfo>::const_iterator _iter;
+
+        //
+        // With parallel connection establishment, up to _parallelConnect connectors are tried
+        // concurrently. A new attempt is started when an attempt fails or when no attempt
+        // completed within the parallel connect delay. The first established connection is
+        // used and the other attempts are canceled.
+        //
+        const int _parallelConnect;
+        bool _parallel; // True if the connectors are tried in parallel.
+        bool _done; // True once the connection is established or all the attempts failed.
+        bool _timerScheduled;
+        int _active; // Number of attempts in progress.
+        std::vector<ConnectAttempt> _attempts;
     };
     ICE_DEFINE_PTR(ConnectCallbackPtr, ConnectCallback);
     friend class ConnectCallback;
@@ -169,6 +208,7 @@ private:
     std::multimap<EndpointIPtr, Ice::ConnectionIPtr> _connectionsByEndpoint;
 #endif
     int _pendingConnectCount;
+    const IceUtil::Time _parallelConnectDelay;
 };
 
 class IncomingConnectionFactory : public EventHandler,
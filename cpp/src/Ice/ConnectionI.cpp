@@ -27,10 +27,7 @@
 #include <Ice/ReferenceFactory.h> // For createProxy().
 #include <Ice/ProxyFactory.h> // For createProxy().
 #include <Ice/BatchRequestQueue.h>
-
-#ifdef ICE_HAS_BZIP2
-#  include <bzlib.h>
-#endif
+#include <Ice/Compressor.h>
 
 using namespace std;
 using namespace Ice;
@@ -73,7 +70,7 @@ public:
                  const vector<ConnectionI::OutgoingMessage>& sentCBs, Byte compress, Int requestId,
                  Int invokeNum, const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
                  const OutgoingAsyncBasePtr& outAsync, const ICE_HEARTBEAT_CALLBACK& heartbeatCallback,
-                 InputStream& stream) :
+                 InputStream& stream, const IceUtil::Time& received) :
         DispatchWorkItem(connection),
         _connection(connection),
         _startCB(startCB),
@@ -85,7 +82,8 @@ public:
         _adapter(adapter),
         _outAsync(outAsync),
         _heartbeatCallback(heartbeatCallback),
-        _stream(stream.instance(), currentProtocolEncoding)
+        _stream(stream.instance(), currentProtocolEncoding),
+        _received(received)
     {
         _stream.swap(stream);
     }
@@ -94,7 +92,7 @@ public:
     run()
     {
         _connection->dispatch(_startCB, _sentCBs, _compress, _requestId, _invokeNum, _servantManager, _adapter,
-                              _outAsync, _heartbeatCallback, _stream);
+                              _outAsync, _heartbeatCallback, _stream, _received);
     }
 
 private:
@@ -110,6 +108,7 @@ private:
     const OutgoingAsyncBasePtr _outAsync;
     const ICE_HEARTBEAT_CALLBACK _heartbeatCallback;
     InputStream _stream;
+    const IceUtil::Time _received;
 };
 
 class FinishCall : public DispatchWorkItem
@@ -195,6 +194,7 @@ ConnectionFlushBatchAsync::invoke(const string& operation, Ice::CompressBatch co
         }
         else
         {
+            _observer.batchRequests(batchRequestNum);
             if(compressBatch == ICE_SCOPED_ENUM(CompressBatch, Yes))
             {
                 compress = true;
@@ -339,9 +339,15 @@ Ice::ConnectionI::OutgoingMessage::canceled(bool adoptStream)
     {
         adopt(0); // Adopt the request stream
     }
-    else
+    else if(adopted)
     {
-        assert(!adopted);
+        //
+        // The message was prepared for sending with a compressed stream
+        // but not sent yet.
+        //
+        delete stream;
+        stream = 0;
+        adopted = false;
     }
 }
 
@@ -724,12 +730,7 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
         //
         // Create a new unique request ID.
         //
-        requestId = _nextRequestId++;
-        if(requestId <= 0)
-        {
-            _nextRequestId = 1;
-            requestId = _nextRequestId++;
-        }
+        requestId = _asyncRequests.allocate();
 
         //
         // Fill in the request ID.
@@ -769,10 +770,9 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     if(response)
     {
         //
-        // Add to the async requests map.
+        // Add to the async requests table.
         //
-        _asyncRequestsHint = _asyncRequests.insert(_asyncRequests.end(),
-                                                   pair<const Int, OutgoingAsyncBasePtr>(requestId, out));
+        _asyncRequests.add(requestId, out);
     }
     return status;
 }
@@ -783,6 +783,13 @@ Ice::ConnectionI::getBatchRequestQueue() const
     return _batchRequestQueue;
 }
 
+size_t
+Ice::ConnectionI::outstandingRequests() const
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+    return _asyncRequests.size() + _sendStreams.size();
+}
+
 #ifdef ICE_CPP11_MAPPING
 std::function<void()>
 Ice::ConnectionI::flushBatchRequestsAsync(CompressBatch compress,
@@ -940,7 +947,7 @@ public:
             _os.write(currentProtocol);
             _os.write(currentProtocolEncoding);
             _os.write(validateConnectionMsg);
-            _os.write(static_cast<Byte>(0)); // Compression status (always zero for validate connection).
+            _os.write(static_cast<Byte>(0)); // Compression status (always zero for heartbeats).
             _os.write(headerSize); // Message size.
             _os.i = _os.b.begin();
 
@@ -1200,16 +1207,7 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
         {
             if(o->requestId)
             {
-                if(_asyncRequestsHint != _asyncRequests.end() &&
-                   _asyncRequestsHint->second == ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
-                {
-                    _asyncRequests.erase(_asyncRequestsHint);
-                    _asyncRequestsHint = _asyncRequests.end();
-                }
-                else
-                {
-                    _asyncRequests.erase(o->requestId);
-                }
+                _asyncRequests.remove(o->requestId);
             }
 
             if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
@@ -1220,9 +1218,16 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
             {
                 //
                 // If the request is being sent, don't remove it from the send streams,
-                // it will be removed once the sending is finished.
+                // it will be removed once the sending is finished. A queued request is
+                // also being sent if it was partially written with the previous message
+                // or if it was passed to a gathered write which didn't complete: the
+                // transceiver might have copied it to send it with the previous message.
                 //
-                if(o == _sendStreams.begin())
+                bool sending = o == _sendStreams.begin() || (o->stream->i && o->stream->i != o->stream->b.begin());
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+                sending = sending || static_cast<size_t>(o - _sendStreams.begin()) < _writeGathered;
+#endif
+                if(sending)
                 {
                     o->canceled(true); // true = adopt the stream
                 }
@@ -1242,45 +1247,20 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, con
 
     if(ICE_DYNAMIC_CAST(OutgoingAsync, outAsync))
     {
-        if(_asyncRequestsHint != _asyncRequests.end())
+        Int requestId = _asyncRequests.find(outAsync);
+        if(requestId)
         {
-            if(_asyncRequestsHint->second == outAsync)
+            if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
             {
-                if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
-                {
-                    setState(StateClosed, ex);
-                }
-                else
-                {
-                    _asyncRequests.erase(_asyncRequestsHint);
-                    _asyncRequestsHint = _asyncRequests.end();
-                    if(outAsync->exception(ex))
-                    {
-                        outAsync->invokeExceptionAsync();
-                    }
-                }
-                return;
+                setState(StateClosed, ex);
             }
-        }
-
-        for(map<Int, OutgoingAsyncBasePtr>::iterator p = _asyncRequests.begin(); p != _asyncRequests.end(); ++p)
-        {
-            if(p->second.get() == outAsync.get())
+            else
             {
-                if(dynamic_cast<const Ice::ConnectionTimeoutException*>(&ex))
-                {
-                    setState(StateClosed, ex);
-                }
-                else
+                _asyncRequests.remove(requestId);
+                if(outAsync->exception(ex))
                 {
-                    assert(p != _asyncRequestsHint);
-                    _asyncRequests.erase(p);
-                    if(outAsync->exception(ex))
-                    {
-                        outAsync->invokeExceptionAsync();
-                    }
+                    outAsync->invokeExceptionAsync();
                 }
-                return;
             }
         }
     }
@@ -1600,7 +1580,7 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 {
                     _observer.startWrite(_writeStream);
                 }
-                writeOp = write(_writeStream);
+                writeOp = writeMessages();
                 if(_observer && !(writeOp & SocketOperationWrite))
                 {
                     _observer.finishWrite(_writeStream);
@@ -1614,7 +1594,13 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                     _observer.startRead(_readStream);
                 }
 
-                readOp = read(_readStream);
+                //
+                // Keep the write interest reported while reading the message header, the
+                // transceiver might have read control data which requires a write when
+                // reading ahead.
+                //
+                SocketOperation op = _state > StateNotValidated ? readBuffered(_readStream) : read(_readStream);
+                readOp = static_cast<SocketOperation>(op | (readOp & SocketOperationWrite));
                 if(readOp & SocketOperationRead)
                 {
                     break;
@@ -1691,6 +1677,11 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 break;
             }
 
+            if(readyOp & SocketOperationRead && _state > StateNotValidated)
+            {
+                checkReadAhead();
+            }
+
             SocketOperation newOp = static_cast<SocketOperation>(readOp | writeOp);
             readyOp = static_cast<SocketOperation>(readyOp & ~newOp);
             assert(readyOp || newOp);
@@ -1821,16 +1812,29 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
         }
     }
 
-    if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
+    //
+    // Optimization, call dispatch() directly if there's no dispatcher and the thread pool
+    // doesn't have dispatch threads.
+    //
+    if(!_dispatcher && !current.hasDispatchThreads())
     {
         dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync, heartbeatCallback,
-                 current.stream);
+                 current.stream, IceUtil::Time());
     }
     else
     {
-        _threadPool->dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
-                                                             invokeNum, servantManager, adapter, outAsync,
-                                                             heartbeatCallback, current.stream));
+        //
+        // Remember when the requests were received, the time they wait
+        // for the dispatch counts against their deadline.
+        //
+        IceUtil::Time received;
+        if(invokeNum > 0)
+        {
+            received = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        }
+        current.dispatchFromThisThread(new DispatchCall(ICE_SHARED_FROM_THIS, startCB, sentCBs, compress, requestId,
+                                                        invokeNum, servantManager, adapter, outAsync,
+                                                        heartbeatCallback, current.stream, received));
 
     }
 }
@@ -1839,7 +1843,8 @@ void
 ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMessage>& sentCBs,
                       Byte compress, Int requestId, Int invokeNum, const ServantManagerPtr& servantManager,
                       const ObjectAdapterPtr& adapter, const OutgoingAsyncBasePtr& outAsync,
-                      const ICE_HEARTBEAT_CALLBACK& heartbeatCallback, InputStream& stream)
+                      const ICE_HEARTBEAT_CALLBACK& heartbeatCallback, InputStream& stream,
+                      const IceUtil::Time& received)
 {
     int dispatchedCount = 0;
 
@@ -1920,7 +1925,7 @@ ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMess
     //
     if(invokeNum)
     {
-        invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter);
+        invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter, received);
 
         //
         // Don't increase count, the dispatch count is
@@ -1984,13 +1989,13 @@ Ice::ConnectionI::finished(ThreadPoolCurrent& current, bool close)
     }
 
     current.ioCompleted();
-    if(!_dispatcher) // Optimization, call finish() directly if there's no dispatcher.
+    if(!_dispatcher && !current.hasDispatchThreads()) // Optimization, call finish() directly.
     {
         finish(close);
     }
     else
     {
-        _threadPool->dispatchFromThisThread(new FinishCall(ICE_SHARED_FROM_THIS, close));
+        current.dispatchFromThisThread(new FinishCall(ICE_SHARED_FROM_THIS, close));
     }
 }
 
@@ -2089,23 +2094,26 @@ Ice::ConnectionI::finish(bool close)
             o->completed(*_exception);
             if(o->requestId) // Make sure finished isn't called twice.
             {
-                _asyncRequests.erase(o->requestId);
+                _asyncRequests.remove(o->requestId);
             }
         }
 
         _sendStreams.clear();
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        _writeGathered = 0;
+#endif
     }
 
-    for(map<Int, OutgoingAsyncBasePtr>::const_iterator q = _asyncRequests.begin(); q != _asyncRequests.end(); ++q)
+    vector<OutgoingAsyncBasePtr> asyncRequests;
+    _asyncRequests.clear(asyncRequests);
+    for(vector<OutgoingAsyncBasePtr>::const_iterator q = asyncRequests.begin(); q != asyncRequests.end(); ++q)
     {
-        if(q->second->exception(*_exception))
+        if((*q)->exception(*_exception))
         {
-            q->second->invokeException();
+            (*q)->invokeException();
         }
     }
 
-    _asyncRequests.clear();
-
     //
     // Don't wait to be reaped to reclaim memory allocated by read/write streams.
     //
@@ -2113,6 +2121,10 @@ Ice::ConnectionI::finish(bool close)
     _writeStream.b.clear();
     _readStream.clear();
     _readStream.b.clear();
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _readAhead.b.clear();
+    _readAhead.i = _readAheadPos = _readAhead.b.begin();
+#endif
 
     if(_closeCallback)
     {
@@ -2235,13 +2247,22 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _readTimeoutScheduled(false),
     _warn(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Connections") > 0),
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
-    _compressionLevel(1),
-    _nextRequestId(1),
-    _asyncRequestsHint(_asyncRequests.end()),
+    _compressorManager(_instance->compressorManager()),
+    _compressor(_compressorManager->get(CompressionCodecBZip2)), // Until negotiated with the peer.
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
     _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _writeCoalesceCount(_instance->writeCoalesceCount()),
+    _writeCoalesceSize(_instance->writeCoalesceSize()),
+    _writeGathered(0),
+#endif
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _readAheadSize(endpoint->datagram() ? 0 : _instance->readAheadSize()),
+    _readAheadPos(_readAhead.b.begin()),
+    _readAheadDrained(true),
+#endif
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
     _dispatchCount(0),
     _state(StateNotInitialized),
@@ -2249,23 +2270,22 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _initialized(false),
     _validated(false)
 {
-    const Ice::PropertiesPtr& properties = _instance->initializationData().properties;
-
-    int& compressionLevel = const_cast<int&>(_compressionLevel);
-    compressionLevel = properties->getPropertyAsIntWithDefault("Ice.Compression.Level", 1);
-    if(compressionLevel < 1)
-    {
-        compressionLevel = 1;
-    }
-    else if(compressionLevel > 9)
+    if(adapter)
     {
-        compressionLevel = 9;
+        _servantManager = adapter->getServantManager();
     }
 
-    if(adapter)
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    //
+    // Like the read and write streams, the read-ahead buffer is allocated
+    // from the buffer pool and returned to it when the connection is
+    // finished.
+    //
+    if(_instance->bufferPool())
     {
-        _servantManager = adapter->getServantManager();
+        _readAhead.b.setPool(_instance->bufferPool());
     }
+#endif
 
     if(_monitor && _monitor->getACM().timeout > 0)
     {
@@ -2603,7 +2623,7 @@ Ice::ConnectionI::sendHeartbeatNow()
         os.write(currentProtocol);
         os.write(currentProtocolEncoding);
         os.write(validateConnectionMsg);
-        os.write(static_cast<Byte>(0)); // Compression status (always zero for validate connection).
+        os.write(static_cast<Byte>(0)); // Compression status (always zero for heartbeats).
         os.write(headerSize); // Message size.
         os.i = os.b.begin();
         try
@@ -2655,7 +2675,7 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 _writeStream.write(currentProtocol);
                 _writeStream.write(currentProtocolEncoding);
                 _writeStream.write(validateConnectionMsg);
-                _writeStream.write(static_cast<Byte>(0)); // Compression status (always zero for validate connection).
+                _writeStream.write(_compressorManager->advertise()); // Compression status: the supported codecs.
                 _writeStream.write(headerSize); // Message size.
                 _writeStream.i = _writeStream.b.begin();
                 traceSend(_writeStream, _logger, _traceLevels);
@@ -2737,7 +2757,8 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 throw ConnectionNotValidatedException(__FILE__, __LINE__);
             }
             Byte compress;
-            _readStream.read(compress); // Ignore compression status for validate connection.
+            _readStream.read(compress); // Compression status: the codecs supported by the server.
+            _compressor = _compressorManager->negotiate(compress);
             Int size;
             _readStream.read(size);
             if(size != headerSize)
@@ -2808,6 +2829,12 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
                 }
             }
             _sendStreams.pop_front();
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+            if(_writeGathered > 0)
+            {
+                --_writeGathered;
+            }
+#endif
 
             //
             // If there's nothing left to send, we're done.
@@ -2830,56 +2857,15 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             }
 
             //
-            // Otherwise, prepare the next message stream for writing.
+            // Otherwise, prepare the next message stream for writing. The
+            // message might already be prepared and partially or fully sent
+            // if it was written along with the previous message.
             //
             message = &_sendStreams.front();
-            assert(!message->stream->i);
-#ifdef ICE_HAS_BZIP2
-            if(message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
+            if(!message->stream->i)
             {
-                //
-                // Message compressed. Request compressed response, if any.
-                //
-                message->stream->b[9] = 2;
-
-                //
-                // Do compression.
-                //
-                OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-                doCompress(*message->stream, stream);
-
-                traceSend(*message->stream, _logger, _traceLevels);
-
-                message->adopt(&stream); // Adopt the compressed stream.
-                message->stream->i = message->stream->b.begin();
-            }
-            else
-            {
-#endif
-                if(message->compress)
-                {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = 1;
-                }
-
-                //
-                // No compression, just fill in the message size.
-                //
-                Int sz = static_cast<Int>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
-#ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#else
-                copy(p, p + sizeof(Int), message->stream->b.begin() + 10);
-#endif
-                message->stream->i = message->stream->b.begin();
-                traceSend(*message->stream, _logger, _traceLevels);
-
-#ifdef ICE_HAS_BZIP2
+                prepareMessage(*message);
             }
-#endif
             _writeStream.swap(*message->stream);
 
             //
@@ -2892,7 +2878,7 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             assert(_writeStream.i);
             if(_writeStream.i != _writeStream.b.end())
             {
-                SocketOperation op = write(_writeStream);
+                SocketOperation op = writeMessages();
                 if(op)
                 {
                     return op;
@@ -2946,13 +2932,12 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
     message.stream->i = message.stream->b.begin();
     SocketOperation op;
-#ifdef ICE_HAS_BZIP2
-    if(message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
+    if(message.compress && _compressor && message.stream->b.size() >= _compressorManager->minSize())
     {
         //
         // Message compressed. Request compressed response, if any.
         //
-        message.stream->b[9] = 2;
+        message.stream->b[9] = static_cast<Byte>(_compressor->codec() << 4 | 2);
 
         //
         // Do compression.
@@ -2995,13 +2980,12 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     }
     else
     {
-#endif
         if(message.compress)
         {
             //
             // Message not compressed. Request compressed response, if any.
             //
-            message.stream->b[9] = 1;
+            message.stream->b[9] = static_cast<Byte>((_compressor ? _compressor->codec() << 4 : 0) | 1);
         }
 
         //
@@ -3046,9 +3030,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
         _sendStreams.push_back(message);
         _sendStreams.back().adopt(0); // Adopt the stream.
-#ifdef ICE_HAS_BZIP2
     }
-#endif
 
     _writeStream.swap(*_sendStreams.back().stream);
     scheduleTimeout(op);
@@ -3056,65 +3038,50 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     return AsyncStatusQueued;
 }
 
-#ifdef ICE_HAS_BZIP2
-static string
-getBZ2Error(int bzError)
+void
+Ice::ConnectionI::prepareMessage(OutgoingMessage& message)
 {
-    if(bzError == BZ_RUN_OK)
-    {
-        return ": BZ_RUN_OK";
-    }
-    else if(bzError == BZ_FLUSH_OK)
-    {
-        return ": BZ_FLUSH_OK";
-    }
-    else if(bzError == BZ_FINISH_OK)
-    {
-        return ": BZ_FINISH_OK";
-    }
-    else if(bzError == BZ_STREAM_END)
-    {
-        return ": BZ_STREAM_END";
-    }
-    else if(bzError == BZ_CONFIG_ERROR)
-    {
-        return ": BZ_CONFIG_ERROR";
-    }
-    else if(bzError == BZ_SEQUENCE_ERROR)
-    {
-        return ": BZ_SEQUENCE_ERROR";
-    }
-    else if(bzError == BZ_PARAM_ERROR)
-    {
-        return ": BZ_PARAM_ERROR";
-    }
-    else if(bzError == BZ_MEM_ERROR)
-    {
-        return ": BZ_MEM_ERROR";
-    }
-    else if(bzError == BZ_DATA_ERROR)
-    {
-        return ": BZ_DATA_ERROR";
-    }
-    else if(bzError == BZ_DATA_ERROR_MAGIC)
-    {
-        return ": BZ_DATA_ERROR_MAGIC";
-    }
-    else if(bzError == BZ_IO_ERROR)
-    {
-        return ": BZ_IO_ERROR";
-    }
-    else if(bzError == BZ_UNEXPECTED_EOF)
+    assert(!message.stream->i);
+    if(message.compress && _compressor && message.stream->b.size() >= _compressorManager->minSize())
     {
-        return ": BZ_UNEXPECTED_EOF";
-    }
-    else if(bzError == BZ_OUTBUFF_FULL)
-    {
-        return ": BZ_OUTBUFF_FULL";
+        //
+        // Message compressed. Request compressed response, if any.
+        //
+        message.stream->b[9] = static_cast<Byte>(_compressor->codec() << 4 | 2);
+
+        //
+        // Do compression.
+        //
+        OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
+        doCompress(*message.stream, stream);
+
+        traceSend(*message.stream, _logger, _traceLevels);
+
+        message.adopt(&stream); // Adopt the compressed stream.
+        message.stream->i = message.stream->b.begin();
     }
     else
     {
-        return "";
+        if(message.compress)
+        {
+            //
+            // Message not compressed. Request compressed response, if any.
+            //
+            message.stream->b[9] = static_cast<Byte>((_compressor ? _compressor->codec() << 4 : 0) | 1);
+        }
+
+        //
+        // No compression, just fill in the message size.
+        //
+        Int sz = static_cast<Int>(message.stream->b.size());
+        const Byte* p = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+        reverse_copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#else
+        copy(p, p + sizeof(Int), message.stream->b.begin() + 10);
+#endif
+        message.stream->i = message.stream->b.begin();
+        traceSend(*message.stream, _logger, _traceLevels);
     }
 }
 
@@ -3126,20 +3093,11 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
     //
     // Compress the message body, but not the header.
     //
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
-    compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                           &compressedLen,
-                                           reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                           uncompressedLen,
-                                           _compressionLevel, 0, 0);
-    if(bzError != BZ_OK)
-    {
-        CompressionException ex(__FILE__, __LINE__);
-        ex.reason = "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError);
-        throw ex;
-    }
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    compressed.b.resize(headerSize + sizeof(Int) + _compressor->compressBound(uncompressedLen));
+    size_t compressedLen = _compressor->compress(&uncompressed.b[0] + headerSize, uncompressedLen,
+                                                 &compressed.b[0] + headerSize + sizeof(Int),
+                                                 compressed.b.size() - headerSize - sizeof(Int));
     compressed.b.resize(headerSize + sizeof(Int) + compressedLen);
 
     //
@@ -3174,7 +3132,7 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
 }
 
 void
-Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompressed)
+Ice::ConnectionI::doUncompress(const CompressorPtr& compressor, InputStream& compressed, InputStream& uncompressed)
 {
     Int uncompressedSize;
     compressed.i = compressed.b.begin() + headerSize;
@@ -3190,23 +3148,11 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
     }
     uncompressed.resize(uncompressedSize);
 
-    unsigned int uncompressedLen = uncompressedSize - headerSize;
-    unsigned int compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(Int));
-    int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                             &uncompressedLen,
-                                             reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(Int),
-                                             compressedLen,
-                                             0, 0);
-    if(bzError != BZ_OK)
-    {
-        CompressionException ex(__FILE__, __LINE__);
-        ex.reason = "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError);
-        throw ex;
-    }
+    compressor->uncompress(&compressed.b[0] + headerSize + sizeof(Int), compressed.b.size() - headerSize - sizeof(Int),
+                           &uncompressed.b[0] + headerSize, uncompressedSize - headerSize);
 
     copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
 }
-#endif
 
 SocketOperation
 Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& requestId, Byte& compress,
@@ -3244,17 +3190,31 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
         stream.read(messageType);
         stream.read(compress);
 
-        if(compress == 2)
+        if(compress & 0x0f)
         {
-#ifdef ICE_HAS_BZIP2
-            InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
-            doUncompress(stream, ustream);
-            stream.b.swap(ustream.b);
-#else
-            FeatureNotSupportedException ex(__FILE__, __LINE__);
-            ex.unsupportedFeature = "Cannot uncompress compressed message";
-            throw ex;
-#endif
+            //
+            // The peer supports compression, the upper 4 bits of the compression status is the
+            // codec used to compress this message or, if not compressed, the codec to use for
+            // compressing the response.
+            //
+            CompressorPtr compressor = _compressorManager->get(static_cast<Byte>(compress >> 4));
+            if((compress & 0x0f) == 2)
+            {
+                if(!compressor)
+                {
+                    FeatureNotSupportedException ex(__FILE__, __LINE__);
+                    ex.unsupportedFeature = "Cannot uncompress compressed message (" +
+                        codecName(static_cast<Byte>(compress >> 4)) + " compression)";
+                    throw ex;
+                }
+                InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
+                doUncompress(compressor, stream, ustream);
+                stream.b.swap(ustream.b);
+            }
+            if(compressor)
+            {
+                _compressor = compressor;
+            }
         }
         stream.i = stream.b.begin() + headerSize;
 
@@ -3336,35 +3296,9 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
 
                 stream.read(requestId);
 
-                map<Int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.end();
-
-                if(_asyncRequestsHint != _asyncRequests.end())
+                outAsync = _asyncRequests.remove(requestId);
+                if(outAsync)
                 {
-                    if(_asyncRequestsHint->first == requestId)
-                    {
-                        q = _asyncRequestsHint;
-                    }
-                }
-
-                if(q == _asyncRequests.end())
-                {
-                    q = _asyncRequests.find(requestId);
-                }
-
-                if(q != _asyncRequests.end())
-                {
-                    outAsync = q->second;
-
-                    if(q == _asyncRequestsHint)
-                    {
-                        _asyncRequests.erase(q++);
-                        _asyncRequestsHint = q;
-                    }
-                    else
-                    {
-                        _asyncRequests.erase(q);
-                    }
-
                     stream.swap(*outAsync->getIs());
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
@@ -3442,7 +3376,8 @@ Ice::ConnectionI::parseMessage(InputStream& stream, Int& invokeNum, Int& request
 
 void
 Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, Byte compress,
-                            const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter)
+                            const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                            const IceUtil::Time& received)
 {
     //
     // Note: In contrast to other private or protected methods, this
@@ -3464,7 +3399,7 @@ Ice::ConnectionI::invokeAll(InputStream& stream, Int invokeNum, Int requestId, B
             //
             // Dispatch the invocation.
             //
-            in.invoke(servantManager, &stream);
+            in.invoke(servantManager, &stream, received);
 
             --invokeNum;
         }
@@ -3618,6 +3553,123 @@ ConnectionI::read(Buffer& buf)
     return op;
 }
 
+SocketOperation
+ConnectionI::readBuffered(Buffer& buf)
+{
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(_readAheadSize > 0)
+    {
+        //
+        // Read as much data as available in the read-ahead buffer and
+        // fill the given buffer from it. Data which doesn't fit in the
+        // given buffer is kept for the next messages. Large messages are
+        // read directly in the given buffer once the read-ahead buffer
+        // is empty.
+        //
+        SocketOperation op = SocketOperationNone;
+        while(true)
+        {
+            if(_readAheadPos != _readAhead.i)
+            {
+                size_t size = min(static_cast<size_t>(_readAhead.i - _readAheadPos),
+                                  static_cast<size_t>(buf.b.end() - buf.i));
+                memcpy(buf.i, _readAheadPos, size);
+                buf.i += size;
+                _readAheadPos += size;
+            }
+
+            if(buf.i == buf.b.end())
+            {
+                return static_cast<SocketOperation>(op & ~SocketOperationRead);
+            }
+            else if(op & SocketOperationRead)
+            {
+                return op;
+            }
+
+            assert(_readAheadPos == _readAhead.i);
+            if(_readAheadException.get())
+            {
+                _readAheadException->ice_throw();
+            }
+
+            if(static_cast<size_t>(buf.b.end() - buf.i) >= _readAheadSize)
+            {
+                SocketOperation s = read(buf);
+                _readAheadDrained = (s & SocketOperationRead) != 0;
+                return static_cast<SocketOperation>(op | s);
+            }
+
+            if(_readAhead.b.empty())
+            {
+                _readAhead.b.resize(_readAheadSize);
+            }
+            _readAhead.i = _readAheadPos = _readAhead.b.begin();
+            SocketOperation s;
+            try
+            {
+                s = read(_readAhead);
+            }
+            catch(const LocalException& ex)
+            {
+                if(_readAhead.i == _readAheadPos)
+                {
+                    throw;
+                }
+
+                //
+                // The transceiver failed after reading some data, the
+                // failure is raised once the messages read before are
+                // processed.
+                //
+                ICE_SET_EXCEPTION_FROM_CLONE(_readAheadException, ex.ice_clone());
+                s = SocketOperationNone;
+            }
+            _readAheadDrained = (s & SocketOperationRead) != 0;
+            op = static_cast<SocketOperation>(op | s);
+        }
+    }
+#endif
+    return read(buf);
+}
+
+void
+ConnectionI::checkReadAhead()
+{
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(_readAheadSize == 0)
+    {
+        return;
+    }
+
+    //
+    // If the read-ahead buffer contains a complete message or if the
+    // transceiver might still have data to read, mark the connection
+    // as ready for reading to process the buffered data without
+    // waiting for the selector. Otherwise, we wait for the selector
+    // to report more data.
+    //
+    size_t available = static_cast<size_t>(_readAhead.i - _readAheadPos);
+    bool ready = (available > 0 && !_readAheadDrained) || _readAheadException.get();
+    if(available >= static_cast<size_t>(headerSize) && _readAheadDrained)
+    {
+        Int size;
+        Byte* p = reinterpret_cast<Byte*>(&size);
+#ifdef ICE_BIG_ENDIAN
+        reverse_copy(_readAheadPos + 10, _readAheadPos + 10 + sizeof(Int), p);
+#else
+        copy(_readAheadPos + 10, _readAheadPos + 10 + sizeof(Int), p);
+#endif
+        ready = available >= static_cast<size_t>(size);
+    }
+
+    if(ready || _readAheadDrained)
+    {
+        _threadPool->ready(ICE_SHARED_FROM_THIS, SocketOperationRead, ready);
+    }
+#endif
+}
+
 SocketOperation
 ConnectionI::write(Buffer& buf)
 {
@@ -3636,6 +3688,73 @@ ConnectionI::write(Buffer& buf)
     return op;
 }
 
+SocketOperation
+ConnectionI::writeMessages()
+{
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    //
+    // Gather the messages queued after the message being sent to write
+    // them with a single transceiver call. The queued messages are
+    // prepared for sending if this wasn't already done by a previous
+    // call. The number and size of the messages written at once are
+    // bounded by Ice.WriteCoalesceCount and Ice.WriteCoalesceSize.
+    //
+    if(_writeCoalesceCount > 1 && _sendStreams.size() > 1 && _state < StateClosingPending)
+    {
+        size_t size = static_cast<size_t>(_writeStream.b.end() - _writeStream.i);
+        _writeBuffers.clear();
+        _writeBuffers.push_back(&_writeStream);
+        for(deque<OutgoingMessage>::iterator p = _sendStreams.begin() + 1;
+            p != _sendStreams.end() && _writeBuffers.size() < _writeCoalesceCount && size < _writeCoalesceSize; ++p)
+        {
+            if(!p->stream->i)
+            {
+                prepareMessage(*p);
+            }
+            _writeBuffers.push_back(p->stream);
+            size += static_cast<size_t>(p->stream->b.end() - p->stream->i);
+        }
+
+        if(_writeBuffers.size() > 1)
+        {
+            Buffer::Container::iterator start = _writeStream.i;
+            SocketOperation op = _transceiver->writeBuffers(_writeBuffers);
+            _writeGathered = op ? _writeBuffers.size() : 0;
+
+            size_t remaining = 0;
+            for(vector<Buffer*>::const_iterator p = _writeBuffers.begin(); p != _writeBuffers.end(); ++p)
+            {
+                remaining += static_cast<size_t>((*p)->b.end() - (*p)->i);
+            }
+            _writeBuffers.clear();
+
+            size_t sent = size - remaining;
+            if(sent > 0)
+            {
+                //
+                // The bytes of the message being sent are reported by the
+                // caller, we report the bytes of the following messages.
+                //
+                size_t queued = sent - static_cast<size_t>(_writeStream.i - start);
+                if(_observer && queued > 0)
+                {
+                    _observer->sentBytes(static_cast<int>(queued));
+                }
+
+                if(_instance->traceLevels()->network >= 3)
+                {
+                    Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+                    out << "sent " << sent << " of " << size << " bytes via " << _endpoint->protocol() << "\n"
+                        << toString();
+                }
+            }
+            return op;
+        }
+    }
+#endif
+    return write(_writeStream);
+}
+
 void
 ConnectionI::reap()
 {
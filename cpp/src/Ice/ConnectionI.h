@@ -37,18 +37,14 @@
 #include <Ice/ObserverHelper.h>
 #include <Ice/ConnectionAsync.h>
 #include <Ice/BatchRequestQueueF.h>
+#include <Ice/CompressorF.h>
+#include <Ice/RequestTable.h>
 #include <Ice/ACM.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
 
 #include <deque>
 
-#if !defined(ICE_OS_UWP)
-#    ifndef ICE_HAS_BZIP2
-#        define ICE_HAS_BZIP2
-#    endif
-#endif
-
 namespace Ice
 {
 
@@ -175,6 +171,8 @@ public:
 
     IceInternal::BatchRequestQueuePtr getBatchRequestQueue() const;
 
+    size_t outstandingRequests() const; // Pending replies and queued messages, used by connection pools.
+
 
 #ifdef ICE_CPP11_MAPPING
     virtual std::function<void()>
@@ -254,7 +252,7 @@ public:
     void dispatch(const StartCallbackPtr&, const std::vector<OutgoingMessage>&, Byte, Int, Int,
                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&,
                   const IceInternal::OutgoingAsyncBasePtr&,
-                  const ICE_HEARTBEAT_CALLBACK&, Ice::InputStream&);
+                  const ICE_HEARTBEAT_CALLBACK&, Ice::InputStream&, const IceUtil::Time&);
     void finish(bool);
 
     void closeCallback(const ICE_CLOSE_CALLBACK&);
@@ -297,18 +295,17 @@ private:
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     IceInternal::SocketOperation sendNextMessage(std::vector<OutgoingMessage>&);
     IceInternal::AsyncStatus sendMessage(OutgoingMessage&);
+    void prepareMessage(OutgoingMessage&);
 
-#ifdef ICE_HAS_BZIP2
     void doCompress(Ice::OutputStream&, Ice::OutputStream&);
-    void doUncompress(Ice::InputStream&, Ice::InputStream&);
-#endif
+    void doUncompress(const IceInternal::CompressorPtr&, Ice::InputStream&, Ice::InputStream&);
 
     IceInternal::SocketOperation parseMessage(Ice::InputStream&, Int&, Int&, Byte&,
                                               IceInternal::ServantManagerPtr&, ObjectAdapterPtr&,
                                               IceInternal::OutgoingAsyncBasePtr&, ICE_HEARTBEAT_CALLBACK&, int&);
 
     void invokeAll(Ice::InputStream&, Int, Int, Byte,
-                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&);
+                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&, const IceUtil::Time&);
 
     void scheduleTimeout(IceInternal::SocketOperation status);
     void unscheduleTimeout(IceInternal::SocketOperation status);
@@ -317,7 +314,10 @@ private:
     Ice::Instrumentation::ConnectionState toConnectionState(State) const;
 
     IceInternal::SocketOperation read(IceInternal::Buffer&);
+    IceInternal::SocketOperation readBuffered(IceInternal::Buffer&);
+    void checkReadAhead();
     IceInternal::SocketOperation write(IceInternal::Buffer&);
+    IceInternal::SocketOperation writeMessages();
 
     void reap();
 
@@ -360,12 +360,10 @@ private:
 
     IceUtil::Time _acmLastActivity;
 
-    const int _compressionLevel;
+    const IceInternal::CompressorManagerPtr _compressorManager;
+    IceInternal::CompressorPtr _compressor; // The compressor used to send messages, negotiated with the peer.
 
-    Int _nextRequestId;
-
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr> _asyncRequests;
-    std::map<Int, IceInternal::OutgoingAsyncBasePtr>::iterator _asyncRequestsHint;
+    IceInternal::RequestTable _asyncRequests;
 
     IceInternal::UniquePtr<LocalException> _exception;
 
@@ -373,9 +371,22 @@ private:
     IceInternal::BatchRequestQueuePtr _batchRequestQueue;
 
     std::deque<OutgoingMessage> _sendStreams;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    const size_t _writeCoalesceCount;
+    const size_t _writeCoalesceSize;
+    std::vector<IceInternal::Buffer*> _writeBuffers;
+    size_t _writeGathered; // The messages passed to the last gathered write which didn't complete
+#endif
 
     Ice::InputStream _readStream;
     bool _readHeader;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    const size_t _readAheadSize;
+    IceInternal::Buffer _readAhead;
+    IceInternal::Buffer::Container::iterator _readAheadPos;
+    bool _readAheadDrained;
+    IceInternal::UniquePtr<LocalException> _readAheadException;
+#endif
     Ice::OutputStream _writeStream;
 
     Observer _observer;
@@ -0,0 +1,145 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/ConnectionPoolRequestHandler.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/OutgoingAsync.h>
+
+using namespace std;
+using namespace IceInternal;
+
+ConnectionPoolRequestHandler::ConnectionPoolRequestHandler(const ReferencePtr& reference,
+                                                           const vector<RequestHandlerPtr>& handlers,
+                                                           bool leastOutstanding) :
+    RequestHandler(reference),
+    _handlers(handlers),
+    _leastOutstanding(leastOutstanding),
+    _next(0)
+{
+    assert(!_handlers.empty());
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::update(const RequestHandlerPtr& previousHandler, const RequestHandlerPtr& newHandler)
+{
+    if(previousHandler.get() == this)
+    {
+        return newHandler;
+    }
+
+    //
+    // The connect request handler of a pool connection is replaced by
+    // the connection request handler once the connection is established.
+    //
+    Lock sync(*this);
+    for(vector<RequestHandlerPtr>::iterator p = _handlers.begin(); p != _handlers.end(); ++p)
+    {
+        if(p->get() == previousHandler.get())
+        {
+            *p = newHandler;
+        }
+    }
+    return ICE_SHARED_FROM_THIS;
+}
+
+AsyncStatus
+ConnectionPoolRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
+{
+    return getRequestHandler()->sendAsyncRequest(out);
+}
+
+void
+ConnectionPoolRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&)
+{
+    //
+    // Requests are registered for cancellation with the request handler
+    // or the connection of the pool which sent them, not with the pool.
+    //
+    assert(false);
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::getConnection()
+{
+    RequestHandlerPtr handler;
+    {
+        Lock sync(*this);
+        handler = _handlers.front();
+    }
+    return handler->getConnection();
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::waitForConnection()
+{
+    return getRequestHandler()->waitForConnection();
+}
+
+RequestHandlerPtr
+ConnectionPoolRequestHandler::getRequestHandler()
+{
+    vector<RequestHandlerPtr> handlers;
+    size_t start;
+    {
+        Lock sync(*this);
+        if(!_leastOutstanding)
+        {
+            return _handlers[_next++ % _handlers.size()];
+        }
+        handlers = _handlers;
+        start = _next++;
+    }
+
+    //
+    // Pick the established connection with the fewest outstanding
+    // requests, starting with a different connection each time to
+    // spread requests over idle connections. The connection mutexes
+    // are locked to get the number of requests so this is done without
+    // holding the pool mutex.
+    //
+    size_t best = handlers.size();
+    size_t least = 0;
+    for(size_t n = 0; n < handlers.size(); ++n)
+    {
+        size_t i = (start + n) % handlers.size();
+        Ice::ConnectionIPtr connection;
+        try
+        {
+            connection = handlers[i]->getConnection();
+        }
+        catch(const Ice::LocalException&)
+        {
+            continue; // The connection establishment failed.
+        }
+
+        if(connection) // Null if the connection isn't established yet.
+        {
+            size_t outstanding = connection->outstandingRequests();
+            if(best == handlers.size() || outstanding < least)
+            {
+                best = i;
+                least = outstanding;
+                if(least == 0)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    if(best == handlers.size())
+    {
+        //
+        // No connections are established yet, queue the request with
+        // the connect request handlers in turn.
+        //
+        best = start % handlers.size();
+    }
+    return handlers[best];
+}
@@ -0,0 +1,58 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+#define ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+
+#include <IceUtil/Mutex.h>
+#include <Ice/RequestHandler.h>
+#include <Ice/ReferenceF.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The request handler of a proxy with a connection pool size greater
+// than 1. It holds a request handler for each connection of the pool
+// (a connect request handler until the connection is established) and
+// sends each request with one of them, either in turn or with the
+// connection that has the fewest outstanding requests.
+//
+class ConnectionPoolRequestHandler : public RequestHandler, private IceUtil::Mutex
+#ifdef ICE_CPP11_MAPPING
+                                   , public std::enable_shared_from_this<ConnectionPoolRequestHandler>
+#endif
+{
+public:
+
+    ConnectionPoolRequestHandler(const ReferencePtr&, const std::vector<RequestHandlerPtr>&, bool);
+
+    virtual RequestHandlerPtr update(const RequestHandlerPtr&, const RequestHandlerPtr&);
+
+    virtual AsyncStatus sendAsyncRequest(const ProxyOutgoingAsyncBasePtr&);
+
+    virtual void asyncRequestCanceled(const OutgoingAsyncBasePtr&, const Ice::LocalException&);
+
+    virtual Ice::ConnectionIPtr getConnection();
+    virtual Ice::ConnectionIPtr waitForConnection();
+
+private:
+
+    RequestHandlerPtr getRequestHandler();
+
+    std::vector<RequestHandlerPtr> _handlers;
+    const bool _leastOutstanding;
+    size_t _next;
+};
+
+}
+
+#endif
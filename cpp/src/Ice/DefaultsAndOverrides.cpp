@@ -118,10 +118,14 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
     {
         defaultEndpointSelection = ICE_ENUM(EndpointSelectionType, Ordered);
     }
+    else if(value == "Adaptive")
+    {
+        defaultEndpointSelection = ICE_ENUM(EndpointSelectionType, Adaptive);
+    }
     else
     {
         EndpointSelectionTypeParseException ex(__FILE__, __LINE__);
-        ex.str = "illegal value `" + value + "'; expected `Random' or `Ordered'";
+        ex.str = "illegal value `" + value + "'; expected `Random', `Ordered' or `Adaptive'";
         throw ex;
     }
 
@@ -155,6 +159,26 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
             << properties->getProperty("Ice.Default.LocatorCacheTimeout") << "': defaulting to -1";
     }
 
+    const_cast<int&>(defaultParallelConnect) =
+        properties->getPropertyAsIntWithDefault("Ice.Default.ParallelConnect", 1);
+    if(defaultParallelConnect < 1)
+    {
+        const_cast<Int&>(defaultParallelConnect) = 1;
+        Warning out(logger);
+        out << "invalid value for Ice.Default.ParallelConnect `"
+            << properties->getProperty("Ice.Default.ParallelConnect") << "': defaulting to 1";
+    }
+
+    const_cast<int&>(defaultConnectionPoolSize) =
+        properties->getPropertyAsIntWithDefault("Ice.Default.ConnectionPoolSize", 1);
+    if(defaultConnectionPoolSize < 1)
+    {
+        const_cast<Int&>(defaultConnectionPoolSize) = 1;
+        Warning out(logger);
+        out << "invalid value for Ice.Default.ConnectionPoolSize `"
+            << properties->getProperty("Ice.Default.ConnectionPoolSize") << "': defaulting to 1";
+    }
+
     const_cast<bool&>(defaultPreferSecure) =
         properties->getPropertyAsIntWithDefault("Ice.Default.PreferSecure", 0) > 0;
 
@@ -36,6 +36,8 @@ public:
     int defaultTimeout;
     int defaultInvocationTimeout;
     int defaultLocatorCacheTimeout;
+    int defaultParallelConnect;
+    int defaultConnectionPoolSize;
     bool defaultPreferSecure;
     Ice::EncodingVersion defaultEncoding;
     Ice::FormatType defaultFormat;
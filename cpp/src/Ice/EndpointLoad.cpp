@@ -0,0 +1,363 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/EndpointLoad.h>
+#include <Ice/EndpointI.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/Properties.h>
+#include <Ice/Metrics.h>
+#include <Ice/MetricsObserverI.h>
+#include <IceUtil/Random.h>
+
+#include <algorithm>
+#include <math.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(EndpointLoad* p) { return p; }
+IceUtil::Shared* IceInternal::upCast(EndpointLoadTable* p) { return p; }
+
+namespace
+{
+
+//
+// The latency in microseconds of a failed request and of an endpoint
+// without latency.
+//
+const double penalty = 1000000.0;
+
+//
+// The maximum number of loads in the table, the loads which are no
+// longer used by a proxy are removed when the table is full and new
+// loads are not added to the table if it's still full.
+//
+const size_t maxEntries = 1024;
+
+struct CostLess
+{
+    bool
+    operator()(const pair<double, EndpointIPtr>& lhs, const pair<double, EndpointIPtr>& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+//
+// The EndpointLoad metrics map provides one metrics object per endpoint
+// of the table. The map doesn't support the GroupBy, Accept and Reject
+// properties.
+//
+class EndpointLoadMetricsMap : public MetricsMapI
+{
+public:
+
+    EndpointLoadMetricsMap(const string& mapPrefix, const PropertiesPtr& properties, const EndpointLoadTablePtr& table) :
+        MetricsMapI(mapPrefix, properties),
+        _table(table)
+    {
+    }
+
+    virtual void
+    destroy()
+    {
+    }
+
+    virtual IceMX::MetricsFailuresSeq
+    getFailures()
+    {
+        return IceMX::MetricsFailuresSeq();
+    }
+
+    virtual IceMX::MetricsFailures
+    getFailures(const string&)
+    {
+        return IceMX::MetricsFailures();
+    }
+
+    virtual IceMX::MetricsMap
+    getMetrics() const
+    {
+        IceMX::MetricsMap metrics;
+        vector<EndpointLoad::Statistics> stats = _table->getStatistics();
+        for(vector<EndpointLoad::Statistics>::const_iterator p = stats.begin(); p != stats.end(); ++p)
+        {
+            IceMX::EndpointLoadMetricsPtr m = ICE_MAKE_SHARED(IceMX::EndpointLoadMetrics);
+            m->id = p->id;
+            m->total = p->total;
+            m->current = p->current;
+            m->totalLifetime = p->totalLatency;
+            m->failures = p->failures;
+            m->latency = p->latency;
+            m->cost = p->cost;
+            metrics.push_back(m);
+        }
+        return metrics;
+    }
+
+    virtual MetricsMapIPtr
+    clone() const
+    {
+        return ICE_MAKE_SHARED(EndpointLoadMetricsMap, *this);
+    }
+
+private:
+
+    const EndpointLoadTablePtr _table;
+};
+
+class EndpointLoadMetricsMapFactory : public MetricsMapFactory, public IceMX::Updater
+{
+public:
+
+    EndpointLoadMetricsMapFactory(const EndpointLoadTablePtr& table) : MetricsMapFactory(this), _table(table)
+    {
+    }
+
+    virtual MetricsMapIPtr
+    create(const string& mapPrefix, const PropertiesPtr& properties)
+    {
+        return ICE_MAKE_SHARED(EndpointLoadMetricsMap, mapPrefix, properties, _table);
+    }
+
+    virtual void
+    update()
+    {
+        //
+        // Nothing to do, the statistics are computed when the metrics
+        // are retrieved.
+        //
+    }
+
+private:
+
+    const EndpointLoadTablePtr _table;
+};
+
+}
+
+IceInternal::EndpointLoad::EndpointLoad(const string& id, const IceUtil::Time& decayTime) :
+    _id(id),
+    _decayTime(static_cast<double>(decayTime.toMicroSeconds())),
+    _latency(0.0),
+    _outstanding(0),
+    _total(0),
+    _totalLatency(0),
+    _failures(0)
+{
+}
+
+double
+IceInternal::EndpointLoad::cost(const IceUtil::Time& now)
+{
+    Lock sync(*this);
+    return costImpl(now);
+}
+
+void
+IceInternal::EndpointLoad::sent()
+{
+    Lock sync(*this);
+    ++_outstanding;
+}
+
+void
+IceInternal::EndpointLoad::completed(const IceUtil::Time& now, const IceUtil::Time& latency, bool failed)
+{
+    double sample = max(static_cast<double>(latency.toMicroSeconds()), 1.0);
+    if(failed)
+    {
+        sample = max(sample, penalty);
+    }
+
+    Lock sync(*this);
+    assert(_outstanding > 0);
+    --_outstanding;
+    ++_total;
+    _totalLatency += latency.toMicroSeconds();
+    if(failed)
+    {
+        ++_failures;
+    }
+    update(now, sample);
+}
+
+void
+IceInternal::EndpointLoad::failed(const IceUtil::Time& now)
+{
+    Lock sync(*this);
+    ++_total;
+    ++_failures;
+    update(now, penalty);
+}
+
+EndpointLoad::Statistics
+IceInternal::EndpointLoad::getStatistics(const IceUtil::Time& now)
+{
+    Lock sync(*this);
+    Statistics s;
+    s.id = _id;
+    s.total = _total;
+    s.current = _outstanding;
+    s.totalLatency = _totalLatency;
+    s.failures = _failures;
+    s.latency = static_cast<Ice::Long>(latency(now));
+    s.cost = static_cast<Ice::Long>(costImpl(now));
+    return s;
+}
+
+double
+IceInternal::EndpointLoad::latency(const IceUtil::Time& now) const
+{
+    if(_latency == 0.0)
+    {
+        return 0.0;
+    }
+    double elapsed = max(static_cast<double>((now - _updated).toMicroSeconds()), 0.0);
+    return _latency * exp(-elapsed / _decayTime);
+}
+
+void
+IceInternal::EndpointLoad::update(const IceUtil::Time& now, double sample)
+{
+    double current = latency(now);
+    if(sample > current)
+    {
+        _latency = sample;
+    }
+    else
+    {
+        double elapsed = max(static_cast<double>((now - _updated).toMicroSeconds()), 0.0);
+        _latency = current + sample * (1.0 - exp(-elapsed / _decayTime));
+    }
+    _updated = now;
+}
+
+double
+IceInternal::EndpointLoad::costImpl(const IceUtil::Time& now) const
+{
+    double l = latency(now);
+    if(l == 0.0)
+    {
+        return _outstanding * penalty;
+    }
+    return l * (_outstanding + 1);
+}
+
+IceInternal::EndpointLoadTable::EndpointLoadTable(const InitializationData& initData) :
+    _decayTime(IceUtil::Time::milliSeconds(10000))
+{
+    Int num = initData.properties->getPropertyAsIntWithDefault("Ice.AdaptiveSelection.DecayTime", 10000);
+    if(num < 1)
+    {
+        Warning out(initData.logger);
+        out << "invalid value for Ice.AdaptiveSelection.DecayTime `"
+            << initData.properties->getProperty("Ice.AdaptiveSelection.DecayTime") << "': defaulting to 10000";
+    }
+    else
+    {
+        const_cast<IceUtil::Time&>(_decayTime) = IceUtil::Time::milliSeconds(num);
+    }
+}
+
+EndpointLoadPtr
+IceInternal::EndpointLoadTable::get(const EndpointIPtr& endpoint)
+{
+    const string id = endpoint->connectionId("")->toString();
+
+    Lock sync(*this);
+    map<string, EndpointLoadPtr>::const_iterator p = _loads.find(id);
+    if(p != _loads.end())
+    {
+        return p->second;
+    }
+
+    if(_loads.size() >= maxEntries)
+    {
+        map<string, EndpointLoadPtr>::iterator q = _loads.begin();
+        while(q != _loads.end())
+        {
+            if(q->second->__getRef() == 1)
+            {
+                _loads.erase(q++);
+            }
+            else
+            {
+                ++q;
+            }
+        }
+    }
+
+    EndpointLoadPtr load = new EndpointLoad(id, _decayTime);
+    if(_loads.size() < maxEntries)
+    {
+        _loads.insert(make_pair(id, load));
+    }
+    return load;
+}
+
+void
+IceInternal::EndpointLoadTable::sort(vector<EndpointIPtr>& endpoints)
+{
+    if(endpoints.size() < 2)
+    {
+        return;
+    }
+
+    const IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    vector<pair<double, EndpointIPtr> > costs;
+    costs.reserve(endpoints.size());
+    for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    {
+        costs.push_back(make_pair(get(*p)->cost(now), *p));
+    }
+
+    const int size = static_cast<int>(costs.size());
+    size_t i = IceUtilInternal::random(size);
+    size_t j = IceUtilInternal::random(size - 1);
+    if(j >= i)
+    {
+        ++j;
+    }
+    swap(costs[0], costs[costs[j].first < costs[i].first ? j : i]);
+    stable_sort(costs.begin() + 1, costs.end(), CostLess());
+
+    for(size_t n = 0; n < costs.size(); ++n)
+    {
+        endpoints[n] = costs[n].second;
+    }
+}
+
+vector<EndpointLoad::Statistics>
+IceInternal::EndpointLoadTable::getStatistics()
+{
+    vector<EndpointLoadPtr> loads;
+    {
+        Lock sync(*this);
+        for(map<string, EndpointLoadPtr>::const_iterator p = _loads.begin(); p != _loads.end(); ++p)
+        {
+            loads.push_back(p->second);
+        }
+    }
+
+    const IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    vector<EndpointLoad::Statistics> stats;
+    for(vector<EndpointLoadPtr>::const_iterator p = loads.begin(); p != loads.end(); ++p)
+    {
+        stats.push_back((*p)->getStatistics(now));
+    }
+    return stats;
+}
+
+MetricsMapFactoryPtr
+IceInternal::EndpointLoadTable::createMetricsMapFactory()
+{
+    return ICE_MAKE_SHARED(EndpointLoadMetricsMapFactory, this);
+}
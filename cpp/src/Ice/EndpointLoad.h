@@ -0,0 +1,139 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ENDPOINT_LOAD_H
+#define ICE_ENDPOINT_LOAD_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/EndpointLoadF.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/Initialize.h>
+#include <Ice/MetricsAdminI.h>
+
+#include <map>
+
+namespace IceInternal
+{
+
+//
+// The load of an endpoint, for the proxies with the Adaptive endpoint
+// selection. It's the moving average of the latency of the requests
+// sent to the endpoint and the number of outstanding requests.
+//
+// The average is a peak EWMA: a latency greater than the average
+// replaces it and the average otherwise decays toward the latencies
+// of the requests with the Ice.AdaptiveSelection.DecayTime time
+// constant. The average also decays toward 0 while no requests
+// complete, the proxies eventually try again an endpoint which was
+// slow or failed.
+//
+class EndpointLoad : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    EndpointLoad(const std::string&, const IceUtil::Time&);
+
+    const std::string& id() const
+    {
+        return _id;
+    }
+
+    //
+    // The cost of sending a request to the endpoint: the latency
+    // multiplied by the number of outstanding requests plus one. An
+    // endpoint without latency costs 1 second per outstanding request.
+    //
+    double cost(const IceUtil::Time&);
+
+    //
+    // Called when a request is sent to the endpoint and when it
+    // completes. A failed request counts as a latency of 1 second.
+    //
+    void sent();
+    void completed(const IceUtil::Time&, const IceUtil::Time&, bool);
+
+    //
+    // Called when the connection establishment with the endpoint fails
+    // before a request is sent to it, it counts as a failed request.
+    //
+    void failed(const IceUtil::Time&);
+
+    struct Statistics
+    {
+        std::string id;
+        Ice::Long total;
+        Ice::Int current;
+        Ice::Long totalLatency;
+        Ice::Int failures;
+        Ice::Long latency;
+        Ice::Long cost;
+    };
+
+    Statistics getStatistics(const IceUtil::Time&);
+
+private:
+
+    double latency(const IceUtil::Time&) const;
+    double costImpl(const IceUtil::Time&) const;
+    void update(const IceUtil::Time&, double);
+
+    const std::string _id;
+    const double _decayTime; // Microseconds
+
+    double _latency; // Microseconds, 0 until a request completes
+    IceUtil::Time _updated;
+    Ice::Int _outstanding;
+
+    Ice::Long _total;
+    Ice::Long _totalLatency;
+    Ice::Int _failures;
+};
+
+//
+// The loads of the endpoints of the proxies with the Adaptive endpoint
+// selection. The loads are shared by all the proxies of the
+// communicator, they are keyed with the endpoint string without the
+// connection ID.
+//
+// The statistics of the loads are available with the EndpointLoad
+// metrics map.
+//
+class EndpointLoadTable : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    EndpointLoadTable(const Ice::InitializationData&);
+
+    EndpointLoadPtr get(const EndpointIPtr&);
+
+    //
+    // Sort the endpoints to establish a connection, the best of two
+    // random endpoints is first and the other endpoints follow in the
+    // order of their cost.
+    //
+    void sort(std::vector<EndpointIPtr>&);
+
+    std::vector<EndpointLoad::Statistics> getStatistics();
+
+    //
+    // Create the factory of the EndpointLoad metrics map.
+    //
+    MetricsMapFactoryPtr createMetricsMapFactory();
+
+private:
+
+    const IceUtil::Time _decayTime;
+    std::map<std::string, EndpointLoadPtr> _loads;
+};
+
+}
+
+#endif
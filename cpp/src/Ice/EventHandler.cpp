@@ -26,6 +26,10 @@ IceInternal::EventHandler::EventHandler() :
     _finish(false),
 #else
     _disabled(SocketOperationNone),
+    _reactor(0),
+#   if defined(ICE_USE_IO_URING)
+    _ringSlot(-1),
+#   endif
 #endif
     _ready(SocketOperationNone),
     _registered(SocketOperationNone)
@@ -69,6 +69,10 @@ protected:
     bool _finish;
 #else
     SocketOperation _disabled;
+    ThreadPool* _reactor; // The reactor of a sharded thread pool which owns this handler.
+#   if defined(ICE_USE_IO_URING)
+    int _ringSlot; // The io_uring selector slot of this handler or -1 if not registered.
+#   endif
 #endif
     SocketOperation _ready;
     SocketOperation _registered;
@@ -10,6 +10,12 @@
 #ifndef ICE_HASH_UTIL_H
 #define ICE_HASH_UTIL_H
 
+#include <cstring>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
 namespace IceInternal
 {
 
@@ -53,6 +59,24 @@ hashAdd(Ice::Int& hashCode, const std::map<K, V>& map)
     }
 }
 
+//
+// Returns a hash of the calling thread ID between 0 and 255, used to
+// spread per-thread data over a small number of stripes. This is
+// Fibonacci hashing, the result depends on all the bits of the ID.
+//
+inline size_t
+hashThread()
+{
+#ifdef _WIN32
+    size_t id = static_cast<size_t>(GetCurrentThreadId());
+#else
+    size_t id = 0;
+    pthread_t self = pthread_self();
+    memcpy(&id, &self, sizeof(id) < sizeof(self) ? sizeof(id) : sizeof(self));
+#endif
+    return (id * static_cast<size_t>(2654435769U)) >> (sizeof(size_t) * 8 - 8);
+}
+
 }
 
 #endif
@@ -0,0 +1,112 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/HedgingPolicy.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/Properties.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(HedgingPolicy* p) { return p; }
+
+namespace
+{
+
+const int tokenCost = 100; // The tokens are in percent.
+const int maxTokens = 10 * tokenCost;
+const size_t maxSamples = 100;
+const size_t minSamples = 20;
+const size_t updateInterval = 10;
+
+int
+getPercent(const InitializationData& initData, const string& name, int defaultValue, int minValue, int maxValue)
+{
+    int value = initData.properties->getPropertyAsIntWithDefault(name, defaultValue);
+    if(value < minValue || value > maxValue)
+    {
+        Warning out(initData.logger);
+        out << "invalid value for " << name << " `" << initData.properties->getProperty(name) << "': defaulting to "
+            << defaultValue;
+        return defaultValue;
+    }
+    return value;
+}
+
+}
+
+IceInternal::HedgingPolicy::HedgingPolicy(const InitializationData& initData) :
+    _maxLoad(getPercent(initData, "Ice.HedgingMaxLoad", 10, 0, 100)),
+    _percentile(getPercent(initData, "Ice.HedgingPercentile", 0, 0, 99)),
+    _tokens(maxTokens)
+{
+}
+
+IceUtil::Time
+IceInternal::HedgingPolicy::delay(const string& operation, int proxyDelay)
+{
+    Lock sync(*this);
+    _tokens = min(_tokens + _maxLoad, maxTokens);
+    if(_percentile > 0)
+    {
+        map<string, Samples>::const_iterator p = _samples.find(operation);
+        if(p != _samples.end() && p->second.latencies.size() >= minSamples)
+        {
+            return IceUtil::Time::microSeconds(max(p->second.percentile, static_cast<IceUtil::Int64>(1000)));
+        }
+    }
+    return IceUtil::Time::milliSeconds(proxyDelay);
+}
+
+bool
+IceInternal::HedgingPolicy::acquire()
+{
+    Lock sync(*this);
+    if(_tokens < tokenCost)
+    {
+        return false;
+    }
+    _tokens -= tokenCost;
+    return true;
+}
+
+void
+IceInternal::HedgingPolicy::latency(const string& operation, const IceUtil::Time& latency)
+{
+    if(_percentile == 0)
+    {
+        return;
+    }
+
+    Lock sync(*this);
+    Samples& samples = _samples[operation];
+    if(samples.latencies.size() < maxSamples)
+    {
+        samples.latencies.push_back(latency.toMicroSeconds());
+    }
+    else
+    {
+        samples.latencies[samples.next] = latency.toMicroSeconds();
+    }
+    samples.next = (samples.next + 1) % maxSamples;
+
+    //
+    // Compute the percentile again every few samples.
+    //
+    if(samples.latencies.size() >= minSamples && samples.next % updateInterval == 0)
+    {
+        vector<IceUtil::Int64> latencies = samples.latencies;
+        vector<IceUtil::Int64>::iterator p = latencies.begin() + latencies.size() * _percentile / 100;
+        nth_element(latencies.begin(), p, latencies.end());
+        samples.percentile = *p;
+    }
+}
@@ -0,0 +1,86 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_HEDGING_POLICY_H
+#define ICE_HEDGING_POLICY_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/HedgingPolicyF.h>
+#include <Ice/Initialize.h>
+
+#include <map>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The hedging policy of a communicator decides when the hedged request
+// of an invocation is sent and whether it can be sent. It's configured
+// with the Ice.HedgingMaxLoad and Ice.HedgingPercentile properties.
+//
+// The number of hedged requests is limited with a token bucket: each
+// invocation which can be hedged adds MaxLoad percent of a token to the
+// bucket and each hedged request takes one token. The bucket starts full
+// and holds at most 10 tokens.
+//
+// If Percentile is set, the delay of the hedged requests of an operation
+// is this percentile of the latency of the last 100 invocations of the
+// operation which could be hedged. The delay of the proxy is used until
+// 20 invocations completed.
+//
+class HedgingPolicy : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    HedgingPolicy(const Ice::InitializationData&);
+
+    //
+    // Returns the delay after which the hedged request of an invocation
+    // of the given operation is sent, given the hedging delay of the
+    // proxy in milliseconds.
+    //
+    IceUtil::Time delay(const std::string&, int);
+
+    //
+    // Returns true if a hedged request can be sent without exceeding
+    // the maximum load.
+    //
+    bool acquire();
+
+    //
+    // Records the latency of an invocation of the given operation.
+    //
+    void latency(const std::string&, const IceUtil::Time&);
+
+private:
+
+    struct Samples
+    {
+        Samples() : next(0), percentile(0)
+        {
+        }
+
+        std::vector<IceUtil::Int64> latencies;
+        size_t next;
+        IceUtil::Int64 percentile;
+    };
+
+    const int _maxLoad;
+    const int _percentile;
+
+    int _tokens;
+    std::map<std::string, Samples> _samples;
+};
+
+}
+
+#endif
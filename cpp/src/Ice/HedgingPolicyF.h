@@ -0,0 +1,25 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_HEDGING_POLICY_F_H
+#define ICE_HEDGING_POLICY_F_H
+
+#include <IceUtil/Shared.h>
+#include <Ice/Handle.h>
+
+namespace IceInternal
+{
+
+class HedgingPolicy;
+IceUtil::Shared* upCast(HedgingPolicy*);
+typedef IceInternal::Handle<HedgingPolicy> HedgingPolicyPtr;
+
+}
+
+#endif
@@ -0,0 +1,297 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/HostResolverCache.h>
+#include <Ice/LocalException.h>
+#include <Ice/MetricsObserverI.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(HostResolverCache* p) { return p; }
+
+namespace
+{
+
+//
+// The maximum number of cached host names, expired entries are removed
+// when the cache is full and new entries are not cached if the cache
+// is still full.
+//
+const size_t maxEntries = 1024;
+
+//
+// The HostResolver metrics map provides a single HostResolverMetrics
+// object with the HostResolver id. The map doesn't support the GroupBy,
+// Accept and Reject properties.
+//
+class HostResolverMetricsMap : public MetricsMapI
+{
+public:
+
+    HostResolverMetricsMap(const string& mapPrefix, const PropertiesPtr& properties,
+                           const HostResolverCachePtr& cache) :
+        MetricsMapI(mapPrefix, properties),
+        _cache(cache)
+    {
+    }
+
+    virtual void
+    destroy()
+    {
+    }
+
+    virtual IceMX::MetricsFailuresSeq
+    getFailures()
+    {
+        return IceMX::MetricsFailuresSeq();
+    }
+
+    virtual IceMX::MetricsFailures
+    getFailures(const string&)
+    {
+        return IceMX::MetricsFailures();
+    }
+
+    virtual IceMX::MetricsMap
+    getMetrics() const
+    {
+        HostResolverCache::Statistics stats = _cache->getStatistics();
+
+        IceMX::HostResolverMetricsPtr m = ICE_MAKE_SHARED(IceMX::HostResolverMetrics);
+        m->id = "HostResolver";
+        m->lookups = stats.lookups;
+        m->failedLookups = stats.failedLookups;
+        m->coalesced = stats.coalesced;
+        m->hits = stats.hits;
+        m->negativeHits = stats.negativeHits;
+        m->cached = stats.cached;
+        m->negativeCached = stats.negativeCached;
+
+        IceMX::MetricsMap metrics;
+        metrics.push_back(m);
+        return metrics;
+    }
+
+    virtual MetricsMapIPtr
+    clone() const
+    {
+        return ICE_MAKE_SHARED(HostResolverMetricsMap, *this);
+    }
+
+private:
+
+    const HostResolverCachePtr _cache;
+};
+
+class HostResolverMetricsMapFactory : public MetricsMapFactory, public IceMX::Updater
+{
+public:
+
+    HostResolverMetricsMapFactory(const HostResolverCachePtr& cache) : MetricsMapFactory(this), _cache(cache)
+    {
+    }
+
+    virtual MetricsMapIPtr
+    create(const string& mapPrefix, const PropertiesPtr& properties)
+    {
+        return ICE_MAKE_SHARED(HostResolverMetricsMap, mapPrefix, properties, _cache);
+    }
+
+    virtual void
+    update()
+    {
+        //
+        // Nothing to do, the statistics are computed when the metrics
+        // are retrieved.
+        //
+    }
+
+private:
+
+    const HostResolverCachePtr _cache;
+};
+
+}
+
+IceInternal::HostResolverCache::HostResolverCache(const IceUtil::Time& ttl, const IceUtil::Time& negativeTTL) :
+    _ttl(ttl),
+    _negativeTTL(negativeTTL),
+    _negativeEntries(0),
+    _hits(0),
+    _negativeHits(0),
+    _lookups(0),
+    _failedLookups(0),
+    _coalesced(0)
+{
+}
+
+bool
+IceInternal::HostResolverCache::get(const string& host, vector<Address>& addresses)
+{
+    Lock sync(*this);
+    map<string, Entry>::iterator p = _entries.find(host);
+    if(p == _entries.end())
+    {
+        return false;
+    }
+
+    if(p->second.expiration <= IceUtil::Time::now(IceUtil::Time::Monotonic))
+    {
+        if(p->second.error != 0)
+        {
+            --_negativeEntries;
+        }
+        _entries.erase(p);
+        return false;
+    }
+
+    if(p->second.error != 0)
+    {
+        ++_negativeHits;
+        DNSException ex(__FILE__, __LINE__);
+        ex.error = p->second.error;
+        ex.host = host;
+        throw ex;
+    }
+
+    ++_hits;
+    addresses = p->second.addresses;
+    return true;
+}
+
+void
+IceInternal::HostResolverCache::add(const string& host, const vector<Address>& addresses)
+{
+    if(_ttl <= IceUtil::Time())
+    {
+        return;
+    }
+
+    Lock sync(*this);
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    map<string, Entry>::iterator p = _entries.find(host);
+    if(p == _entries.end())
+    {
+        purge(now);
+        if(_entries.size() >= maxEntries)
+        {
+            return;
+        }
+        p = _entries.insert(make_pair(host, Entry())).first;
+    }
+    else if(p->second.error != 0)
+    {
+        --_negativeEntries;
+    }
+    p->second.addresses = addresses;
+    p->second.error = 0;
+    p->second.expiration = now + _ttl;
+}
+
+void
+IceInternal::HostResolverCache::addFailure(const string& host, int error)
+{
+    if(_negativeTTL <= IceUtil::Time())
+    {
+        return;
+    }
+
+    Lock sync(*this);
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    map<string, Entry>::iterator p = _entries.find(host);
+    if(p == _entries.end())
+    {
+        purge(now);
+        if(_entries.size() >= maxEntries)
+        {
+            return;
+        }
+        p = _entries.insert(make_pair(host, Entry())).first;
+        ++_negativeEntries;
+    }
+    else if(p->second.error == 0)
+    {
+        ++_negativeEntries;
+    }
+    p->second.addresses.clear();
+    p->second.error = error != 0 ? error : -1;
+    p->second.expiration = now + _negativeTTL;
+}
+
+void
+IceInternal::HostResolverCache::lookupStarted()
+{
+    Lock sync(*this);
+    ++_lookups;
+}
+
+void
+IceInternal::HostResolverCache::lookupCompleted(bool failed)
+{
+    Lock sync(*this);
+    if(failed)
+    {
+        ++_failedLookups;
+    }
+}
+
+void
+IceInternal::HostResolverCache::lookupCoalesced()
+{
+    Lock sync(*this);
+    ++_coalesced;
+}
+
+HostResolverCache::Statistics
+IceInternal::HostResolverCache::getStatistics()
+{
+    Lock sync(*this);
+    Statistics stats;
+    stats.lookups = _lookups;
+    stats.failedLookups = _failedLookups;
+    stats.coalesced = _coalesced;
+    stats.hits = _hits;
+    stats.negativeHits = _negativeHits;
+    stats.cached = static_cast<Int>(_entries.size() - _negativeEntries);
+    stats.negativeCached = static_cast<Int>(_negativeEntries);
+    return stats;
+}
+
+MetricsMapFactoryPtr
+IceInternal::HostResolverCache::createMetricsMapFactory()
+{
+    return ICE_MAKE_SHARED(HostResolverMetricsMapFactory, this);
+}
+
+void
+IceInternal::HostResolverCache::purge(const IceUtil::Time& now)
+{
+    if(_entries.size() < maxEntries)
+    {
+        return;
+    }
+
+    for(map<string, Entry>::iterator p = _entries.begin(); p != _entries.end();)
+    {
+        if(p->second.expiration <= now)
+        {
+            if(p->second.error != 0)
+            {
+                --_negativeEntries;
+            }
+            _entries.erase(p++);
+        }
+        else
+        {
+            ++p;
+        }
+    }
+}
@@ -0,0 +1,103 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_HOST_RESOLVER_CACHE_H
+#define ICE_HOST_RESOLVER_CACHE_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <Ice/IPEndpointIF.h>
+#include <Ice/Network.h>
+#include <Ice/MetricsAdminI.h>
+
+#include <map>
+
+namespace IceInternal
+{
+
+//
+// The host resolver cache keeps the addresses of the resolved host
+// names for Ice.HostResolver.CacheTTL seconds and the failed lookups
+// for Ice.HostResolver.NegativeCacheTTL seconds. The addresses are
+// cached without port and in the order of the Ordered endpoint
+// selection, the resolver sets the port and reorders the addresses for
+// each request.
+//
+// The cache is disabled if the TTLs are 0 (the default). It also counts
+// the DNS lookups of the resolver, the statistics are available with
+// the HostResolver metrics map.
+//
+class HostResolverCache : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    HostResolverCache(const IceUtil::Time&, const IceUtil::Time&);
+
+    //
+    // Returns true and the cached addresses of the host if it's in
+    // the cache, throws DNSException if the cache holds a failed
+    // lookup for the host.
+    //
+    bool get(const std::string&, std::vector<Address>&);
+
+    void add(const std::string&, const std::vector<Address>&);
+    void addFailure(const std::string&, int);
+
+    //
+    // Statistics of the resolver.
+    //
+    void lookupStarted();
+    void lookupCompleted(bool);
+    void lookupCoalesced();
+
+    struct Statistics
+    {
+        Ice::Long lookups;
+        Ice::Int failedLookups;
+        Ice::Long coalesced;
+        Ice::Long hits;
+        Ice::Long negativeHits;
+        Ice::Int cached;
+        Ice::Int negativeCached;
+    };
+
+    Statistics getStatistics();
+
+    //
+    // Create the factory of the HostResolver metrics map.
+    //
+    MetricsMapFactoryPtr createMetricsMapFactory();
+
+private:
+
+    struct Entry
+    {
+        std::vector<Address> addresses;
+        int error; // The getaddrinfo error of a failed lookup, 0 otherwise.
+        IceUtil::Time expiration;
+    };
+
+    void purge(const IceUtil::Time&);
+
+    const IceUtil::Time _ttl;
+    const IceUtil::Time _negativeTTL;
+    std::map<std::string, Entry> _entries;
+    size_t _negativeEntries;
+
+    Ice::Long _hits;
+    Ice::Long _negativeHits;
+    Ice::Long _lookups;
+    Ice::Int _failedLookups;
+    Ice::Long _coalesced;
+};
+
+}
+
+#endif
@@ -15,6 +15,7 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/HashUtil.h>
 #include <Ice/NetworkProxy.h>
+#include <Ice/HostResolverCache.h>
 #include <IceUtil/MutexPtrLock.h>
 
 using namespace std;
@@ -538,26 +539,34 @@ IceInternal::IPEndpointI::IPEndpointI(const ProtocolInstancePtr& instance, Input
 #ifndef ICE_OS_UWP
 
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
-    IceUtil::Thread("Ice.HostResolver"),
     _instance(instance),
     _protocol(instance->protocolSupport()),
     _preferIPv6(instance->preferIPv6()),
-    _destroyed(false)
-{
+    _cache(new HostResolverCache(
+               IceUtil::Time::seconds(instance->initializationData().properties->getPropertyAsIntWithDefault(
+                                          "Ice.HostResolver.CacheTTL", 0)),
+               IceUtil::Time::seconds(instance->initializationData().properties->getPropertyAsIntWithDefault(
+                                          "Ice.HostResolver.NegativeCacheTTL", 0)))),
+    _threadsMax(0),
+    _hasPriority(instance->initializationData().properties->getProperty("Ice.ThreadPriority") != ""),
+    _priority(instance->initializationData().properties->getPropertyAsInt("Ice.ThreadPriority")),
+    _destroyed(false),
+    _idle(0)
+{
+    int threads = _instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.HostResolver.Threads",
+                                                                                           2);
+    if(threads < 1)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << "Ice.HostResolver.Threads < 1; Threads adjusted to 1";
+        threads = 1;
+    }
+    const_cast<size_t&>(_threadsMax) = static_cast<size_t>(threads);
+
     __setNoDelete(true);
     try
     {
-        updateObserver();
-        bool hasPriority = _instance->initializationData().properties->getProperty("Ice.ThreadPriority") != "";
-        int priority = _instance->initializationData().properties->getPropertyAsInt("Ice.ThreadPriority");
-        if(hasPriority)
-        {
-            start(0, priority);
-        }
-        else
-        {
-            start();
-        }
+        startThread();
     }
     catch(const IceUtil::Exception& ex)
     {
@@ -565,6 +574,7 @@ IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& insta
             Ice::Error out(_instance->initializationData().logger);
             out << "cannot create thread for enpoint host resolver:\n" << ex;
         }
+        __setNoDelete(false);
         throw;
     }
     __setNoDelete(false);
@@ -575,8 +585,10 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
                                            const IPEndpointIPtr& endpoint, const EndpointI_connectorsPtr& callback)
 {
     //
-    // Try to get the addresses without DNS lookup. If this doesn't work, we queue a resolve
-    // entry and the thread will take care of getting the endpoint addresses.
+    // Try to get the addresses without DNS lookup or from the cache. If this doesn't work, we
+    // queue a resolve entry and a resolver thread will take care of getting the endpoint
+    // addresses. The cache isn't used with a network proxy, the addresses are resolved with
+    // the protocol of the proxy.
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if(!networkProxy)
@@ -597,27 +609,90 @@ IceInternal::EndpointHostResolver::resolve(const string& host, int port, Ice::En
         }
     }
 
+    ObserverPtr observer;
+    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
+    if(obsv)
+    {
+        observer = obsv->getEndpointLookupObserver(endpoint);
+        if(observer)
+        {
+            observer->attach();
+        }
+    }
+
+    if(!networkProxy)
+    {
+        try
+        {
+            vector<Address> addrs;
+            if(_cache->get(host, addrs))
+            {
+                for(vector<Address>::iterator p = addrs.begin(); p != addrs.end(); ++p)
+                {
+                    setPort(*p, port);
+                }
+                sortAddresses(addrs, _protocol, selType, _preferIPv6);
+                vector<ConnectorPtr> connectors = endpoint->connectors(addrs, 0);
+                if(observer)
+                {
+                    observer->detach();
+                }
+                callback->connectors(connectors);
+                return;
+            }
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            if(observer)
+            {
+                observer->failed(ex.ice_id());
+                observer->detach();
+            }
+            callback->exception(ex);
+            return;
+        }
+    }
+
     Lock sync(*this);
     assert(!_destroyed);
 
     ResolveEntry entry;
-    entry.host = host;
     entry.port = port;
     entry.selType = selType;
     entry.endpoint = endpoint;
     entry.callback = callback;
+    entry.observer = observer;
 
-    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
-    if(obsv)
+    //
+    // If a lookup for this host is already queued or in progress, the request waits for the
+    // result of this lookup.
+    //
+    map<string, vector<ResolveEntry> >::iterator p = _pending.find(host);
+    if(p != _pending.end())
+    {
+        p->second.push_back(entry);
+        _cache->lookupCoalesced();
+        return;
+    }
+
+    _pending[host].push_back(entry);
+    _queue.push_back(host);
+
+    //
+    // Start a new thread if there are more host names to resolve than idle threads.
+    //
+    if(_queue.size() > _idle && _threads.size() < _threadsMax)
     {
-        entry.observer = obsv->getEndpointLookupObserver(endpoint);
-        if(entry.observer)
+        try
+        {
+            startThread();
+        }
+        catch(const IceUtil::Exception& ex)
         {
-            entry.observer->attach();
+            Ice::Error out(_instance->initializationData().logger);
+            out << "cannot create thread for enpoint host resolver:\n" << ex;
         }
     }
-
-    _queue.push_back(entry);
     notify();
 }
 
@@ -627,31 +702,73 @@ IceInternal::EndpointHostResolver::destroy()
     Lock sync(*this);
     assert(!_destroyed);
     _destroyed = true;
-    notify();
+    notifyAll();
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::joinWithAllThreads()
+{
+    //
+    // No new threads are started once the resolver is destroyed.
+    //
+    vector<HostResolverThreadPtr> threads;
+    {
+        Lock sync(*this);
+        assert(_destroyed);
+        threads.swap(_threads);
+    }
+
+    for(vector<HostResolverThreadPtr>::const_iterator p = threads.begin(); p != threads.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+
+    map<string, vector<ResolveEntry> > pending;
+    {
+        Lock sync(*this);
+        pending.swap(_pending);
+        _queue.clear();
+    }
+
+    for(map<string, vector<ResolveEntry> >::const_iterator p = pending.begin(); p != pending.end(); ++p)
+    {
+        for(vector<ResolveEntry>::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+        {
+            Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
+            if(q->observer)
+            {
+                q->observer->failed(ex.ice_id());
+                q->observer->detach();
+            }
+            q->callback->exception(ex);
+        }
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::run(ObserverHelperT<ThreadObserver>& observer)
 {
     while(true)
     {
-        ResolveEntry r;
+        string host;
         ThreadObserverPtr threadObserver;
         {
             Lock sync(*this);
+            ++_idle;
             while(!_destroyed && _queue.empty())
             {
                 wait();
             }
+            --_idle;
 
             if(_destroyed)
             {
                 break;
             }
 
-            r = _queue.front();
+            host = _queue.front();
             _queue.pop_front();
-            threadObserver = _observer.get();
+            threadObserver = observer.get();
         }
 
         if(threadObserver)
@@ -659,10 +776,18 @@ IceInternal::EndpointHostResolver::run()
             threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateIdle), ICE_ENUM(ThreadState, ThreadStateInUseForOther));
         }
 
+        //
+        // Resolve the host without port and with the Ordered endpoint selection, the port and
+        // order of the addresses are set below for each request.
+        //
+        vector<Address> addresses;
+        NetworkProxyPtr networkProxy = _instance->networkProxy();
+        const bool cache = !networkProxy;
+        ProtocolSupport protocol = _protocol;
+        IceInternal::UniquePtr<Ice::LocalException> exception;
+        _cache->lookupStarted();
         try
         {
-            NetworkProxyPtr networkProxy = _instance->networkProxy();
-            ProtocolSupport protocol = _protocol;
             if(networkProxy)
             {
                 networkProxy = networkProxy->resolveHost(_protocol);
@@ -672,61 +797,137 @@ IceInternal::EndpointHostResolver::run()
                 }
             }
 
-            vector<Address> addresses = getAddresses(r.host, r.port, protocol, r.selType, _preferIPv6, true);
-            if(r.observer)
+            addresses = getAddresses(host, 0, protocol, Ice::ICE_ENUM(EndpointSelectionType, Ordered), _preferIPv6,
+                                     true);
+            if(cache)
             {
-                r.observer->detach();
-                r.observer = 0;
+                _cache->add(host, addresses);
             }
-
-            r.callback->connectors(r.endpoint->connectors(addresses, networkProxy));
-
-            if(threadObserver)
+        }
+        catch(const Ice::DNSException& ex)
+        {
+            //
+            // Temporary failures aren't cached, the next request will retry the lookup.
+            //
+            if(cache && ex.error != EAI_AGAIN)
             {
-                threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
-                                             ICE_ENUM(ThreadState, ThreadStateIdle));
+                _cache->addFailure(host, ex.error);
             }
-
+            ICE_SET_EXCEPTION_FROM_CLONE(exception, ex.ice_clone());
         }
         catch(const Ice::LocalException& ex)
         {
-            if(threadObserver)
+            ICE_SET_EXCEPTION_FROM_CLONE(exception, ex.ice_clone());
+        }
+        _cache->lookupCompleted(exception.get() != 0);
+
+        vector<ResolveEntry> entries;
+        {
+            Lock sync(*this);
+            map<string, vector<ResolveEntry> >::iterator p = _pending.find(host);
+            assert(p != _pending.end());
+            entries.swap(p->second);
+            _pending.erase(p);
+        }
+
+        for(vector<ResolveEntry>::iterator p = entries.begin(); p != entries.end(); ++p)
+        {
+            try
             {
-                threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
-                                             ICE_ENUM(ThreadState, ThreadStateIdle));
+                if(exception.get())
+                {
+                    exception->ice_throw();
+                }
+
+                vector<Address> addrs = addresses;
+                for(vector<Address>::iterator q = addrs.begin(); q != addrs.end(); ++q)
+                {
+                    setPort(*q, p->port);
+                }
+                sortAddresses(addrs, protocol, p->selType, _preferIPv6);
+
+                if(p->observer)
+                {
+                    p->observer->detach();
+                    p->observer = 0;
+                }
+
+                p->callback->connectors(p->endpoint->connectors(addrs, networkProxy));
             }
-            if(r.observer)
+            catch(const Ice::LocalException& ex)
             {
-                r.observer->failed(ex.ice_id());
-                r.observer->detach();
+                if(p->observer)
+                {
+                    p->observer->failed(ex.ice_id());
+                    p->observer->detach();
+                }
+                p->callback->exception(ex);
             }
-            r.callback->exception(ex);
         }
-    }
 
-    for(deque<ResolveEntry>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
-    {
-        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
-        if(p->observer)
+        if(threadObserver)
         {
-            p->observer->failed(ex.ice_id());
-            p->observer->detach();
+            threadObserver->stateChanged(ICE_ENUM(ThreadState, ThreadStateInUseForOther),
+                                         ICE_ENUM(ThreadState, ThreadStateIdle));
         }
-        p->callback->exception(ex);
     }
-    _queue.clear();
 
-    if(_observer)
+    Lock sync(*this);
+    if(observer)
+    {
+        observer.detach();
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::startThread()
+{
+    //
+    // Must be called with the resolver locked or from the constructor.
+    //
+    ostringstream os;
+    os << "Ice.HostResolver";
+    if(!_threads.empty())
+    {
+        os << '-' << _threads.size();
+    }
+    HostResolverThreadPtr thread = new HostResolverThread(this, os.str());
+    if(_hasPriority)
+    {
+        thread->start(0, _priority);
+    }
+    else
     {
-        _observer.detach();
+        thread->start();
     }
+    _threads.push_back(thread);
 }
 
 void
 IceInternal::EndpointHostResolver::updateObserver()
 {
     Lock sync(*this);
-    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
+    for(vector<HostResolverThreadPtr>::const_iterator p = _threads.begin(); p != _threads.end(); ++p)
+    {
+        (*p)->updateObserver();
+    }
+}
+
+IceInternal::EndpointHostResolver::HostResolverThread::HostResolverThread(const EndpointHostResolverPtr& resolver,
+                                                                          const string& name) :
+    IceUtil::Thread(name),
+    _resolver(resolver)
+{
+    updateObserver();
+}
+
+void
+IceInternal::EndpointHostResolver::HostResolverThread::updateObserver()
+{
+    //
+    // Must be called with the resolver locked or before the thread is started.
+    //
+    const CommunicatorObserverPtr& obsv = _resolver->_instance->initializationData().observer;
     if(obsv)
     {
         _observer.attach(obsv->getThreadObserver("Communicator",
@@ -736,6 +937,13 @@ IceInternal::EndpointHostResolver::updateObserver()
     }
 }
 
+void
+IceInternal::EndpointHostResolver::HostResolverThread::run()
+{
+    _resolver->run(_observer);
+    _resolver = 0; // Break cyclic dependency.
+}
+
 #else
 
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance) :
@@ -768,7 +976,7 @@ IceInternal::EndpointHostResolver::destroy()
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::joinWithAllThreads()
 {
 }
 
@@ -22,6 +22,7 @@
 
 #ifndef ICE_OS_UWP
 #   include <deque>
+#   include <map>
 #endif
 
 namespace IceInternal
@@ -109,8 +110,14 @@ private:
     mutable Ice::Int _hashValue;
 };
 
+//
+// The endpoint host resolver resolves the endpoint host names with a
+// pool of up to Ice.HostResolver.Threads threads. Concurrent requests for the
+// same host name are coalesced into a single DNS lookup and the results
+// of the lookups are kept in the host resolver cache.
+//
 #ifndef ICE_OS_UWP
-class ICE_API EndpointHostResolver : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+class ICE_API EndpointHostResolver : public IceUtil::Shared, public IceUtil::Monitor<IceUtil::Mutex>
 #else
 class ICE_API EndpointHostResolver : public IceUtil::Shared
 #endif
@@ -122,16 +129,22 @@ public:
     void resolve(const std::string&, int, Ice::EndpointSelectionType, const IPEndpointIPtr&,
                  const EndpointI_connectorsPtr&);
     void destroy();
+    void joinWithAllThreads();
 
-    virtual void run();
     void updateObserver();
 
+#ifndef ICE_OS_UWP
+    const HostResolverCachePtr& cache() const
+    {
+        return _cache;
+    }
+#endif
+
 private:
 
 #ifndef ICE_OS_UWP
     struct ResolveEntry
     {
-        std::string host;
         int port;
         Ice::EndpointSelectionType selType;
         IPEndpointIPtr endpoint;
@@ -139,12 +152,38 @@ private:
         Ice::Instrumentation::ObserverPtr observer;
     };
 
+    class HostResolverThread : public IceUtil::Thread
+    {
+    public:
+
+        HostResolverThread(const EndpointHostResolverPtr&, const std::string&);
+        virtual void run();
+
+        void updateObserver();
+
+    private:
+
+        EndpointHostResolverPtr _resolver;
+        ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    };
+    typedef IceUtil::Handle<HostResolverThread> HostResolverThreadPtr;
+    friend class HostResolverThread;
+
+    void startThread();
+    void run(ObserverHelperT<Ice::Instrumentation::ThreadObserver>&);
+
     const InstancePtr _instance;
     const IceInternal::ProtocolSupport _protocol;
     const bool _preferIPv6;
+    const HostResolverCachePtr _cache;
+    const size_t _threadsMax; // Maximum number of threads, the threads are created on demand.
+    const bool _hasPriority;
+    const int _priority;
     bool _destroyed;
-    std::deque<ResolveEntry> _queue;
-    ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    size_t _idle; // Number of threads waiting for a host name to resolve.
+    std::deque<std::string> _queue; // The host names waiting for a resolver thread.
+    std::map<std::string, std::vector<ResolveEntry> > _pending; // The requests waiting for each host name.
+    std::vector<HostResolverThreadPtr> _threads;
 #else
     const InstancePtr _instance;
 #endif
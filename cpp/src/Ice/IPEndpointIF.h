@@ -28,6 +28,10 @@ typedef Handle<IPEndpointI> IPEndpointIPtr;
 class EndpointHostResolver;
 ICE_API IceUtil::Shared* upCast(EndpointHostResolver*);
 typedef Handle<EndpointHostResolver> EndpointHostResolverPtr;
+
+class HostResolverCache;
+ICE_API IceUtil::Shared* upCast(HostResolverCache*);
+typedef Handle<HostResolverCache> HostResolverCachePtr;
 }
 
 #endif
@@ -13,6 +13,7 @@
 #include <Ice/ObjectAdapter.h>
 #include <Ice/ServantLocator.h>
 #include <Ice/ServantManager.h>
+#include <Ice/AdmissionController.h>
 #include <Ice/Object.h>
 #include <Ice/ConnectionI.h>
 #include <Ice/LocalException.h>
@@ -23,6 +24,8 @@
 #include <Ice/ReplyStatus.h>
 #include <Ice/ResponseHandler.h>
 #include <Ice/StringUtil.h>
+#include <IceUtil/InputUtil.h>
+#include <IceUtil/ThreadException.h>
 #include <typeinfo>
 
 using namespace std;
@@ -37,6 +40,119 @@ extern bool printStackTraces;
 
 }
 
+#ifndef ICE_OS_UWP
+namespace
+{
+
+//
+// The thread-specific key of the deadline of the request dispatched by
+// a thread, invocations made by the servant inherit this deadline.
+//
+#   ifdef _WIN32
+DWORD deadlineKey;
+#   else
+pthread_key_t deadlineKey;
+#   endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+#   ifdef _WIN32
+        deadlineKey = TlsAlloc();
+        if(deadlineKey == TLS_OUT_OF_INDEXES)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+        }
+#   else
+        int err = pthread_key_create(&deadlineKey, 0);
+        if(err != 0)
+        {
+            throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+        }
+#   endif
+    }
+
+    ~Init()
+    {
+#   ifdef _WIN32
+        TlsFree(deadlineKey);
+#   else
+        pthread_key_delete(deadlineKey);
+#   endif
+    }
+};
+
+Init init;
+
+const Ice::Long*
+getThreadDeadline()
+{
+#   ifdef _WIN32
+    return static_cast<const Ice::Long*>(TlsGetValue(deadlineKey));
+#   else
+    return static_cast<const Ice::Long*>(pthread_getspecific(deadlineKey));
+#   endif
+}
+
+void
+setThreadDeadline(const Ice::Long* deadline)
+{
+#   ifdef _WIN32
+    if(TlsSetValue(deadlineKey, const_cast<Ice::Long*>(deadline)) == 0)
+    {
+        throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, GetLastError());
+    }
+#   else
+    int err = pthread_setspecific(deadlineKey, deadline);
+    if(err != 0)
+    {
+        throw IceUtil::ThreadSyscallException(__FILE__, __LINE__, err);
+    }
+#   endif
+}
+
+//
+// Sets the deadline of the calling thread for the duration of the
+// dispatch of a request, this supports nested collocated dispatch.
+//
+class DeadlineScope
+{
+public:
+
+    DeadlineScope(const Ice::Long& deadline) : _previous(getThreadDeadline())
+    {
+        setThreadDeadline(&deadline);
+    }
+
+    ~DeadlineScope()
+    {
+        setThreadDeadline(_previous);
+    }
+
+private:
+
+    const Ice::Long* _previous;
+};
+
+}
+
+Ice::Long
+IceInternal::getDispatchDeadline()
+{
+    const Ice::Long* deadline = getThreadDeadline();
+    return deadline ? *deadline : 0;
+}
+#else
+Ice::Long
+IceInternal::getDispatchDeadline()
+{
+    return 0; // Deadline inheritance isn't supported with UWP.
+}
+#endif
+
 #ifdef ICE_CPP11_MAPPING
 Ice::MarshaledResult::MarshaledResult(const Ice::Current& current) :
     ostr(make_shared<Ice::OutputStream>(current.adapter->getCommunicator(), Ice::currentProtocolEncoding))
@@ -64,6 +180,7 @@ IceInternal::IncomingBase::IncomingBase(Instance* instance, ResponseHandler* res
     _current.con = connection;
 #endif
     _current.requestId = requestId;
+    _current.deadline = 0;
 }
 
 IceInternal::IncomingBase::IncomingBase(IncomingBase& other) :
@@ -612,7 +729,8 @@ IceInternal::Incoming::startOver()
 }
 
 void
-IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream)
+IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStream* stream,
+                              const IceUtil::Time& received)
 {
     _is = stream;
 
@@ -647,15 +765,54 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
     _is->read(b);
     _current.mode = static_cast<OperationMode>(b);
 
+    IceUtil::Int64 timeout = 0;
     Int sz = _is->readSize();
     while(sz--)
     {
         pair<const string, string> pr;
         _is->read(const_cast<string&>(pr.first));
         _is->read(pr.second);
+        if(pr.first == deadlineContextKey)
+        {
+            //
+            // The remaining time of the invocation timeout isn't part of
+            // the context provided to the servant.
+            //
+            if(!IceUtilInternal::stringToInt64(pr.second, timeout) || timeout < 0)
+            {
+                timeout = 0;
+            }
+            continue;
+        }
         _current.ctx.insert(_current.ctx.end(), pr);
     }
 
+    //
+    // The admission controller only applies to the requests which were
+    // queued for dispatch.
+    //
+    AdmissionController* admissionController = 0;
+    if(servantManager && received != IceUtil::Time())
+    {
+        admissionController = servantManager->getAdmissionController().get();
+    }
+
+    IceUtil::Time now;
+    if(timeout > 0 || admissionController)
+    {
+        now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    }
+
+    if(timeout > 0)
+    {
+        //
+        // The deadline is relative to the time the request was received
+        // by the connection, the time spent in the dispatch queue of the
+        // thread pool counts against the deadline.
+        //
+        _current.deadline = (received != IceUtil::Time() ? received : now).toMilliSeconds() + timeout;
+    }
+
     const CommunicatorObserverPtr& obsv = _is->instance()->initializationData().observer;
     if(obsv)
     {
@@ -667,6 +824,26 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
         _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + sz)));
     }
 
+    if(_current.deadline > 0 && now.toMilliSeconds() >= _current.deadline)
+    {
+        //
+        // The client already gave up on this request, don't dispatch it.
+        //
+        _observer.expired();
+        ostringstream str;
+        str << InvocationTimeoutException(__FILE__, __LINE__);
+        discard(str.str());
+        return;
+    }
+
+    if(admissionController && !admissionController->admit(_current, now, now - received))
+    {
+        _observer.rejected();
+        discard("request rejected by the admission control of object adapter `" + _current.adapter->getName() +
+                "': the adapter is overloaded");
+        return;
+    }
+
     //
     // Don't put the code above into the try block below. Exceptions
     // in the code above are considered fatal, and must propagate to
@@ -732,7 +909,15 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
         //
         // Dispatch in the incoming call
         //
-        _servant->_iceDispatch(*this, _current);
+        if(_current.deadline > 0)
+        {
+            DeadlineScope deadline(_current.deadline);
+            _servant->_iceDispatch(*this, _current);
+        }
+        else
+        {
+            _servant->_iceDispatch(*this, _current);
+        }
 
         //
         // If the request was not dispatched asynchronously, send the response.
@@ -791,6 +976,31 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
     }
 }
 
+void
+IceInternal::Incoming::discard(const string& reason)
+{
+    //
+    // Reply with an unknown local exception without dispatching the
+    // request. The request is discarded because the server is
+    // overloaded, so unlike other dispatch failures it isn't logged.
+    //
+    skipReadParams(); // Required for batch requests.
+    if(_response)
+    {
+        _os.writeBlob(replyHdr, sizeof(replyHdr));
+        _os.write(_current.requestId);
+        _os.write(replyUnknownLocalException);
+        _os.write(reason, false);
+        _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
+        _responseHandler->sendResponse(_current.requestId, &_os, _compress, false);
+    }
+    else
+    {
+        _responseHandler->sendNoResponse();
+    }
+    _observer.detach();
+}
+
 const Current&
 IceInternal::IncomingRequest::getCurrent()
 {
@@ -163,6 +163,11 @@ Ice::InputStream::initialize(Instance* instance, const EncodingVersion& encoding
 
     _instance = instance;
 
+    if(_instance->bufferPool())
+    {
+        b.setPool(_instance->bufferPool());
+    }
+
 #ifndef ICE_CPP11_MAPPING
     _collectObjects = _instance->collectObjects();
 #endif
@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Instance.h>
+#include <Ice/BufferPool.h>
 #include <Ice/TraceLevels.h>
 #include <Ice/DefaultsAndOverrides.h>
 #include <Ice/RouterInfo.h>
@@ -26,11 +27,15 @@
 #include <Ice/PropertiesAdminI.h>
 #include <Ice/LoggerI.h>
 #include <Ice/NetworkProxy.h>
+#include <Ice/Compressor.h>
 #include <Ice/EndpointFactoryManager.h>
 #include <Ice/IPEndpointI.h> // For EndpointHostResolver
+#include <Ice/HostResolverCache.h>
 #include <Ice/WSEndpoint.h>
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/RetryQueue.h>
+#include <Ice/HedgingPolicy.h>
+#include <Ice/EndpointLoad.h>
 #include <Ice/DynamicLibrary.h>
 #include <Ice/PluginManagerI.h>
 #include <Ice/Initialize.h>
@@ -207,6 +212,18 @@ public:
     {
     }
 
+    Timer(const IceUtil::Time& tick, int priority) :
+        IceUtil::Timer(tick, priority),
+        _hasObserver(0)
+    {
+    }
+
+    Timer(const IceUtil::Time& tick) :
+        IceUtil::Timer(tick),
+        _hasObserver(0)
+    {
+    }
+
     void updateObserver(const Ice::Instrumentation::CommunicatorObserverPtr&);
 
 private:
@@ -948,6 +965,11 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
     _initData(initData),
     _messageSizeMax(0),
     _batchAutoFlushSize(0),
+    _batchAutoFlushDelay(0),
+    _hedgingDelay(0),
+    _writeCoalesceCount(0),
+    _writeCoalesceSize(0),
+    _readAheadSize(0),
     _classGraphDepthMax(0),
     _collectObjects(false),
     _toStringMode(ICE_ENUM(ToStringMode, Unicode)),
@@ -1194,6 +1216,105 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
             }
         }
 
+        {
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.BatchAutoFlushDelay", 0);
+            if(num < 0)
+            {
+                Warning out(_initData.logger);
+                out << "invalid value for Ice.BatchAutoFlushDelay `"
+                    << _initData.properties->getProperty("Ice.BatchAutoFlushDelay") << "': defaulting to 0";
+            }
+            else
+            {
+                const_cast<int&>(_batchAutoFlushDelay) = num; // Milliseconds, 0 disables the delayed flush.
+            }
+        }
+
+        {
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.HedgingDelay", 0);
+            if(num < 0)
+            {
+                Warning out(_initData.logger);
+                out << "invalid value for Ice.HedgingDelay `"
+                    << _initData.properties->getProperty("Ice.HedgingDelay") << "': defaulting to 0";
+            }
+            else
+            {
+                const_cast<int&>(_hedgingDelay) = num; // Milliseconds, 0 disables hedging.
+            }
+        }
+
+        const_cast<HedgingPolicyPtr&>(_hedgingPolicy) = new HedgingPolicy(_initData);
+        const_cast<EndpointLoadTablePtr&>(_endpointLoadTable) = new EndpointLoadTable(_initData);
+
+        {
+            static const int defaultValue = 16;
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.WriteCoalesceCount", defaultValue);
+            if(num < 1)
+            {
+                const_cast<size_t&>(_writeCoalesceCount) = 1; // Coalescing disabled.
+            }
+            else
+            {
+                const_cast<size_t&>(_writeCoalesceCount) = static_cast<size_t>(num);
+            }
+        }
+
+        {
+            static const int defaultValue = 256;
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.WriteCoalesceSize", defaultValue);
+            if(num < 1 || static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                const_cast<size_t&>(_writeCoalesceSize) = static_cast<size_t>(0x7fffffff);
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                const_cast<size_t&>(_writeCoalesceSize) = static_cast<size_t>(num) * 1024;
+            }
+        }
+
+        {
+            static const int defaultValue = 64;
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.ReadAheadSize", defaultValue);
+            if(num < 1)
+            {
+                const_cast<size_t&>(_readAheadSize) = 0; // Read-ahead disabled.
+            }
+            else if(static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                const_cast<size_t&>(_readAheadSize) = static_cast<size_t>(0x7fffffff);
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                const_cast<size_t&>(_readAheadSize) = static_cast<size_t>(num) * 1024;
+            }
+        }
+
+        const_cast<CompressorManagerPtr&>(_compressorManager) =
+            new CompressorManager(_initData.properties, _initData.logger);
+
+        if(_initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool", 1) > 0)
+        {
+            static const int defaultValue = 4096;
+            Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.MaxMemory", defaultValue);
+            if(num < 0)
+            {
+                Warning out(_initData.logger);
+                out << "invalid value for Ice.BufferPool.MaxMemory `"
+                    << _initData.properties->getProperty("Ice.BufferPool.MaxMemory") << "': defaulting to "
+                    << defaultValue;
+                num = defaultValue;
+            }
+            else if(static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                num = 0x7fffffff / 1024;
+            }
+            // Property is in kilobytes, convert in bytes.
+            const_cast<BufferPoolPtr&>(_bufferPool) = new BufferPool(static_cast<size_t>(num) * 1024);
+        }
+
         {
             static const int defaultValue = 100;
             Int num = _initData.properties->getPropertyAsIntWithDefault("Ice.ClassGraphDepthMax", defaultValue);
@@ -1437,6 +1558,12 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
             _initData.observer = observer;
             _adminFacets.insert(make_pair(metricsFacetName, observer->getFacet()));
 
+            if(_bufferPool)
+            {
+                observer->getFacet()->registerMap("BufferPool", _bufferPool->createMetricsMapFactory());
+            }
+            observer->getFacet()->registerMap("EndpointLoad", _endpointLoadTable->createMetricsMapFactory());
+
             //
             // Make sure the metrics admin facet receives property updates.
             //
@@ -1468,7 +1595,26 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
     {
         bool hasPriority = _initData.properties->getProperty("Ice.ThreadPriority") != "";
         int priority = _initData.properties->getPropertyAsInt("Ice.ThreadPriority");
-        if(hasPriority)
+        if(_initData.properties->getPropertyAsInt("Ice.Timer.Wheel") > 0)
+        {
+            int tick = _initData.properties->getPropertyAsIntWithDefault("Ice.Timer.WheelTick", 1);
+            if(tick < 1)
+            {
+                tick = 1;
+                Warning out(_initData.logger);
+                out << "invalid value for Ice.Timer.WheelTick `"
+                    << _initData.properties->getProperty("Ice.Timer.WheelTick") << "': defaulting to 1";
+            }
+            if(hasPriority)
+            {
+                _timer = new Timer(IceUtil::Time::milliSeconds(tick), priority);
+            }
+            else
+            {
+                _timer = new Timer(IceUtil::Time::milliSeconds(tick));
+            }
+        }
+        else if(hasPriority)
         {
             _timer = new Timer(priority);
         }
@@ -1495,6 +1641,16 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
         throw;
     }
 
+#ifndef ICE_OS_UWP
+    {
+        CommunicatorObserverIPtr observer = ICE_DYNAMIC_CAST(CommunicatorObserverI, _initData.observer);
+        if(observer)
+        {
+            observer->getFacet()->registerMap("HostResolver", _endpointHostResolver->cache()->createMetricsMapFactory());
+        }
+    }
+#endif
+
     _clientThreadPool = new ThreadPool(this, "Ice.ThreadPool.Client", 0);
 
     //
@@ -1682,7 +1838,7 @@ IceInternal::Instance::destroy()
 #ifndef ICE_OS_UWP
     if(_endpointHostResolver)
     {
-        _endpointHostResolver->getThreadControl().join();
+        _endpointHostResolver->joinWithAllThreads();
     }
 #endif
 
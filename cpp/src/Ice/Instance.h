@@ -33,10 +33,14 @@
 #include <Ice/EndpointFactoryManagerF.h>
 #include <Ice/IPEndpointIF.h>
 #include <Ice/RetryQueueF.h>
+#include <Ice/HedgingPolicyF.h>
+#include <Ice/EndpointLoadF.h>
 #include <Ice/DynamicLibraryF.h>
 #include <Ice/PluginF.h>
 #include <Ice/NetworkF.h>
 #include <Ice/NetworkProxyF.h>
+#include <Ice/CompressorF.h>
+#include <Ice/BufferPoolF.h>
 #include <Ice/Initialize.h>
 #include <Ice/ImplicitContextI.h>
 #include <Ice/FacetMap.h>
@@ -108,6 +112,15 @@ public:
     Ice::PluginManagerPtr pluginManager() const;
     size_t messageSizeMax() const { return _messageSizeMax; }
     size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
+    int batchAutoFlushDelay() const { return _batchAutoFlushDelay; }
+    int hedgingDelay() const { return _hedgingDelay; }
+    const HedgingPolicyPtr& hedgingPolicy() const { return _hedgingPolicy; }
+    const EndpointLoadTablePtr& endpointLoadTable() const { return _endpointLoadTable; }
+    size_t writeCoalesceCount() const { return _writeCoalesceCount; }
+    size_t writeCoalesceSize() const { return _writeCoalesceSize; }
+    size_t readAheadSize() const { return _readAheadSize; }
+    const CompressorManagerPtr& compressorManager() const { return _compressorManager; }
+    const BufferPoolPtr& bufferPool() const { return _bufferPool; }
     size_t classGraphDepthMax() const { return _classGraphDepthMax; }
     bool collectObjects() const { return _collectObjects; }
     Ice::ToStringMode toStringMode() const { return _toStringMode; }
@@ -177,6 +190,15 @@ private:
     const DefaultsAndOverridesPtr _defaultsAndOverrides; // Immutable, not reset by destroy().
     const size_t _messageSizeMax; // Immutable, not reset by destroy().
     const size_t _batchAutoFlushSize; // Immutable, not reset by destroy().
+    const int _batchAutoFlushDelay; // Immutable, not reset by destroy().
+    const int _hedgingDelay; // Immutable, not reset by destroy().
+    const HedgingPolicyPtr _hedgingPolicy; // Immutable, not reset by destroy().
+    const EndpointLoadTablePtr _endpointLoadTable; // Immutable, not reset by destroy().
+    const size_t _writeCoalesceCount; // Immutable, not reset by destroy().
+    const size_t _writeCoalesceSize; // Immutable, not reset by destroy().
+    const size_t _readAheadSize; // Immutable, not reset by destroy().
+    const CompressorManagerPtr _compressorManager; // Immutable, not reset by destroy().
+    const BufferPoolPtr _bufferPool; // Immutable, not reset by destroy().
     const size_t _classGraphDepthMax; // Immutable, not reset by destroy().
     const bool _collectObjects; // Immutable, not reset by destroy().
     const Ice::ToStringMode _toStringMode; // Immutable, not reset by destroy()
@@ -805,6 +805,13 @@ ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
 
 }
 
+void
+ThreadObserverI::dispatched(Long waitTime)
+{
+    forEach(inc(&ThreadMetrics::dispatched));
+    forEach(add(&ThreadMetrics::queueWaitTime, waitTime));
+}
+
 void
 DispatchObserverI::userException()
 {
@@ -815,6 +822,18 @@ DispatchObserverI::userException()
     }
 }
 
+void
+DispatchObserverI::expired()
+{
+    forEach(inc(&DispatchMetrics::expired));
+}
+
+void
+DispatchObserverI::rejected()
+{
+    forEach(inc(&DispatchMetrics::rejected));
+}
+
 void
 DispatchObserverI::reply(Int size)
 {
@@ -865,6 +884,24 @@ InvocationObserverI::userException()
     }
 }
 
+void
+InvocationObserverI::batchRequests(Int num)
+{
+    forEach(add(&InvocationMetrics::batchRequests, num));
+}
+
+void
+InvocationObserverI::hedged()
+{
+    forEach(inc(&InvocationMetrics::hedged));
+}
+
+void
+InvocationObserverI::hedgeWon()
+{
+    forEach(inc(&InvocationMetrics::hedgeWins));
+}
+
 RemoteObserverPtr
 InvocationObserverI::getRemoteObserver(const ConnectionInfoPtr& connection,
                                        const EndpointPtr& endpoint,
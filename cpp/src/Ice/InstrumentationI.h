@@ -165,6 +165,8 @@ class ThreadObserverI : public ObserverWithDelegateT<IceMX::ThreadMetrics, Ice::
 public:
 
     virtual void stateChanged(Ice::Instrumentation::ThreadState, Ice::Instrumentation::ThreadState);
+
+    void dispatched(Ice::Long);
 };
 
 class DispatchObserverI : public ObserverWithDelegateT<IceMX::DispatchMetrics, Ice::Instrumentation::DispatchObserver>
@@ -174,6 +176,10 @@ public:
     virtual void userException();
 
     virtual void reply(Ice::Int);
+
+    void expired();
+
+    void rejected();
 };
 
 class RemoteObserverI : public ObserverWithDelegateT<IceMX::RemoteMetrics, Ice::Instrumentation::RemoteObserver>
@@ -200,6 +206,10 @@ public:
 
     virtual void userException();
 
+    void batchRequests(Ice::Int);
+    void hedged();
+    void hedgeWon();
+
     virtual Ice::Instrumentation::RemoteObserverPtr
     getRemoteObserver(const Ice::ConnectionInfoPtr&, const Ice::EndpointPtr&, Ice::Int, Ice::Int);
 
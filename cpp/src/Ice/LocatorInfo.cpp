@@ -608,6 +608,33 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
     }
 }
 
+bool
+IceInternal::LocatorInfo::getCachedEndpoints(const ReferencePtr& ref, int ttl, vector<EndpointIPtr>& endpoints)
+{
+    assert(ref->isIndirect());
+    if(!ref->isWellKnown())
+    {
+        return _table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints);
+    }
+
+    ReferencePtr r;
+    if(!_table->getObjectReference(ref->getIdentity(), ttl, r))
+    {
+        return false;
+    }
+
+    if(!r->isIndirect())
+    {
+        endpoints = r->getEndpoints();
+        return true;
+    }
+    else if(!r->isWellKnown())
+    {
+        return getCachedEndpoints(r, ttl, endpoints);
+    }
+    return false;
+}
+
 void
 IceInternal::LocatorInfo::clearCache(const ReferencePtr& ref)
 {
@@ -164,6 +164,12 @@ public:
     }
     void getEndpoints(const ReferencePtr&, const ReferencePtr&, int, const GetEndpointsCallbackPtr&);
 
+    //
+    // Returns true and the endpoints of the reference if they are in
+    // the locator cache and didn't expire, the locator isn't queried.
+    //
+    bool getCachedEndpoints(const ReferencePtr&, int, std::vector<EndpointIPtr>&);
+
     void clearCache(const ReferencePtr&);
 
 private:
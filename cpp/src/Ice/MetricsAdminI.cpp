@@ -492,6 +492,21 @@ MetricsAdminI::updateViews()
     }
 }
 
+void
+MetricsAdminI::registerMap(const std::string& map, const MetricsMapFactoryPtr& factory)
+{
+    bool updated;
+    {
+        Lock sync(*this);
+        _factories[map] = factory;
+        updated = addOrUpdateMap(map, factory);
+    }
+    if(updated)
+    {
+        factory->update();
+    }
+}
+
 void
 MetricsAdminI::unregisterMap(const std::string& mapName)
 {
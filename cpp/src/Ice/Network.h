@@ -60,6 +60,25 @@ typedef int ssize_t;
 #   define ICE_USE_POLL 1
 #endif
 
+//
+// On Linux, the epoll selector uses io_uring when the kernel headers provide it. The
+// io_uring support is checked at runtime and the selector falls back to epoll if the
+// kernel doesn't support it.
+//
+#if defined(ICE_USE_EPOLL) && !defined(ICE_NO_IO_URING) && defined(__has_include)
+#   if __has_include(<linux/io_uring.h>)
+#      define ICE_USE_IO_URING 1
+#   endif
+#endif
+
+//
+// On Linux, the UDP transceiver sends and receives several datagrams with a single system
+// call using sendmmsg and recvmmsg.
+//
+#if defined(__linux) && !defined(ICE_NO_MMSG)
+#   define ICE_USE_MMSG 1
+#endif
+
 #if defined(_WIN32) || defined(__osf__)
 typedef int socklen_t;
 #endif
@@ -273,6 +292,9 @@ ICE_API bool noMoreFds(int);
 ICE_API std::string errorToStringDNS(int);
 ICE_API std::vector<Address> getAddresses(const std::string&, int, ProtocolSupport, Ice::EndpointSelectionType, bool,
                                           bool);
+#ifndef ICE_OS_UWP
+ICE_API void sortAddresses(std::vector<Address>&, ProtocolSupport, Ice::EndpointSelectionType, bool);
+#endif
 ICE_API ProtocolSupport getProtocolSupport(const Address&);
 ICE_API Address getAddressForServer(const std::string&, int, ProtocolSupport, bool, bool);
 ICE_API int compareAddress(const Address&, const Address&);
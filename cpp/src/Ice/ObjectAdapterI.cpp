@@ -19,6 +19,7 @@
 #include <Ice/EndpointFactoryManager.h>
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ServantManager.h>
+#include <Ice/AdmissionController.h>
 #include <Ice/RouterInfo.h>
 #include <Ice/LocalException.h>
 #include <Ice/Properties.h>
@@ -1047,6 +1048,16 @@ Ice::ObjectAdapterI::initialize(const RouterPrxPtr& router)
             _threadPool = new ThreadPool(_instance, _name + ".ThreadPool", 0);
         }
 
+        //
+        // Create the admission controller if it's configured, it rejects
+        // the requests queued for dispatch when the adapter falls behind.
+        //
+        if(properties->getPropertyAsInt(_name + ".AdmissionControl.Target") > 0 ||
+           properties->getPropertyAsInt(_name + ".AdmissionControl.MaxQueue") > 0)
+        {
+            _servantManager->setAdmissionController(new AdmissionController(_instance, _name, getThreadPool()));
+        }
+
         if(!router)
         {
             const_cast<RouterPrxPtr&>(router) = ICE_UNCHECKED_CAST(RouterPrx,
@@ -1473,6 +1484,11 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ACM.Heartbeat",
         "ACM.Timeout",
         "AdapterId",
+        "AdmissionControl.Target",
+        "AdmissionControl.Interval",
+        "AdmissionControl.MaxQueue",
+        "AdmissionControl.PriorityOperations",
+        "AdmissionControl.PriorityContext",
         "Endpoints",
         "Locator",
         "Locator.EncodingVersion",
@@ -1505,7 +1521,10 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "ThreadPool.SizeWarn",
         "ThreadPool.StackSize",
         "ThreadPool.Serialize",
-        "ThreadPool.ThreadPriority"
+        "ThreadPool.ThreadPriority",
+        "ThreadPool.Reactors",
+        "ThreadPool.ReactorWorkStealing",
+        "ThreadPool.DispatchThreads"
     };
 
     //
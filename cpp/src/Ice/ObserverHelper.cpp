@@ -11,6 +11,7 @@
 #include <Ice/Reference.h>
 #include <Ice/Instance.h>
 #include <Ice/Proxy.h>
+#include <Ice/InstrumentationI.h>
 
 using namespace std;
 using namespace Ice;
@@ -59,3 +60,61 @@ IceInternal::InvocationObserver::attach(IceInternal::Instance* instance, const s
 
     attach(obsv->getInvocationObserver(0, op, Ice::noExplicitContext));
 }
+
+void
+IceInternal::DispatchObserver::expired()
+{
+    //
+    // See batchRequests() below.
+    //
+    IceInternal::DispatchObserverI* observer = dynamic_cast<IceInternal::DispatchObserverI*>(_observer.get());
+    if(observer)
+    {
+        observer->expired();
+    }
+}
+
+void
+IceInternal::DispatchObserver::rejected()
+{
+    IceInternal::DispatchObserverI* observer = dynamic_cast<IceInternal::DispatchObserverI*>(_observer.get());
+    if(observer)
+    {
+        observer->rejected();
+    }
+}
+
+void
+IceInternal::InvocationObserver::batchRequests(int num)
+{
+    //
+    // The number of flushed batch requests is only recorded by the
+    // metrics of the built-in observer, it's not part of the
+    // instrumentation interface.
+    //
+    IceInternal::InvocationObserverI* observer = dynamic_cast<IceInternal::InvocationObserverI*>(_observer.get());
+    if(observer)
+    {
+        observer->batchRequests(num);
+    }
+}
+
+void
+IceInternal::InvocationObserver::hedged()
+{
+    IceInternal::InvocationObserverI* observer = dynamic_cast<IceInternal::InvocationObserverI*>(_observer.get());
+    if(observer)
+    {
+        observer->hedged();
+    }
+}
+
+void
+IceInternal::InvocationObserver::hedgeWon()
+{
+    IceInternal::InvocationObserverI* observer = dynamic_cast<IceInternal::InvocationObserverI*>(_observer.get());
+    if(observer)
+    {
+        observer->hedgeWon();
+    }
+}
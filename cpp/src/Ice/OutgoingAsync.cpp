@@ -20,6 +20,12 @@
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/LoggerUtil.h>
+#include <Ice/TraceLevels.h>
+#include <Ice/Incoming.h>
+#include <Ice/HedgingPolicy.h>
+#include <Ice/EndpointLoad.h>
+#include <Ice/ProxyFactory.h>
+#include <IceUtil/OutputUtil.h>
 
 using namespace std;
 using namespace Ice;
@@ -31,6 +37,139 @@ IceUtil::Shared* IceInternal::upCast(ProxyOutgoingAsyncBase* p) { return p; }
 IceUtil::Shared* IceInternal::upCast(OutgoingAsync* p) { return p; }
 #endif
 
+namespace
+{
+
+class HedgeTimerTask : public IceUtil::TimerTask
+{
+public:
+
+    HedgeTimerTask(const ProxyOutgoingAsyncBasePtr& outAsync) : _outAsync(outAsync)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _outAsync->sendHedge();
+    }
+
+private:
+
+    const ProxyOutgoingAsyncBasePtr _outAsync;
+};
+
+class CancelHedgeTimerTask : public IceUtil::TimerTask
+{
+public:
+
+    CancelHedgeTimerTask(const ProxyOutgoingAsyncBasePtr& outAsync) : _outAsync(outAsync)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        _outAsync->cancel();
+    }
+
+private:
+
+    const ProxyOutgoingAsyncBasePtr _outAsync;
+};
+
+//
+// Invocation timeouts and cancellations aren't failures of the endpoint
+// of the request, the elapsed time is the latency of the request.
+//
+bool
+isEndpointFailure(const Exception& ex)
+{
+    return !dynamic_cast<const InvocationTimeoutException*>(&ex) &&
+        !dynamic_cast<const InvocationCanceledException*>(&ex);
+}
+
+//
+// The hedged request of an invocation. It sends a copy of the request
+// of the invocation and completes the invocation if it receives a reply
+// first. It's not retried and its failures are ignored, like the replies
+// other than OK and user exception replies.
+//
+class HedgeOutgoingAsync : public OutgoingAsync
+{
+public:
+
+    HedgeOutgoingAsync(const ObjectPrxPtr& proxy, const ProxyOutgoingAsyncBasePtr& outAsync,
+                       OutgoingAsync& request) :
+        OutgoingAsync(proxy, false),
+        _outAsync(outAsync)
+    {
+        copyRequest(request);
+    }
+
+    virtual bool
+    response()
+    {
+        if(_is.i == _is.b.end() || (*_is.i != replyOK && *_is.i != replyUserException))
+        {
+            return false;
+        }
+        return _outAsync->completeHedge(true);
+    }
+
+    virtual bool
+    exception(const Exception& ex)
+    {
+        return exceptionImpl(ex);
+    }
+
+    virtual void
+    endpointSelected(const EndpointLoadPtr&)
+    {
+        // The hedged request doesn't complete when its reply is received, it doesn't update the endpoint loads.
+    }
+
+    virtual bool
+    handleSent(bool, bool)
+    {
+        return false;
+    }
+
+    virtual bool
+    handleException(const Exception&)
+    {
+        return false;
+    }
+
+    virtual bool
+    handleResponse(bool)
+    {
+        return true;
+    }
+
+    virtual void
+    handleInvokeSent(bool, OutgoingAsyncBase*) const
+    {
+    }
+
+    virtual void
+    handleInvokeException(const Exception&, OutgoingAsyncBase*) const
+    {
+    }
+
+    virtual void
+    handleInvokeResponse(bool, OutgoingAsyncBase* outAsync) const
+    {
+        _outAsync->hedgeResponse(*outAsync->getIs());
+    }
+
+private:
+
+    const ProxyOutgoingAsyncBasePtr _outAsync;
+};
+
+}
+
 const unsigned char OutgoingAsyncBase::OK = 0x1;
 const unsigned char OutgoingAsyncBase::Sent = 0x2;
 #ifndef ICE_CPP11_MAPPING
@@ -601,6 +740,13 @@ ProxyOutgoingAsyncBase::exception(const Exception& exc)
         _childObserver.detach();
     }
 
+    endpointLoadCompleted(isEndpointFailure(exc));
+
+    if(hedgeWon())
+    {
+        return false; // The invocation completed with the reply of the hedged request.
+    }
+
     _cachedConnection = 0;
     if(_proxy->_getReference()->getInvocationTimeout() == -2)
     {
@@ -708,8 +854,11 @@ ProxyOutgoingAsyncBase::ProxyOutgoingAsyncBase(const ObjectPrxPtr& prx) :
     OutgoingAsyncBase(prx->_getReference()->getInstance()),
     _proxy(prx),
     _mode(ICE_ENUM(OperationMode, Normal)),
+    _deadlineTimeout(0),
     _cnt(0),
-    _sent(false)
+    _sent(false),
+    _hedgeCompleted(false),
+    _hedgeWon(false)
 {
 }
 
@@ -725,6 +874,10 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
         if(userThread)
         {
             int invocationTimeout = _proxy->_getReference()->getInvocationTimeout();
+            if(_deadlineTimeout > 0 && (invocationTimeout <= 0 || _deadlineTimeout < invocationTimeout))
+            {
+                invocationTimeout = _deadlineTimeout;
+            }
             if(invocationTimeout > 0)
             {
                 _instance->timer()->schedule(ICE_SHARED_FROM_THIS, IceUtil::Time::milliSeconds(invocationTimeout));
@@ -773,6 +926,12 @@ ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
                     _childObserver.failed(ex.ice_id());
                     _childObserver.detach();
                 }
+
+                //
+                // Update the load of the endpoint before the retry selects
+                // an endpoint again.
+                //
+                endpointLoadCompleted(isEndpointFailure(ex));
                 int interval = _proxy->_handleException(ex, _handler, _mode, _sent, _cnt);
                 if(interval > 0)
                 {
@@ -809,7 +968,7 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
     _sent = true;
     if(done)
     {
-        if(_proxy->_getReference()->getInvocationTimeout() != -1)
+        if(hasTimeout())
         {
             _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
         }
@@ -820,7 +979,12 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
 bool
 ProxyOutgoingAsyncBase::exceptionImpl(const Exception& ex)
 {
-    if(_proxy->_getReference()->getInvocationTimeout() != -1)
+    endpointLoadCompleted(isEndpointFailure(ex));
+    if(!completeHedge(false))
+    {
+        return false; // The invocation completed with the reply of the hedged request.
+    }
+    if(hasTimeout())
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
@@ -830,13 +994,269 @@ ProxyOutgoingAsyncBase::exceptionImpl(const Exception& ex)
 bool
 ProxyOutgoingAsyncBase::responseImpl(bool ok)
 {
-    if(_proxy->_getReference()->getInvocationTimeout() != -1)
+    if(hasTimeout())
     {
         _instance->timer()->cancel(ICE_SHARED_FROM_THIS);
     }
+    if(_hedgeTask)
+    {
+        _instance->hedgingPolicy()->latency(_hedgeOperation,
+                                            IceUtil::Time::now(IceUtil::Time::Monotonic) - _hedgeStart);
+    }
+    endpointLoadCompleted(false);
     return OutgoingAsyncBase::responseImpl(ok);
 }
 
+bool
+ProxyOutgoingAsyncBase::hasTimeout() const
+{
+    return _proxy->_getReference()->getInvocationTimeout() != -1 || _deadlineTimeout > 0;
+}
+
+void
+ProxyOutgoingAsyncBase::endpointSelected(const EndpointLoadPtr& load)
+{
+    //
+    // If the previous attempt raised a RetryException, its load wasn't
+    // updated yet.
+    //
+    endpointLoadCompleted(true);
+    _endpointLoad = load;
+    _endpointLoadStart = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    load->sent();
+}
+
+void
+ProxyOutgoingAsyncBase::endpointLoadCompleted(bool failed)
+{
+    if(!_endpointLoad)
+    {
+        return;
+    }
+
+    const IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    EndpointLoadPtr load;
+    load.swap(_endpointLoad);
+    load->completed(now, now - _endpointLoadStart, failed);
+}
+
+bool
+ProxyOutgoingAsyncBase::hedgeWon()
+{
+    if(!_hedgeTask)
+    {
+        return false;
+    }
+    Lock sync(_m);
+    return _hedgeWon;
+}
+
+void
+ProxyOutgoingAsyncBase::scheduleHedge(const string& operation)
+{
+    //
+    // Only two-way invocations of idempotent operations are hedged, with
+    // direct proxies with several endpoints or indirect proxies.
+    //
+    const ReferencePtr& ref = _proxy->_getReference();
+    if(ref->getHedgingDelay() <= 0 || _mode == ICE_ENUM(OperationMode, Normal) ||
+       ref->getMode() != Reference::ModeTwoway || ref->getRouterInfo())
+    {
+        return;
+    }
+    if(ref->isIndirect() ? !ref->getLocatorInfo() : ref->getEndpoints().size() < 2)
+    {
+        return;
+    }
+
+    //
+    // The hedging timer task is set before the request is sent and isn't
+    // modified afterwards, it's read without locking.
+    //
+    IceUtil::Time delay = _instance->hedgingPolicy()->delay(operation, ref->getHedgingDelay());
+    _hedgeOperation = operation;
+    _hedgeStart = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    _hedgeTask = ICE_MAKE_SHARED(HedgeTimerTask, ICE_SHARED_FROM_THIS);
+    _instance->timer()->schedule(_hedgeTask, delay);
+}
+
+ProxyOutgoingAsyncBasePtr
+ProxyOutgoingAsyncBase::createHedge(const ObjectPrxPtr&)
+{
+    return 0;
+}
+
+void
+ProxyOutgoingAsyncBase::sendHedge()
+{
+    //
+    // The hedged request is only sent if the request was sent over a
+    // connection and the invocation didn't complete yet.
+    //
+    CancellationHandlerPtr handler;
+    {
+        Lock sync(_m);
+        if(_hedgeCompleted || !(_state & Sent))
+        {
+            return;
+        }
+        handler = _cancellationHandler;
+    }
+    ConnectionIPtr connection = ICE_DYNAMIC_CAST(ConnectionI, handler);
+    if(!connection)
+    {
+        return;
+    }
+
+    try
+    {
+        //
+        // The hedged request is sent to the other endpoints of a direct
+        // proxy. With an indirect proxy, it's sent over a separate
+        // connection, the endpoint is selected like for the request.
+        //
+        ReferencePtr ref = _proxy->_getReference();
+        if(ref->isIndirect())
+        {
+            ref = ref->changeConnectionId(ref->getConnectionId() + "-hedge");
+        }
+        else
+        {
+            vector<EndpointIPtr> endpoints = ref->getEndpoints();
+            for(vector<EndpointIPtr>::iterator p = endpoints.begin(); p != endpoints.end();)
+            {
+                if((*p)->equivalent(connection->endpoint()))
+                {
+                    p = endpoints.erase(p);
+                }
+                else
+                {
+                    ++p;
+                }
+            }
+            if(endpoints.empty())
+            {
+                return;
+            }
+            ref = ref->changeEndpoints(endpoints);
+        }
+
+        if(!_instance->hedgingPolicy()->acquire())
+        {
+            return; // Sending the hedged request would exceed the maximum load.
+        }
+
+        ProxyOutgoingAsyncBasePtr hedge =
+            createHedge(_instance->proxyFactory()->referenceToProxy(ref->changeInvocationTimeout(-1)));
+        if(!hedge)
+        {
+            return;
+        }
+
+        {
+            Lock sync(_m);
+            if(_hedgeCompleted)
+            {
+                return;
+            }
+            _hedge = hedge;
+            _observer.hedged();
+        }
+
+        if(_instance->traceLevels()->retry >= 1)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->retryCat);
+            out << "sending hedged request for operation `" << _hedgeOperation << "' after "
+                << (IceUtil::Time::now(IceUtil::Time::Monotonic) - _hedgeStart).toMilliSeconds() << "ms";
+        }
+        hedge->invokeImpl(false);
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+    }
+}
+
+bool
+ProxyOutgoingAsyncBase::completeHedge(bool hedge)
+{
+    if(!_hedgeTask)
+    {
+        return true;
+    }
+
+    ProxyOutgoingAsyncBasePtr loser;
+    {
+        Lock sync(_m);
+        if(_hedgeCompleted)
+        {
+            //
+            // Once the request completed the invocation, it can still be
+            // retried. The replies of the request are ignored once the
+            // hedged request completed the invocation.
+            //
+            return !hedge && !_hedgeWon;
+        }
+        _hedgeCompleted = true;
+        _hedgeWon = hedge;
+        if(hedge)
+        {
+            _observer.hedgeWon();
+        }
+        else
+        {
+            loser = _hedge;
+        }
+        _hedge = 0;
+    }
+
+    //
+    // The pending hedged request is canceled from the timer thread, this
+    // can be called with the connection of the request locked.
+    //
+    try
+    {
+        _instance->timer()->cancel(_hedgeTask);
+        if(loser)
+        {
+            _instance->timer()->schedule(ICE_MAKE_SHARED(CancelHedgeTimerTask, loser), IceUtil::Time());
+        }
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+    }
+    return true;
+}
+
+void
+ProxyOutgoingAsyncBase::hedgeResponse(InputStream& is)
+{
+    //
+    // Cancel the request first, the connection of the request no longer
+    // uses the input stream of the invocation once it's canceled.
+    //
+    CancellationHandlerPtr handler;
+    {
+        Lock sync(_m);
+        handler = _cancellationHandler;
+    }
+    if(handler)
+    {
+        handler->asyncRequestCanceled(ICE_SHARED_FROM_THIS, InvocationCanceledException(__FILE__, __LINE__));
+    }
+
+    _is.swap(is);
+    Byte replyStatus;
+    _is.read(replyStatus);
+    if(replyStatus == replyUserException)
+    {
+        _observer.userException();
+    }
+    if(responseImpl(replyStatus == replyOK))
+    {
+        invokeResponse();
+    }
+}
+
 void
 ProxyOutgoingAsyncBase::runTimerTask()
 {
@@ -853,7 +1273,10 @@ ProxyOutgoingAsyncBase::runTimerTask()
 OutgoingAsync::OutgoingAsync(const ObjectPrxPtr& prx, bool synchronous) :
     ProxyOutgoingAsyncBase(prx),
     _encoding(getCompatibleEncoding(prx->_getReference()->getEncoding())),
-    _synchronous(synchronous)
+    _synchronous(synchronous),
+    _requestDeadline(0),
+    _requestContextStart(0),
+    _requestContextEnd(0)
 {
 }
 
@@ -904,6 +1327,39 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
 
     _os.write(static_cast<Byte>(_mode));
 
+    //
+    // Twoway requests carry the remaining time of their invocation timeout,
+    // this is the smallest of the proxy invocation timeout and of the
+    // remaining time of the deadline of the request dispatched by this
+    // thread. The server doesn't dispatch the request once it expired.
+    //
+    Long deadline = 0;
+    if(ref->getMode() == Reference::ModeTwoway && ref->getInvocationTimeout() != -2)
+    {
+        Long now = IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+        if(ref->getInvocationTimeout() > 0)
+        {
+            deadline = now + ref->getInvocationTimeout();
+        }
+        Long dispatchDeadline = getDispatchDeadline();
+        if(dispatchDeadline > 0)
+        {
+            _deadlineTimeout = dispatchDeadline > now ? static_cast<int>(dispatchDeadline - now) : 1;
+            if(deadline == 0 || dispatchDeadline < deadline)
+            {
+                deadline = dispatchDeadline;
+            }
+        }
+    }
+
+    writeContext(context, deadline);
+}
+
+void
+OutgoingAsync::writeContext(const Context& context, Long deadline)
+{
+    Reference* ref = _proxy->_getReference().get();
+
 #if defined(_MSC_VER) && (_MSC_VER <= 1600)
     //
     // COMPILERFIX VC90 and VC100 get confused with namespaces and we need to
@@ -919,7 +1375,12 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         //
         // Explicit context
         //
-        _os.write(context);
+        if(deadline == 0)
+        {
+            _os.write(context);
+            return;
+        }
+        _requestContext = context;
     }
     else
     {
@@ -928,15 +1389,89 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         //
         const ImplicitContextIPtr& implicitContext = ref->getInstance()->getImplicitContext();
         const Context& prxContext = ref->getContext()->getValue();
+        if(deadline == 0)
+        {
+            if(implicitContext == 0)
+            {
+                _os.write(prxContext);
+            }
+            else
+            {
+                implicitContext->write(prxContext, &_os);
+            }
+            return;
+        }
+
         if(implicitContext == 0)
         {
-            _os.write(prxContext);
+            _requestContext = prxContext;
         }
         else
         {
-            implicitContext->write(prxContext, &_os);
+            implicitContext->combine(prxContext, _requestContext);
         }
     }
+
+    //
+    // The context entry with the remaining time is written here and it's
+    // updated when the request is sent, see updateDeadline.
+    //
+    _requestDeadline = deadline;
+    _requestContext[deadlineContextKey] =
+        IceUtilInternal::int64ToString(max(deadline - IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds(),
+                                           static_cast<Long>(1)));
+    _requestContextStart = _os.b.size();
+    _os.write(_requestContext);
+    _requestContextEnd = _os.b.size();
+}
+
+void
+OutgoingAsync::updateDeadline()
+{
+    if(_requestDeadline == 0)
+    {
+        return;
+    }
+
+    //
+    // Re-marshal the request if the remaining time of the invocation timeout
+    // changed since the request was marshaled, for instance if the request is
+    // retried or if it was queued while the connection was established.
+    //
+    Long now = IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+    string timeout = IceUtilInternal::int64ToString(max(_requestDeadline - now, static_cast<Long>(1)));
+
+    //
+    // The request is locked, a hedged request can copy it from the timer
+    // thread while the invocation is retried.
+    //
+    Lock sync(_m);
+    string& value = _requestContext[deadlineContextKey];
+    if(value == timeout)
+    {
+        return;
+    }
+    value = timeout;
+
+    OutputStream os(_instance.get(), Ice::currentProtocolEncoding);
+    os.writeBlob(_os.b.begin(), _requestContextStart);
+    os.write(_requestContext);
+    size_t end = os.b.size();
+    os.writeBlob(_os.b.begin() + _requestContextEnd, _os.b.size() - _requestContextEnd);
+    _os.swap(os);
+    _requestContextEnd = end;
+}
+
+void
+OutgoingAsync::copyRequest(OutgoingAsync& request)
+{
+    Lock sync(request._m);
+    _mode = request._mode;
+    _os.writeBlob(request._os.b.begin(), request._os.b.size());
+    _requestDeadline = request._requestDeadline;
+    _requestContext = request._requestContext;
+    _requestContextStart = request._requestContextStart;
+    _requestContextEnd = request._requestContextEnd;
 }
 
 bool
@@ -961,6 +1496,11 @@ OutgoingAsync::response()
         _childObserver.detach();
     }
 
+    if(!completeHedge(false))
+    {
+        return false; // The invocation completed with the reply of the hedged request.
+    }
+
     Byte replyStatus;
     try
     {
@@ -1094,15 +1634,23 @@ AsyncStatus
 OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
 {
     _cachedConnection = connection;
+    updateDeadline();
     return connection->sendAsyncRequest(ICE_SHARED_FROM_THIS, compress, response, 0);
 }
 
 AsyncStatus
 OutgoingAsync::invokeCollocated(CollocatedRequestHandler* handler)
 {
+    updateDeadline();
     return handler->invokeAsyncRequest(this, 0, _synchronous);
 }
 
+ProxyOutgoingAsyncBasePtr
+OutgoingAsync::createHedge(const ObjectPrxPtr& proxy)
+{
+    return ICE_MAKE_SHARED(HedgeOutgoingAsync, proxy, ICE_SHARED_FROM_THIS, *this);
+}
+
 void
 OutgoingAsync::abort(const Exception& ex)
 {
@@ -1137,6 +1685,7 @@ OutgoingAsync::invoke(const string& operation)
     // try block with the catch block calling abort(ex) in case of an
     // exception.
     //
+    scheduleHedge(operation);
     invokeImpl(true); // userThread = true
 }
 
@@ -135,6 +135,11 @@ Ice::OutputStream::initialize(Instance* instance, const EncodingVersion& encodin
     _instance = instance;
     _encoding = encoding;
 
+    if(_instance->bufferPool())
+    {
+        b.setPool(_instance->bufferPool());
+    }
+
     _format = _instance->defaultsAndOverrides()->defaultFormat;
 }
 
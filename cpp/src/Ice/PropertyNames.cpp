@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ..\config\PropertyNames.xml, Mon Mar 27 16:51:58 2017
+// Generated by makeprops.py from file ../config/PropertyNames.xml, Sat Oct 17 09:07:13 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -28,17 +28,27 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ACM.Server.Heartbeat", false, 0),
     IceInternal::Property("Ice.ACM.Server.Close", false, 0),
     IceInternal::Property("Ice.ACM.Server", false, 0),
+    IceInternal::Property("Ice.AdaptiveSelection.DecayTime", false, 0),
     IceInternal::Property("Ice.Admin.ACM.Timeout", false, 0),
     IceInternal::Property("Ice.Admin.ACM.Heartbeat", false, 0),
     IceInternal::Property("Ice.Admin.ACM.Close", false, 0),
     IceInternal::Property("Ice.Admin.ACM", false, 0),
     IceInternal::Property("Ice.Admin.AdapterId", false, 0),
+    IceInternal::Property("Ice.Admin.AdmissionControl.Target", false, 0),
+    IceInternal::Property("Ice.Admin.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("Ice.Admin.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("Ice.Admin.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("Ice.Admin.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("Ice.Admin.Endpoints", false, 0),
     IceInternal::Property("Ice.Admin.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Admin.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Admin.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Admin.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.HedgingDelay", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Router", false, 0),
     IceInternal::Property("Ice.Admin.Locator.CollocationOptimized", false, 0),
@@ -50,7 +60,11 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Router.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Admin.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Router.ParallelConnect", false, 0),
+    IceInternal::Property("Ice.Admin.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Admin.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Ice.Admin.Router.HedgingDelay", false, 0),
     IceInternal::Property("Ice.Admin.Router.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Router.Router", false, 0),
     IceInternal::Property("Ice.Admin.Router.CollocationOptimized", false, 0),
@@ -64,6 +78,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Enabled", false, 0),
@@ -75,15 +92,22 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ServerId", false, 0),
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", true, 0),
+    IceInternal::Property("Ice.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Ice.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.BufferPool", false, 0),
+    IceInternal::Property("Ice.BufferPool.MaxMemory", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
     IceInternal::Property("Ice.ClassGraphDepthMax", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
+    IceInternal::Property("Ice.Compression.Codecs", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
+    IceInternal::Property("Ice.Compression.MinSize", false, 0),
     IceInternal::Property("Ice.CollectObjects", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
+    IceInternal::Property("Ice.ConnectionPoolSelection", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Default.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
     IceInternal::Property("Ice.Default.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Host", false, 0),
@@ -91,7 +115,11 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Default.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("Ice.Default.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Ice.Default.Locator.HedgingDelay", false, 0),
     IceInternal::Property("Ice.Default.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Default.Locator.Router", false, 0),
     IceInternal::Property("Ice.Default.Locator.CollocationOptimized", false, 0),
@@ -100,13 +128,18 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.InvocationTimeout", false, 0),
     IceInternal::Property("Ice.Default.Package", false, 0),
+    IceInternal::Property("Ice.Default.ParallelConnect", false, 0),
     IceInternal::Property("Ice.Default.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Protocol", false, 0),
     IceInternal::Property("Ice.Default.Router.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Router.ConnectionCached", false, 0),
     IceInternal::Property("Ice.Default.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Router.ParallelConnect", false, 0),
+    IceInternal::Property("Ice.Default.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Ice.Default.Router.HedgingDelay", false, 0),
     IceInternal::Property("Ice.Default.Router.Locator", false, 0),
     IceInternal::Property("Ice.Default.Router.Router", false, 0),
     IceInternal::Property("Ice.Default.Router.CollocationOptimized", false, 0),
@@ -117,10 +150,17 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Timeout", false, 0),
     IceInternal::Property("Ice.EventLog.Source", false, 0),
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
+    IceInternal::Property("Ice.HedgingDelay", false, 0),
+    IceInternal::Property("Ice.HedgingMaxLoad", false, 0),
+    IceInternal::Property("Ice.HedgingPercentile", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
     IceInternal::Property("Ice.HTTPProxyPort", false, 0),
+    IceInternal::Property("Ice.HostResolver.CacheTTL", false, 0),
+    IceInternal::Property("Ice.HostResolver.NegativeCacheTTL", false, 0),
+    IceInternal::Property("Ice.HostResolver.Threads", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
     IceInternal::Property("Ice.InitPlugins", false, 0),
+    IceInternal::Property("Ice.IoUring", false, 0),
     IceInternal::Property("Ice.IPv4", false, 0),
     IceInternal::Property("Ice.IPv6", false, 0),
     IceInternal::Property("Ice.LogFile", false, 0),
@@ -135,6 +175,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Override.Timeout", false, 0),
     IceInternal::Property("Ice.Override.Secure", false, 0),
     IceInternal::Property("Ice.Package.*", false, 0),
+    IceInternal::Property("Ice.ParallelConnectDelay", false, 0),
     IceInternal::Property("Ice.Plugin.*", false, 0),
     IceInternal::Property("Ice.PluginLoadOrder", false, 0),
     IceInternal::Property("Ice.PreferIPv6Address", false, 0),
@@ -143,6 +184,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.PrintProcessId", false, 0),
     IceInternal::Property("Ice.PrintStackTraces", false, 0),
     IceInternal::Property("Ice.ProgramName", false, 0),
+    IceInternal::Property("Ice.ReadAheadSize", false, 0),
     IceInternal::Property("Ice.RetryIntervals", false, 0),
     IceInternal::Property("Ice.ServerIdleTime", false, 0),
     IceInternal::Property("Ice.SOCKSProxyHost", false, 0),
@@ -157,6 +199,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactors", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.ReactorWorkStealing", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.DispatchThreads", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
@@ -164,7 +209,12 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Server.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactors", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.ReactorWorkStealing", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.DispatchThreads", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Timer.Wheel", false, 0),
+    IceInternal::Property("Ice.Timer.WheelTick", false, 0),
     IceInternal::Property("Ice.ToStringMode", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Logger", false, 0),
@@ -174,6 +224,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Trace.Retry", false, 0),
     IceInternal::Property("Ice.Trace.Slicing", false, 0),
     IceInternal::Property("Ice.Trace.ThreadPool", false, 0),
+    IceInternal::Property("Ice.UDP.RcvBatchSize", false, 0),
     IceInternal::Property("Ice.UDP.RcvSize", false, 0),
     IceInternal::Property("Ice.UDP.SndSize", false, 0),
     IceInternal::Property("Ice.TCP.Backlog", false, 0),
@@ -188,6 +239,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Warn.Endpoints", false, 0),
     IceInternal::Property("Ice.Warn.UnknownProperties", false, 0),
     IceInternal::Property("Ice.Warn.UnusedProperties", false, 0),
+    IceInternal::Property("Ice.WriteCoalesceCount", false, 0),
+    IceInternal::Property("Ice.WriteCoalesceSize", false, 0),
     IceInternal::Property("Ice.CacheMessageBuffers", false, 0),
     IceInternal::Property("Ice.ThreadInterruptSafe", false, 0),
     IceInternal::Property("Ice.Voip", false, 0),
@@ -218,12 +271,21 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ACM", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.AdapterId", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.CollocationOptimized", false, 0),
@@ -235,7 +297,11 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.CollocationOptimized", false, 0),
@@ -249,18 +315,30 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM", false, 0),
     IceInternal::Property("IceDiscovery.Reply.AdapterId", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -272,7 +350,11 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.CollocationOptimized", false, 0),
@@ -286,18 +368,30 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM", false, 0),
     IceInternal::Property("IceDiscovery.Locator.AdapterId", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -309,7 +403,11 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.CollocationOptimized", false, 0),
@@ -323,6 +421,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Lookup", false, 0),
     IceInternal::Property("IceDiscovery.Timeout", false, 0),
@@ -345,12 +446,21 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ACM", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.AdapterId", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -362,7 +472,11 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.CollocationOptimized", false, 0),
@@ -376,18 +490,30 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.MessageSizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ACM", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.AdapterId", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -399,7 +525,11 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.CollocationOptimized", false, 0),
@@ -413,6 +543,9 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.MessageSizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Lookup", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Timeout", false, 0),
@@ -459,7 +592,11 @@ const IceInternal::Property IceBoxAdminPropsData[] =
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionCached", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.PreferSecure", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ParallelConnect", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.InvocationTimeout", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.HedgingDelay", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Locator", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Router", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.CollocationOptimized", false, 0),
@@ -489,12 +626,21 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM.Close", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ACM", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.AdapterId", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -506,7 +652,11 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.CollocationOptimized", false, 0),
@@ -520,18 +670,30 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM.Close", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ACM", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.AdapterId", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -543,7 +705,11 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.CollocationOptimized", false, 0),
@@ -557,6 +723,9 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.MessageSizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.Observers", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.SaveToRegistry", false, 0),
@@ -573,12 +742,21 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ACM", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Endpoints", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.CollocationOptimized", false, 0),
@@ -590,7 +768,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.CollocationOptimized", false, 0),
@@ -604,6 +786,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Timeout", false, 0),
@@ -611,12 +796,21 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Node.ACM", false, 0),
     IceInternal::Property("IceGrid.Node.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Node.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGrid.Node.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGrid.Node.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGrid.Node.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGrid.Node.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGrid.Node.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.CollocationOptimized", false, 0),
@@ -628,7 +822,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Node.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Node.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Router.CollocationOptimized", false, 0),
@@ -642,6 +840,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
@@ -665,7 +866,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.UserAccountMapper.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Router", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.CollocationOptimized", false, 0),
@@ -677,7 +882,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.CollocationOptimized", false, 0),
@@ -689,12 +898,21 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.CollocationOptimized", false, 0),
@@ -706,7 +924,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.CollocationOptimized", false, 0),
@@ -720,12 +942,19 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -736,12 +965,21 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.CollocationOptimized", false, 0),
@@ -753,7 +991,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.CollocationOptimized", false, 0),
@@ -767,6 +1009,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
@@ -775,12 +1020,21 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.CollocationOptimized", false, 0),
@@ -792,7 +1046,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.CollocationOptimized", false, 0),
@@ -806,6 +1064,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Enabled", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Address", false, 0),
@@ -817,12 +1078,21 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.CollocationOptimized", false, 0),
@@ -834,7 +1104,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.CollocationOptimized", false, 0),
@@ -848,6 +1122,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.MapSize", false, 0),
     IceInternal::Property("IceGrid.Registry.LMDB.Path", false, 0),
@@ -856,7 +1133,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.CollocationOptimized", false, 0),
@@ -871,12 +1152,21 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.CollocationOptimized", false, 0),
@@ -888,7 +1178,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.CollocationOptimized", false, 0),
@@ -902,6 +1196,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Timeout", false, 0),
@@ -909,12 +1206,21 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Close", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.AdapterId", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.CollocationOptimized", false, 0),
@@ -926,7 +1232,11 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.CollocationOptimized", false, 0),
@@ -940,13 +1250,20 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.HedgingDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -979,12 +1296,21 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ACM.Close", false, 0),
     IceInternal::Property("IcePatch2.ACM", false, 0),
     IceInternal::Property("IcePatch2.AdapterId", false, 0),
+    IceInternal::Property("IcePatch2.AdmissionControl.Target", false, 0),
+    IceInternal::Property("IcePatch2.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("IcePatch2.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("IcePatch2.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("IcePatch2.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("IcePatch2.Endpoints", false, 0),
     IceInternal::Property("IcePatch2.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IcePatch2.Locator.ConnectionCached", false, 0),
     IceInternal::Property("IcePatch2.Locator.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("IcePatch2.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IcePatch2.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IcePatch2.Locator.HedgingDelay", false, 0),
     IceInternal::Property("IcePatch2.Locator.Locator", false, 0),
     IceInternal::Property("IcePatch2.Locator.Router", false, 0),
     IceInternal::Property("IcePatch2.Locator.CollocationOptimized", false, 0),
@@ -996,7 +1322,11 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Router.ConnectionCached", false, 0),
     IceInternal::Property("IcePatch2.Router.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Router.ParallelConnect", false, 0),
+    IceInternal::Property("IcePatch2.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IcePatch2.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("IcePatch2.Router.HedgingDelay", false, 0),
     IceInternal::Property("IcePatch2.Router.Locator", false, 0),
     IceInternal::Property("IcePatch2.Router.Router", false, 0),
     IceInternal::Property("IcePatch2.Router.CollocationOptimized", false, 0),
@@ -1010,6 +1340,9 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.Serialize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
@@ -1052,6 +1385,7 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.FindCert", false, 0),
     IceInternal::Property("IceSSL.FindCert.*", true, 0),
     IceInternal::Property("IceSSL.InitOpenSSL", false, 0),
+    IceInternal::Property("IceSSL.KernelTLS", false, 0),
     IceInternal::Property("IceSSL.KeyFile", true, 0),
     IceInternal::Property("IceSSL.Keychain", false, 0),
     IceInternal::Property("IceSSL.KeychainPassword", false, 0),
@@ -1066,6 +1400,10 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.ProtocolVersionMin", false, 0),
     IceInternal::Property("IceSSL.Random", false, 0),
     IceInternal::Property("IceSSL.SchannelStrongCrypto", false, 0),
+    IceInternal::Property("IceSSL.SessionCacheSize", false, 0),
+    IceInternal::Property("IceSSL.SessionCacheTimeout", false, 0),
+    IceInternal::Property("IceSSL.SessionTicketKeyRotation", false, 0),
+    IceInternal::Property("IceSSL.SessionTickets", false, 0),
     IceInternal::Property("IceSSL.Trace.Security", false, 0),
     IceInternal::Property("IceSSL.TrustOnly", false, 0),
     IceInternal::Property("IceSSL.TrustOnly.Client", false, 0),
@@ -1112,12 +1450,21 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ACM.Close", false, 0),
     IceInternal::Property("Glacier2.Client.ACM", false, 0),
     IceInternal::Property("Glacier2.Client.AdapterId", false, 0),
+    IceInternal::Property("Glacier2.Client.AdmissionControl.Target", false, 0),
+    IceInternal::Property("Glacier2.Client.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("Glacier2.Client.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("Glacier2.Client.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("Glacier2.Client.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("Glacier2.Client.Endpoints", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.HedgingDelay", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.CollocationOptimized", false, 0),
@@ -1129,7 +1476,11 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Router.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.Client.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.HedgingDelay", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Router.CollocationOptimized", false, 0),
@@ -1143,6 +1494,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
@@ -1164,7 +1518,11 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.PermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.HedgingDelay", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.CollocationOptimized", false, 0),
@@ -1175,7 +1533,11 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.HedgingDelay", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -1187,12 +1549,21 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ACM.Close", false, 0),
     IceInternal::Property("Glacier2.Server.ACM", false, 0),
     IceInternal::Property("Glacier2.Server.AdapterId", false, 0),
+    IceInternal::Property("Glacier2.Server.AdmissionControl.Target", false, 0),
+    IceInternal::Property("Glacier2.Server.AdmissionControl.Interval", false, 0),
+    IceInternal::Property("Glacier2.Server.AdmissionControl.MaxQueue", false, 0),
+    IceInternal::Property("Glacier2.Server.AdmissionControl.PriorityOperations", false, 0),
+    IceInternal::Property("Glacier2.Server.AdmissionControl.PriorityContext", false, 0),
     IceInternal::Property("Glacier2.Server.Endpoints", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.HedgingDelay", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.CollocationOptimized", false, 0),
@@ -1204,7 +1575,11 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Router.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Router.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.HedgingDelay", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Router.CollocationOptimized", false, 0),
@@ -1218,6 +1593,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.Serialize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactors", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.ReactorWorkStealing", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.DispatchThreads", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
@@ -1229,7 +1607,11 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SessionManager.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.SessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SessionManager.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.SessionManager.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.HedgingDelay", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SessionManager.CollocationOptimized", false, 0),
@@ -1239,7 +1621,11 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLSessionManager.ConnectionCached", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.LocatorCacheTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.ParallelConnect", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.BatchAutoFlushDelay", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.HedgingDelay", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.CollocationOptimized", false, 0),
@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ..\config\PropertyNames.xml, Mon Mar 27 16:51:58 2017
+// Generated by makeprops.py from file ../config/PropertyNames.xml, Sat Oct 17 09:07:13 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -113,6 +113,7 @@ ProxyFlushBatchAsync::invoke(const string& operation)
     _observer.attach(_proxy, operation, ::Ice::noExplicitContext);
     bool compress; // Ignore for proxy flushBatchRequests
     _batchRequestNum = _proxy->_getBatchRequestQueue()->swap(&_os, compress);
+    _observer.batchRequests(_batchRequestNum);
     invokeImpl(true); // userThread = true
 }
 
@@ -147,6 +148,12 @@ ProxyGetConnection::getConnection() const
     return _cachedConnection;
 }
 
+void
+ProxyGetConnection::endpointSelected(const EndpointLoadPtr&)
+{
+    // No request is sent to the endpoint, its load isn't updated.
+}
+
 void
 ProxyGetConnection::invoke(const string& operation)
 {
@@ -866,6 +873,60 @@ ICE_OBJECT_PRX::ice_locatorCacheTimeout(Int newTimeout) const
     }
 }
 
+Int
+ICE_OBJECT_PRX::ice_getParallelConnect() const
+{
+    return _reference->getParallelConnect();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_parallelConnect(Int newAttempts) const
+{
+    if(newAttempts < 1)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_parallelConnect: " << newAttempts;
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, s.str());
+    }
+    if(newAttempts == _reference->getParallelConnect())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = _newInstance();
+        proxy->setup(_reference->changeParallelConnect(newAttempts));
+        return proxy;
+    }
+}
+
+Int
+ICE_OBJECT_PRX::ice_getConnectionPoolSize() const
+{
+    return _reference->getConnectionPoolSize();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_connectionPoolSize(Int newSize) const
+{
+    if(newSize < 1)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_connectionPoolSize: " << newSize;
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, s.str());
+    }
+    if(newSize == _reference->getConnectionPoolSize())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = _newInstance();
+        proxy->setup(_reference->changeConnectionPoolSize(newSize));
+        return proxy;
+    }
+}
+
 bool
 ICE_OBJECT_PRX::ice_isConnectionCached() const
 {
@@ -1073,6 +1134,60 @@ ICE_OBJECT_PRX::ice_invocationTimeout(Int newTimeout) const
     }
 }
 
+Int
+ICE_OBJECT_PRX::ice_getBatchAutoFlushDelay() const
+{
+    return _reference->getBatchAutoFlushDelay();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_batchAutoFlushDelay(Int newDelay) const
+{
+    if(newDelay < 0)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_batchAutoFlushDelay: " << newDelay;
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, s.str());
+    }
+    if(newDelay == _reference->getBatchAutoFlushDelay())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = _newInstance();
+        proxy->setup(_reference->changeBatchAutoFlushDelay(newDelay));
+        return proxy;
+    }
+}
+
+Int
+ICE_OBJECT_PRX::ice_getHedgingDelay() const
+{
+    return _reference->getHedgingDelay();
+}
+
+ObjectPrxPtr
+ICE_OBJECT_PRX::ice_hedgingDelay(Int newDelay) const
+{
+    if(newDelay < 0)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_hedgingDelay: " << newDelay;
+        throw IceUtil::IllegalArgumentException(__FILE__, __LINE__, s.str());
+    }
+    if(newDelay == _reference->getHedgingDelay())
+    {
+        return CONST_POINTER_CAST_OBJECT_PRX;
+    }
+    else
+    {
+        ObjectPrxPtr proxy = _newInstance();
+        proxy->setup(_reference->changeHedgingDelay(newDelay));
+        return proxy;
+    }
+}
+
 ObjectPrxPtr
 ICE_OBJECT_PRX::ice_twoway() const
 {
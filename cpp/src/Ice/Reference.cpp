@@ -27,6 +27,7 @@
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/ConnectionRequestHandler.h>
 #include <Ice/DefaultsAndOverrides.h>
+#include <Ice/EndpointLoad.h>
 #include <Ice/Comparable.h>
 #include <Ice/StringUtil.h>
 
@@ -149,6 +150,30 @@ IceInternal::Reference::changeInvocationTimeout(int invocationTimeout) const
     return r;
 }
 
+ReferencePtr
+IceInternal::Reference::changeBatchAutoFlushDelay(int batchAutoFlushDelay) const
+{
+    if(_batchAutoFlushDelay == batchAutoFlushDelay)
+    {
+        return ReferencePtr(const_cast<Reference*>(this));
+    }
+    ReferencePtr r = _instance->referenceFactory()->copy(this);
+    r->_batchAutoFlushDelay = batchAutoFlushDelay;
+    return r;
+}
+
+ReferencePtr
+IceInternal::Reference::changeHedgingDelay(int hedgingDelay) const
+{
+    if(_hedgingDelay == hedgingDelay)
+    {
+        return ReferencePtr(const_cast<Reference*>(this));
+    }
+    ReferencePtr r = _instance->referenceFactory()->copy(this);
+    r->_hedgingDelay = hedgingDelay;
+    return r;
+}
+
 ReferencePtr
 IceInternal::Reference::changeEncoding(const Ice::EncodingVersion& encoding) const
 {
@@ -402,6 +427,16 @@ IceInternal::Reference::operator==(const Reference& r) const
     {
         return false;
     }
+
+    if(_batchAutoFlushDelay != r._batchAutoFlushDelay)
+    {
+        return false;
+    }
+
+    if(_hedgingDelay != r._hedgingDelay)
+    {
+        return false;
+    }
     return true;
 }
 
@@ -504,6 +539,24 @@ IceInternal::Reference::operator<(const Reference& r) const
         return false;
     }
 
+    if(_batchAutoFlushDelay < r._batchAutoFlushDelay)
+    {
+        return true;
+    }
+    else if(r._batchAutoFlushDelay < _batchAutoFlushDelay)
+    {
+        return false;
+    }
+
+    if(_hedgingDelay < r._hedgingDelay)
+    {
+        return true;
+    }
+    else if(r._hedgingDelay < _hedgingDelay)
+    {
+        return false;
+    }
+
     return false;
 }
 
@@ -538,6 +591,8 @@ IceInternal::Reference::Reference(const InstancePtr& instance,
                                   const ProtocolVersion& protocol,
                                   const EncodingVersion& encoding,
                                   int invocationTimeout,
+                                  int batchAutoFlushDelay,
+                                  int hedgingDelay,
                                   const Ice::Context& ctx) :
     _hashInitialized(false),
     _instance(instance),
@@ -550,6 +605,8 @@ IceInternal::Reference::Reference(const InstancePtr& instance,
     _protocol(protocol),
     _encoding(encoding),
     _invocationTimeout(invocationTimeout),
+    _batchAutoFlushDelay(batchAutoFlushDelay),
+    _hedgingDelay(hedgingDelay),
     _overrideCompress(false),
     _compress(false)
 {
@@ -567,6 +624,8 @@ IceInternal::Reference::Reference(const Reference& r) :
     _protocol(r._protocol),
     _encoding(r._encoding),
     _invocationTimeout(r._invocationTimeout),
+    _batchAutoFlushDelay(r._batchAutoFlushDelay),
+    _hedgingDelay(r._hedgingDelay),
     _overrideCompress(r._overrideCompress),
     _compress(r._compress)
 {
@@ -592,6 +651,8 @@ IceInternal::Reference::hashInit() const
     hashAdd(h, _encoding.major);
     hashAdd(h, _encoding.minor);
     hashAdd(h, _invocationTimeout);
+    hashAdd(h, _batchAutoFlushDelay);
+    hashAdd(h, _hedgingDelay);
     return h;
 }
 
@@ -605,7 +666,8 @@ IceInternal::FixedReference::FixedReference(const InstancePtr& instance,
                                             bool secure,
                                             const EncodingVersion& encoding,
                                             const ConnectionIPtr& fixedConnection) :
-    Reference(instance, communicator, id, facet, mode, secure, Ice::Protocol_1_0, encoding, -1, Ice::Context()),
+    Reference(instance, communicator, id, facet, mode, secure, Ice::Protocol_1_0, encoding, -1,
+              instance->batchAutoFlushDelay(), instance->hedgingDelay(), Ice::Context()),
     _fixedConnection(fixedConnection)
 {
 }
@@ -652,6 +714,18 @@ IceInternal::FixedReference::getLocatorCacheTimeout() const
     return 0;
 }
 
+int
+IceInternal::FixedReference::getParallelConnect() const
+{
+    return 1;
+}
+
+int
+IceInternal::FixedReference::getConnectionPoolSize() const
+{
+    return 1;
+}
+
 string
 IceInternal::FixedReference::getConnectionId() const
 {
@@ -721,6 +795,20 @@ IceInternal::FixedReference::changeLocatorCacheTimeout(int) const
     return 0; // Keep the compiler happy.
 }
 
+ReferencePtr
+IceInternal::FixedReference::changeParallelConnect(int) const
+{
+    throw FixedProxyException(__FILE__, __LINE__);
+    return 0; // Keep the compiler happy.
+}
+
+ReferencePtr
+IceInternal::FixedReference::changeConnectionPoolSize(int) const
+{
+    throw FixedProxyException(__FILE__, __LINE__);
+    return 0; // Keep the compiler happy.
+}
+
 ReferencePtr
 IceInternal::FixedReference::changeTimeout(int) const
 {
@@ -901,9 +989,14 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
                                                   bool preferSecure,
                                                   EndpointSelectionType endpointSelection,
                                                   int locatorCacheTimeout,
+                                                  int parallelConnect,
+                                                  int connectionPoolSize,
                                                   int invocationTimeout,
+                                                  int batchAutoFlushDelay,
+                                                  int hedgingDelay,
                                                   const Ice::Context& ctx) :
-    Reference(instance, communicator, id, facet, mode, secure, protocol, encoding, invocationTimeout, ctx),
+    Reference(instance, communicator, id, facet, mode, secure, protocol, encoding, invocationTimeout,
+              batchAutoFlushDelay, hedgingDelay, ctx),
     _endpoints(endpoints),
     _adapterId(adapterId),
     _locatorInfo(locatorInfo),
@@ -913,6 +1006,8 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
     _preferSecure(preferSecure),
     _endpointSelection(endpointSelection),
     _locatorCacheTimeout(locatorCacheTimeout),
+    _parallelConnect(parallelConnect),
+    _connectionPoolSize(connectionPoolSize),
     _overrideTimeout(false),
     _timeout(-1)
 {
@@ -973,6 +1068,18 @@ IceInternal::RoutableReference::getLocatorCacheTimeout() const
     return _locatorCacheTimeout;
 }
 
+int
+IceInternal::RoutableReference::getParallelConnect() const
+{
+    return _parallelConnect;
+}
+
+int
+IceInternal::RoutableReference::getConnectionPoolSize() const
+{
+    return _connectionPoolSize;
+}
+
 string
 IceInternal::RoutableReference::getConnectionId() const
 {
@@ -1124,6 +1231,30 @@ IceInternal::RoutableReference::changeLocatorCacheTimeout(int timeout) const
     return r;
 }
 
+ReferencePtr
+IceInternal::RoutableReference::changeParallelConnect(int parallelConnect) const
+{
+    if(parallelConnect == _parallelConnect)
+    {
+        return RoutableReferencePtr(const_cast<RoutableReference*>(this));
+    }
+    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(getInstance()->referenceFactory()->copy(this));
+    r->_parallelConnect = parallelConnect;
+    return r;
+}
+
+ReferencePtr
+IceInternal::RoutableReference::changeConnectionPoolSize(int connectionPoolSize) const
+{
+    if(connectionPoolSize == _connectionPoolSize)
+    {
+        return RoutableReferencePtr(const_cast<RoutableReference*>(this));
+    }
+    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(getInstance()->referenceFactory()->copy(this));
+    r->_connectionPoolSize = connectionPoolSize;
+    return r;
+}
+
 ReferencePtr
 IceInternal::RoutableReference::changeTimeout(int newTimeout) const
 {
@@ -1262,17 +1393,54 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
     properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
     properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
     properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
-    properties[prefix + ".EndpointSelection"] = _endpointSelection == ICE_ENUM(EndpointSelectionType, Random) ? "Random" : "Ordered";
+    switch(_endpointSelection)
+    {
+        case ICE_ENUM(EndpointSelectionType, Random):
+        {
+            properties[prefix + ".EndpointSelection"] = "Random";
+            break;
+        }
+        case ICE_ENUM(EndpointSelectionType, Ordered):
+        {
+            properties[prefix + ".EndpointSelection"] = "Ordered";
+            break;
+        }
+        case ICE_ENUM(EndpointSelectionType, Adaptive):
+        {
+            properties[prefix + ".EndpointSelection"] = "Adaptive";
+            break;
+        }
+    }
     {
         ostringstream s;
         s << _locatorCacheTimeout;
         properties[prefix + ".LocatorCacheTimeout"] = s.str();
     }
+    {
+        ostringstream s;
+        s << _parallelConnect;
+        properties[prefix + ".ParallelConnect"] = s.str();
+    }
+    {
+        ostringstream s;
+        s << _connectionPoolSize;
+        properties[prefix + ".ConnectionPoolSize"] = s.str();
+    }
     {
         ostringstream s;
         s << getInvocationTimeout();
         properties[prefix + ".InvocationTimeout"] = s.str();
     }
+    {
+        ostringstream s;
+        s << getBatchAutoFlushDelay();
+        properties[prefix + ".BatchAutoFlushDelay"] = s.str();
+    }
+    {
+        ostringstream s;
+        s << getHedgingDelay();
+        properties[prefix + ".HedgingDelay"] = s.str();
+    }
     if(_routerInfo)
     {
         PropertyDict routerProperties = _routerInfo->getRouter()->_getReference()->toProperty(prefix + ".Router");
@@ -1371,6 +1539,14 @@ IceInternal::RoutableReference::operator==(const Reference& r) const
     {
         return false;
     }
+    if(_parallelConnect != rhs->_parallelConnect)
+    {
+        return false;
+    }
+    if(_connectionPoolSize != rhs->_connectionPoolSize)
+    {
+        return false;
+    }
     return true;
 }
 
@@ -1502,6 +1678,22 @@ IceInternal::RoutableReference::operator<(const Reference& r) const
     {
         return false;
     }
+    if(_parallelConnect < rhs->_parallelConnect)
+    {
+        return true;
+    }
+    else if(rhs->_parallelConnect < _parallelConnect)
+    {
+        return false;
+    }
+    if(_connectionPoolSize < rhs->_connectionPoolSize)
+    {
+        return true;
+    }
+    else if(rhs->_connectionPoolSize < _connectionPoolSize)
+    {
+        return false;
+    }
     return false;
 }
 
@@ -1741,7 +1933,8 @@ IceInternal::RoutableReference::createConnection(const vector<EndpointIPtr>& all
         // Get an existing connection or create one if there's no
         // existing connection to one of the given endpoints.
         //
-        factory->create(endpoints, false, getEndpointSelection(), new CB1(_routerInfo, callback));
+        factory->create(endpoints, false, getEndpointSelection(), getParallelConnect(),
+                        new CB1(_routerInfo, callback));
         return;
     }
     else
@@ -1784,7 +1977,8 @@ IceInternal::RoutableReference::createConnection(const vector<EndpointIPtr>& all
                 endpoint.push_back(_endpoints[_i]);
 
                 OutgoingConnectionFactoryPtr factory = _reference->getInstance()->outgoingConnectionFactory();
-                factory->create(endpoint, more, _reference->getEndpointSelection(), this);
+                factory->create(endpoint, more, _reference->getEndpointSelection(), _reference->getParallelConnect(),
+                                this);
             }
 
             CB2(const RoutableReferencePtr& reference, const vector<EndpointIPtr>& endpoints,
@@ -1816,7 +2010,8 @@ IceInternal::RoutableReference::createConnection(const vector<EndpointIPtr>& all
         vector<EndpointIPtr> endpt;
         endpt.push_back(endpoints[0]);
         RoutableReference* self = const_cast<RoutableReference*>(this);
-        factory->create(endpt, true, getEndpointSelection(), new CB2(self, endpoints, callback));
+        factory->create(endpt, true, getEndpointSelection(), getParallelConnect(),
+                        new CB2(self, endpoints, callback));
         return;
     }
 }
@@ -1838,6 +2033,26 @@ IceInternal::RoutableReference::applyOverrides(vector<EndpointIPtr>& endpoints)
     }
 }
 
+bool
+IceInternal::RoutableReference::getAdaptiveEndpoints(vector<EndpointIPtr>& endpoints) const
+{
+    if(!_endpoints.empty())
+    {
+        endpoints = filterEndpoints(_endpoints);
+        return true;
+    }
+
+    vector<EndpointIPtr> endpts;
+    if(_locatorInfo &&
+       _locatorInfo->getCachedEndpoints(const_cast<RoutableReference*>(this), _locatorCacheTimeout, endpts))
+    {
+        applyOverrides(endpts);
+        endpoints = filterEndpoints(endpts);
+        return true;
+    }
+    return false;
+}
+
 IceInternal::RoutableReference::RoutableReference(const RoutableReference& r) :
     Reference(r),
     _endpoints(r._endpoints),
@@ -1849,6 +2064,8 @@ IceInternal::RoutableReference::RoutableReference(const RoutableReference& r) :
     _preferSecure(r._preferSecure),
     _endpointSelection(r._endpointSelection),
     _locatorCacheTimeout(r._locatorCacheTimeout),
+    _parallelConnect(r._parallelConnect),
+    _connectionPoolSize(r._connectionPoolSize),
     _overrideTimeout(r._overrideTimeout),
     _timeout(r._timeout),
     _connectionId(r._connectionId)
@@ -1927,6 +2144,11 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
             // Nothing to do.
             break;
         }
+        case ICE_ENUM(EndpointSelectionType, Adaptive):
+        {
+            getInstance()->endpointLoadTable()->sort(endpoints);
+            break;
+        }
         default:
         {
             assert(false);
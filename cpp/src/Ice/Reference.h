@@ -72,6 +72,8 @@ public:
     const InstancePtr& getInstance() const { return _instance; }
     const SharedContextPtr& getContext() const { return _context; }
     int getInvocationTimeout() const { return _invocationTimeout; }
+    int getBatchAutoFlushDelay() const { return _batchAutoFlushDelay; }
+    int getHedgingDelay() const { return _hedgingDelay; }
 
     Ice::CommunicatorPtr getCommunicator() const;
 
@@ -85,6 +87,8 @@ public:
     virtual bool getPreferSecure() const = 0;
     virtual Ice::EndpointSelectionType getEndpointSelection() const = 0;
     virtual int getLocatorCacheTimeout() const = 0;
+    virtual int getParallelConnect() const = 0;
+    virtual int getConnectionPoolSize() const = 0;
     virtual std::string getConnectionId() const = 0;
 
     //
@@ -98,6 +102,8 @@ public:
     ReferencePtr changeIdentity(const Ice::Identity&) const;
     ReferencePtr changeFacet(const std::string&) const;
     ReferencePtr changeInvocationTimeout(int) const;
+    ReferencePtr changeBatchAutoFlushDelay(int) const;
+    ReferencePtr changeHedgingDelay(int) const;
     virtual ReferencePtr changeEncoding(const Ice::EncodingVersion&) const;
     virtual ReferencePtr changeCompress(bool) const;
 
@@ -107,6 +113,8 @@ public:
     virtual ReferencePtr changeRouter(const Ice::RouterPrxPtr&) const = 0;
     virtual ReferencePtr changeCollocationOptimized(bool) const = 0;
     virtual ReferencePtr changeLocatorCacheTimeout(int) const = 0;
+    virtual ReferencePtr changeParallelConnect(int) const = 0;
+    virtual ReferencePtr changeConnectionPoolSize(int) const = 0;
     virtual ReferencePtr changeCacheConnection(bool) const = 0;
     virtual ReferencePtr changePreferSecure(bool) const = 0;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const = 0;
@@ -153,7 +161,7 @@ public:
 protected:
 
     Reference(const InstancePtr&, const Ice::CommunicatorPtr&, const Ice::Identity&, const std::string&, Mode, bool,
-              const Ice::ProtocolVersion&, const Ice::EncodingVersion&, int, const Ice::Context& ctx);
+              const Ice::ProtocolVersion&, const Ice::EncodingVersion&, int, int, int, const Ice::Context& ctx);
     Reference(const Reference&);
 
     virtual Ice::Int hashInit() const;
@@ -174,6 +182,8 @@ private:
     Ice::ProtocolVersion _protocol;
     Ice::EncodingVersion _encoding;
     int _invocationTimeout;
+    int _batchAutoFlushDelay;
+    int _hedgingDelay;
 
 protected:
 
@@ -195,6 +205,8 @@ public:
     virtual bool getPreferSecure() const;
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
+    virtual int getParallelConnect() const;
+    virtual int getConnectionPoolSize() const;
     virtual std::string getConnectionId() const;
 
     virtual ReferencePtr changeEndpoints(const std::vector<EndpointIPtr>&) const;
@@ -206,6 +218,8 @@ public:
     virtual ReferencePtr changePreferSecure(bool) const;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const;
     virtual ReferencePtr changeLocatorCacheTimeout(int) const;
+    virtual ReferencePtr changeParallelConnect(int) const;
+    virtual ReferencePtr changeConnectionPoolSize(int) const;
 
     virtual ReferencePtr changeTimeout(int) const;
     virtual ReferencePtr changeConnectionId(const std::string&) const;
@@ -238,7 +252,7 @@ public:
     RoutableReference(const InstancePtr&, const Ice::CommunicatorPtr&, const Ice::Identity&, const std::string&, Mode,
                       bool, const Ice::ProtocolVersion&, const Ice::EncodingVersion&, const std::vector<EndpointIPtr>&,
                       const std::string&, const LocatorInfoPtr&, const RouterInfoPtr&, bool, bool, bool,
-                      Ice::EndpointSelectionType, int, int, const Ice::Context&);
+                      Ice::EndpointSelectionType, int, int, int, int, int, int, const Ice::Context&);
 
     virtual std::vector<EndpointIPtr> getEndpoints() const;
     virtual std::string getAdapterId() const;
@@ -249,6 +263,8 @@ public:
     virtual bool getPreferSecure() const;
     virtual Ice::EndpointSelectionType getEndpointSelection() const;
     virtual int getLocatorCacheTimeout() const;
+    virtual int getParallelConnect() const;
+    virtual int getConnectionPoolSize() const;
     virtual std::string getConnectionId() const;
 
     virtual ReferencePtr changeEncoding(const Ice::EncodingVersion&) const;
@@ -262,6 +278,8 @@ public:
     virtual ReferencePtr changePreferSecure(bool) const;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const;
     virtual ReferencePtr changeLocatorCacheTimeout(int) const;
+    virtual ReferencePtr changeParallelConnect(int) const;
+    virtual ReferencePtr changeConnectionPoolSize(int) const;
 
     virtual ReferencePtr changeTimeout(int) const;
     virtual ReferencePtr changeConnectionId(const std::string&) const;
@@ -287,6 +305,13 @@ public:
     void createConnection(const std::vector<EndpointIPtr>&, const GetConnectionCallbackPtr&) const;
     void applyOverrides(std::vector<EndpointIPtr>&) const;
 
+    //
+    // Returns the endpoints of a proxy with the Adaptive endpoint
+    // selection, false if the proxy is indirect and its endpoints
+    // aren't in the locator cache.
+    //
+    bool getAdaptiveEndpoints(std::vector<EndpointIPtr>&) const;
+
 protected:
 
     RoutableReference(const RoutableReference&);
@@ -307,6 +332,8 @@ private:
     bool _preferSecure;
     Ice::EndpointSelectionType _endpointSelection;
     int _locatorCacheTimeout;
+    int _parallelConnect;
+    int _connectionPoolSize;
 
     bool _overrideTimeout;
     int _timeout; // Only used if _overrideTimeout == true
@@ -712,7 +712,11 @@ IceInternal::ReferenceFactory::checkForUnknownProperties(const string& prefix)
         "ConnectionCached",
         "PreferSecure",
         "LocatorCacheTimeout",
+        "ParallelConnect",
+        "ConnectionPoolSize",
         "InvocationTimeout",
+        "BatchAutoFlushDelay",
+        "HedgingDelay",
         "Locator",
         "Router",
         "CollocationOptimized",
@@ -796,7 +800,11 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
     bool preferSecure = defaultsAndOverrides->defaultPreferSecure;
     Ice::EndpointSelectionType endpointSelection = defaultsAndOverrides->defaultEndpointSelection;
     int locatorCacheTimeout = defaultsAndOverrides->defaultLocatorCacheTimeout;
+    int parallelConnect = defaultsAndOverrides->defaultParallelConnect;
+    int connectionPoolSize = defaultsAndOverrides->defaultConnectionPoolSize;
     int invocationTimeout = defaultsAndOverrides->defaultInvocationTimeout;
+    int batchAutoFlushDelay = _instance->batchAutoFlushDelay();
+    int hedgingDelay = _instance->hedgingDelay();
     Ice::Context ctx;
 
     //
@@ -863,10 +871,14 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             {
                 endpointSelection = ICE_ENUM(EndpointSelectionType, Ordered);
             }
+            else if(type == "Adaptive")
+            {
+                endpointSelection = ICE_ENUM(EndpointSelectionType, Adaptive);
+            }
             else
             {
                 EndpointSelectionTypeParseException ex(__FILE__, __LINE__);
-                ex.str = "illegal value `" + type + "'; expected `Random' or `Ordered'";
+                ex.str = "illegal value `" + type + "'; expected `Random', `Ordered' or `Adaptive'";
                 throw ex;
             }
         }
@@ -886,6 +898,36 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             }
         }
 
+        property = propertyPrefix + ".ParallelConnect";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            parallelConnect = properties->getPropertyAsIntWithDefault(property, parallelConnect);
+            if(parallelConnect < 1)
+            {
+                parallelConnect = 1;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "`" << properties->getProperty(property) << "'"
+                    << ": defaulting to 1";
+            }
+        }
+
+        property = propertyPrefix + ".ConnectionPoolSize";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            connectionPoolSize = properties->getPropertyAsIntWithDefault(property, connectionPoolSize);
+            if(connectionPoolSize < 1)
+            {
+                connectionPoolSize = 1;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "`" << properties->getProperty(property) << "'"
+                    << ": defaulting to 1";
+            }
+        }
+
         property = propertyPrefix + ".InvocationTimeout";
         value = properties->getProperty(property);
         if(!value.empty())
@@ -901,6 +943,36 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             }
         }
 
+        property = propertyPrefix + ".BatchAutoFlushDelay";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            batchAutoFlushDelay = properties->getPropertyAsIntWithDefault(property, batchAutoFlushDelay);
+            if(batchAutoFlushDelay < 0)
+            {
+                batchAutoFlushDelay = 0;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "`" << properties->getProperty(property) << "'"
+                    << ": defaulting to 0";
+            }
+        }
+
+        property = propertyPrefix + ".HedgingDelay";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            hedgingDelay = properties->getPropertyAsIntWithDefault(property, hedgingDelay);
+            if(hedgingDelay < 0)
+            {
+                hedgingDelay = 0;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "`" << properties->getProperty(property) << "'"
+                    << ": defaulting to 0";
+            }
+        }
+
         property = propertyPrefix + ".Context.";
         PropertyDict contexts = properties->getPropertiesForPrefix(property);
         for(PropertyDict::const_iterator p = contexts.begin(); p != contexts.end(); ++p)
@@ -929,6 +1001,10 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
                                  preferSecure,
                                  endpointSelection,
                                  locatorCacheTimeout,
+                                 parallelConnect,
+                                 connectionPoolSize,
                                  invocationTimeout,
+                                 batchAutoFlushDelay,
+                                 hedgingDelay,
                                  ctx);
 }
@@ -10,16 +10,32 @@
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/CollocatedRequestHandler.h>
 #include <Ice/ConnectRequestHandler.h>
-#include <Ice/CollocatedRequestHandler.h>
+#include <Ice/ConnectionPoolRequestHandler.h>
+#include <Ice/AdaptiveRequestHandler.h>
+#include <Ice/EndpointLoad.h>
 #include <Ice/Reference.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Instance.h>
+#include <Ice/Properties.h>
+#include <Ice/LoggerUtil.h>
 
 using namespace std;
 using namespace IceInternal;
 
-RequestHandlerFactory::RequestHandlerFactory(const InstancePtr& instance) : _instance(instance)
+RequestHandlerFactory::RequestHandlerFactory(const InstancePtr& instance) :
+    _instance(instance),
+    _leastOutstanding(true)
 {
+    string selection = instance->initializationData().properties->getProperty("Ice.ConnectionPoolSelection");
+    if(selection == "RoundRobin")
+    {
+        const_cast<bool&>(_leastOutstanding) = false;
+    }
+    else if(!selection.empty() && selection != "LeastOutstanding")
+    {
+        Ice::Warning out(instance->initializationData().logger);
+        out << "invalid value for Ice.ConnectionPoolSelection `" << selection << "': defaulting to LeastOutstanding";
+    }
 }
 
 RequestHandlerPtr
@@ -34,6 +50,99 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
         }
     }
 
+    //
+    // With a connection pool, each connection of the pool is obtained
+    // with its own connection ID so that the outgoing connection factory
+    // establishes and caches a connection for each of them. Connection
+    // pools aren't used with datagrams or routers, router clients such as
+    // Glacier2 sessions are bound to a single connection.
+    //
+    if(ref->getCacheConnection() && ref->getConnectionPoolSize() > 1 && !ref->getRouterInfo() &&
+       ref->getMode() != Reference::ModeDatagram && ref->getMode() != Reference::ModeBatchDatagram)
+    {
+        vector<RequestHandlerPtr> handlers;
+        handlers.push_back(getConnectRequestHandler(ref, proxy));
+        for(int i = 1; i < ref->getConnectionPoolSize(); ++i)
+        {
+            ostringstream os;
+            os << ref->getConnectionId() << "-pool-" << i;
+            RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(ref->changeConnectionId(os.str()));
+            handlers.push_back(getConnectRequestHandler(r, proxy));
+        }
+        return proxy->_setRequestHandler(ICE_MAKE_SHARED(ConnectionPoolRequestHandler, ref, handlers,
+                                                         _leastOutstanding));
+    }
+
+    //
+    // With the Adaptive endpoint selection, each endpoint is obtained with
+    // its own reference so that the outgoing connection factory
+    // establishes and caches a connection for each of them. The endpoints
+    // of an indirect proxy are the endpoints of the locator cache, the
+    // connect request handler which queries the locator isn't cached
+    // with the proxy until they are in the cache. The loads are only
+    // tracked for two-way requests since the latency of other requests
+    // isn't known.
+    //
+    if(ref->getCacheConnection() && ref->getEndpointSelection() == Ice::ICE_ENUM(EndpointSelectionType, Adaptive) &&
+       !ref->getRouterInfo() && ref->getMode() == Reference::ModeTwoway)
+    {
+        vector<EndpointIPtr> endpoints;
+        if(!ref->getAdaptiveEndpoints(endpoints))
+        {
+            return getConnectRequestHandler(ref, proxy);
+        }
+
+        if(!endpoints.empty())
+        {
+            vector<RequestHandlerPtr> handlers;
+            vector<EndpointLoadPtr> loads;
+            size_t failed = 0;
+            for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+            {
+                RoutableReferencePtr r =
+                    RoutableReferencePtr::dynamicCast(ref->changeEndpoints(vector<EndpointIPtr>(1, *p)));
+                EndpointLoadPtr load = _instance->endpointLoadTable()->get(*p);
+                ConnectRequestHandlerPtr handler = createConnectRequestHandler(r, proxy);
+                try
+                {
+                    handlers.push_back(handler->connect(proxy));
+                }
+                catch(const Ice::LocalException&)
+                {
+                    //
+                    // The connection establishment failed synchronously (the
+                    // connection is refused for example). The failed handler is
+                    // kept, it raises the exception if the endpoint is selected
+                    // once its load decayed and the request handler is then
+                    // created again to retry the connection establishment.
+                    //
+                    if(++failed == endpoints.size())
+                    {
+                        throw;
+                    }
+                    load->failed(IceUtil::Time::now(IceUtil::Time::Monotonic));
+                    handlers.push_back(handler);
+                }
+                loads.push_back(load);
+            }
+            return proxy->_setRequestHandler(ICE_MAKE_SHARED(AdaptiveRequestHandler, ref, handlers, loads));
+        }
+    }
+
+    return proxy->_setRequestHandler(getConnectRequestHandler(ref, proxy));
+}
+
+RequestHandlerPtr
+IceInternal::RequestHandlerFactory::getConnectRequestHandler(const RoutableReferencePtr& ref,
+                                                            const Ice::ObjectPrxPtr& proxy)
+{
+    return createConnectRequestHandler(ref, proxy)->connect(proxy);
+}
+
+ConnectRequestHandlerPtr
+IceInternal::RequestHandlerFactory::createConnectRequestHandler(const RoutableReferencePtr& ref,
+                                                               const Ice::ObjectPrxPtr& proxy)
+{
     ConnectRequestHandlerPtr handler;
     bool connect = false;
     if(ref->getCacheConnection())
@@ -64,7 +173,7 @@ IceInternal::RequestHandlerFactory::getRequestHandler(const RoutableReferencePtr
         ref->getConnection(handler.get());
 #endif
     }
-    return proxy->_setRequestHandler(handler->connect(proxy));
+    return handler;
 }
 
 void
@@ -33,7 +33,16 @@ public:
 
 private:
 
+    RequestHandlerPtr getConnectRequestHandler(const RoutableReferencePtr&, const Ice::ObjectPrxPtr&);
+
+    //
+    // Returns the connect request handler of the reference, the connection
+    // establishment is started if the handler is created.
+    //
+    ConnectRequestHandlerPtr createConnectRequestHandler(const RoutableReferencePtr&, const Ice::ObjectPrxPtr&);
+
     const InstancePtr _instance;
+    const bool _leastOutstanding;
     std::map<ReferencePtr, ConnectRequestHandlerPtr> _handlers;
 };
 
@@ -0,0 +1,130 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/RequestTable.h>
+#include <Ice/OutgoingAsync.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+const size_t minSlots = 16;
+
+template<typename T> struct RequestIdLess
+{
+    bool
+    operator()(const T* lhs, const T* rhs) const
+    {
+        return lhs->requestId < rhs->requestId;
+    }
+};
+
+}
+
+IceInternal::RequestTable::RequestTable() :
+    _mask(0),
+    _size(0),
+    _nextRequestId(1)
+{
+}
+
+Int
+IceInternal::RequestTable::allocate()
+{
+    if(_size >= _slots.size() / 2)
+    {
+        grow();
+    }
+
+    //
+    // Skip the IDs whose slot is used by an older request, this only
+    // happens when the IDs wrap around the table while the older
+    // request is still waiting for its reply.
+    //
+    while(true)
+    {
+        Int requestId = _nextRequestId;
+        _nextRequestId = _nextRequestId == 0x7fffffff ? 1 : _nextRequestId + 1;
+        if(!_slots[requestId & _mask].requestId)
+        {
+            return requestId;
+        }
+    }
+}
+
+Int
+IceInternal::RequestTable::find(const OutgoingAsyncBasePtr& outAsync) const
+{
+    for(vector<Slot>::const_iterator p = _slots.begin(); p != _slots.end(); ++p)
+    {
+        if(p->requestId && p->outAsync.get() == outAsync.get())
+        {
+            return p->requestId;
+        }
+    }
+    return 0;
+}
+
+void
+IceInternal::RequestTable::clear(vector<OutgoingAsyncBasePtr>& requests)
+{
+    vector<Slot*> slots;
+    slots.reserve(_size);
+    for(vector<Slot>::iterator p = _slots.begin(); p != _slots.end(); ++p)
+    {
+        if(p->requestId)
+        {
+            slots.push_back(&*p);
+        }
+    }
+    sort(slots.begin(), slots.end(), RequestIdLess<Slot>());
+
+    requests.reserve(requests.size() + slots.size());
+    for(vector<Slot*>::const_iterator p = slots.begin(); p != slots.end(); ++p)
+    {
+        requests.push_back((*p)->outAsync);
+    }
+
+    //
+    // Release the slots, the table might have grown large with a burst
+    // of requests.
+    //
+    vector<Slot>().swap(_slots);
+    _mask = 0;
+    _size = 0;
+}
+
+void
+IceInternal::RequestTable::grow()
+{
+    //
+    // The low bits of the IDs are unique with the current mask, they
+    // are also unique with the larger mask so the requests can't
+    // collide in the new table.
+    //
+    vector<Slot> slots(max(minSlots, _slots.size() * 2));
+    Int mask = static_cast<Int>(slots.size() - 1);
+    for(vector<Slot>::iterator p = _slots.begin(); p != _slots.end(); ++p)
+    {
+        if(p->requestId)
+        {
+            Slot& slot = slots[p->requestId & mask];
+            assert(!slot.requestId);
+            slot.requestId = p->requestId;
+            slot.outAsync.swap(p->outAsync);
+        }
+    }
+    _slots.swap(slots);
+    _mask = mask;
+}
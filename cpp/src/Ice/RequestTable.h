@@ -0,0 +1,117 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_REQUEST_TABLE_H
+#define ICE_REQUEST_TABLE_H
+
+#include <IceUtil/Config.h>
+#include <Ice/OutgoingAsyncF.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The table of the outstanding twoway requests of a connection. The
+// table is an array of slots indexed by the low bits of the request ID
+// and the table allocates the request IDs such that the slot of a new
+// request is always free. Adding, finding and removing a request is
+// therefore a single array access. The table doubles in size when it
+// is half full, the low bits of the IDs of the existing requests are
+// still unique with the larger table so the requests keep their slot.
+//
+// The table isn't thread safe, it's protected by the connection mutex.
+//
+class RequestTable : private IceUtil::noncopyable
+{
+public:
+
+    RequestTable();
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    //
+    // Returns a new request ID, the ID must be added with add() before
+    // another ID is allocated.
+    //
+    Ice::Int allocate();
+
+    void add(Ice::Int requestId, const OutgoingAsyncBasePtr& outAsync)
+    {
+        Slot& slot = _slots[requestId & _mask];
+        assert(requestId > 0 && !slot.requestId);
+        slot.requestId = requestId;
+        slot.outAsync = outAsync;
+        ++_size;
+    }
+
+    //
+    // Remove the request with the given ID and return it, returns null
+    // if there's no request with this ID.
+    //
+    OutgoingAsyncBasePtr remove(Ice::Int requestId)
+    {
+        OutgoingAsyncBasePtr outAsync;
+        if(requestId > 0 && !_slots.empty())
+        {
+            Slot& slot = _slots[requestId & _mask];
+            if(slot.requestId == requestId)
+            {
+                slot.requestId = 0;
+                outAsync.swap(slot.outAsync);
+                --_size;
+            }
+        }
+        return outAsync;
+    }
+
+    //
+    // Returns the ID of the given request or 0 if the request isn't in
+    // the table. This requires a scan of the table.
+    //
+    Ice::Int find(const OutgoingAsyncBasePtr&) const;
+
+    //
+    // Remove all the requests from the table and add them to the given
+    // vector, in the order of their request IDs.
+    //
+    void clear(std::vector<OutgoingAsyncBasePtr>&);
+
+private:
+
+    struct Slot
+    {
+        Slot() : requestId(0)
+        {
+        }
+
+        Ice::Int requestId;
+        OutgoingAsyncBasePtr outAsync;
+    };
+
+    void grow();
+
+    std::vector<Slot> _slots;
+    Ice::Int _mask;
+    size_t _size;
+    Ice::Int _nextRequestId;
+};
+
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include <Ice/Instance.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/LocalException.h>
+#include <Ice/Properties.h>
 #include <IceUtil/Time.h>
 
 #ifdef ICE_USE_CFSTREAM
@@ -19,9 +20,59 @@
 #   include <CoreFoundation/CFStream.h>
 #endif
 
+#if defined(ICE_USE_IO_URING)
+#   include <linux/io_uring.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#endif
+
 using namespace std;
 using namespace IceInternal;
 
+#if defined(ICE_USE_IO_URING)
+namespace
+{
+
+//
+// The io_uring_getevents_arg and __kernel_timespec structures and the extended argument flags
+// aren't provided by older kernel headers, support for them is checked at runtime instead.
+//
+struct RingTimespec
+{
+    long long tv_sec;
+    long long tv_nsec;
+};
+
+struct RingGetEventsArg
+{
+    unsigned long long sigmask;
+    unsigned int sigmaskSize;
+    unsigned int pad;
+    unsigned long long ts;
+};
+
+const unsigned int ringEnterExtArg = 1U << 3; // IORING_ENTER_EXT_ARG
+const unsigned int ringFeatureExtArg = 1U << 8; // IORING_FEAT_EXT_ARG
+const unsigned int ringEntries = 256;
+const unsigned int ringGenerationMask = 0x3fffffff;
+
+//
+// The user data of a poll request encodes the selector slot of the handler, the slot
+// generation and the socket operation. Completions for a previous generation of the slot
+// are ignored, the slot generation is incremented when the poll requests of the slot are
+// canceled. The user data of other requests is 0.
+//
+inline unsigned long long
+ringUserData(int slot, unsigned int generation, SocketOperation op)
+{
+    return (static_cast<unsigned long long>(slot) << 32) |
+           (static_cast<unsigned long long>(generation & ringGenerationMask) << 2) |
+           static_cast<unsigned long long>(op);
+}
+
+}
+#endif
+
 #if defined(ICE_USE_KQUEUE)
 namespace
 {
@@ -249,6 +300,12 @@ Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrup
     _selecting = false;
 
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+    if(initializeRing())
+    {
+        return;
+    }
+#   endif
     _events.resize(256);
     _queueFd = epoll_create(1);
     if(_queueFd < 0)
@@ -305,6 +362,10 @@ Selector::~Selector()
 void
 Selector::destroy()
 {
+#if defined(ICE_USE_IO_URING)
+    destroyRing();
+#endif
+
 #if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL)
     try
     {
@@ -376,6 +437,13 @@ Selector::enable(EventHandler* handler, SocketOperation status)
     if(handler->_registered & status)
     {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+        if(_ring)
+        {
+            updateRing(handler);
+            return;
+        }
+#   endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation previous = static_cast<SocketOperation>(handler->_registered & ~(handler->_disabled | status));
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
@@ -424,6 +492,16 @@ Selector::disable(EventHandler* handler, SocketOperation status)
     if(handler->_registered & status)
     {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+        if(_ring)
+        {
+            //
+            // The poll requests are not canceled, the selector ignores the completion of
+            // a poll request for a disabled operation.
+            //
+            return;
+        }
+#   endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
         epoll_event event;
@@ -473,6 +551,15 @@ Selector::finish(EventHandler* handler, bool closeNow)
         //
         updateSelector();
     }
+#elif defined(ICE_USE_IO_URING)
+    if(closeNow && _ring)
+    {
+        //
+        // Submit the poll removal requests now if we're going to close the FD now, the
+        // kernel keeps a reference on the socket until the poll requests are removed.
+        //
+        submitRing();
+    }
 #elif !defined(ICE_USE_EPOLL)
     if(!_changes.empty())
     {
@@ -517,6 +604,18 @@ Selector::wakeup()
 {
     if(_selecting && !_interrupted)
     {
+#if defined(ICE_USE_IO_URING)
+        if(_ring)
+        {
+            //
+            // Submit a no-op request, its completion interrupts the select.
+            //
+            queueRing(IORING_OP_NOP, INVALID_SOCKET, 0, 0, 0);
+            submitRing();
+            _interrupted = true;
+            return;
+        }
+#endif
         char c = 0;
         while(true)
         {
@@ -540,6 +639,30 @@ Selector::wakeup()
 void
 Selector::startSelect()
 {
+#if defined(ICE_USE_IO_URING)
+    if(_ring)
+    {
+        _interrupted = false;
+
+        //
+        // Re-arm the poll requests which completed with the last select, the poll requests
+        // are single-shot. This is done now rather than when the poll request completes
+        // to not re-arm the poll request of an operation which is no longer registered.
+        //
+        for(vector<int>::const_iterator p = _ringRearm.begin(); p != _ringRearm.end(); ++p)
+        {
+            armRing(*p);
+        }
+        _ringRearm.clear();
+
+        //
+        // The queued requests are submitted with the next select.
+        //
+        _ringSubmit = _ringPending;
+        _ringPending = 0;
+    }
+#endif
+
     if(_interrupted)
     {
         char c;
@@ -599,12 +722,21 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation> >& handlers)
         pair<EventHandler*, SocketOperation> p;
 
 #if defined(ICE_USE_EPOLL)
-        struct epoll_event& ev = _events[i];
-        p.first = reinterpret_cast<EventHandler*>(ev.data.ptr);
-        p.second = static_cast<SocketOperation>(((ev.events & (EPOLLIN | EPOLLERR)) ?
-                                                 SocketOperationRead : SocketOperationNone) |
-                                                ((ev.events & (EPOLLOUT | EPOLLERR)) ?
-                                                 SocketOperationWrite : SocketOperationNone));
+#   if defined(ICE_USE_IO_URING)
+        if(_ring)
+        {
+            p = completedRing(_ringCqes[(*_ringCqHead + i) & _ringCqMask]);
+        }
+        else
+#   endif
+        {
+            struct epoll_event& ev = _events[i];
+            p.first = reinterpret_cast<EventHandler*>(ev.data.ptr);
+            p.second = static_cast<SocketOperation>(((ev.events & (EPOLLIN | EPOLLERR)) ?
+                                                     SocketOperationRead : SocketOperationNone) |
+                                                    ((ev.events & (EPOLLOUT | EPOLLERR)) ?
+                                                     SocketOperationWrite : SocketOperationNone));
+        }
 #elif defined(ICE_USE_KQUEUE)
         struct kevent& ev = _events[i];
         if(ev.flags & EV_ERROR)
@@ -676,6 +808,22 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation> >& handlers)
         }
     }
 
+#if defined(ICE_USE_IO_URING)
+    if(_ring)
+    {
+        if(_count > 0)
+        {
+            __atomic_store_n(_ringCqHead, *_ringCqHead + _count, __ATOMIC_RELEASE);
+        }
+
+        //
+        // Requests which couldn't be submitted by the select are submitted with the next one.
+        //
+        _ringPending += _ringSubmit;
+        _ringSubmit = 0;
+    }
+#endif
+
     for(map<EventHandlerPtr, SocketOperation>::iterator q = _readyHandlers.begin(); q != _readyHandlers.end(); ++q)
     {
         pair<EventHandler*, SocketOperation> p;
@@ -714,7 +862,16 @@ Selector::select(int timeout)
     while(true)
     {
 #if defined(ICE_USE_EPOLL)
-        _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+#   if defined(ICE_USE_IO_URING)
+        if(_ring)
+        {
+            _count = selectRing(timeout);
+        }
+        else
+#   endif
+        {
+            _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+        }
 #elif defined(ICE_USE_KQUEUE)
         assert(!_events.empty());
         if(timeout >= 0)
@@ -911,6 +1068,13 @@ void
 Selector::updateSelectorForEventHandler(EventHandler* handler, SocketOperation remove, SocketOperation add)
 {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+    if(_ring)
+    {
+        updateRing(handler);
+        return;
+    }
+#   endif
     SocketOperation previous = handler->_registered;
     previous = static_cast<SocketOperation>(previous & ~add);
     previous = static_cast<SocketOperation>(previous | remove);
@@ -989,6 +1153,349 @@ Selector::updateSelectorForEventHandler(EventHandler* handler, SocketOperation r
     checkReady(handler);
 }
 
+#if defined(ICE_USE_IO_URING)
+
+bool
+Selector::initializeRing()
+{
+    _ring = false;
+    _ringSq = MAP_FAILED;
+    _ringSqSize = 0;
+    _ringCq = MAP_FAILED;
+    _ringCqSize = 0;
+    _ringSqes = 0;
+    _ringSqesSize = 0;
+    _ringPending = 0;
+    _ringSubmit = 0;
+
+    //
+    // io_uring is only used to poll the sockets for readiness, reads and writes still use the
+    // regular system calls. It's disabled by default and must be enabled with Ice.IoUring.
+    //
+    if(_instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.IoUring", 0) <= 0)
+    {
+        return false;
+    }
+
+    //
+    // Fallback to epoll if io_uring isn't supported or if it doesn't support the features
+    // we need: the kernel must not drop completions when the completion queue overflows and
+    // must support the timeout extended argument of io_uring_enter.
+    //
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(syscall(__NR_io_uring_setup, ringEntries, &params));
+    if(fd < 0)
+    {
+        return false;
+    }
+    if(!(params.features & IORING_FEAT_NODROP) || !(params.features & ringFeatureExtArg))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    _ringSqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    _ringCqSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _ringSqSize = max(_ringSqSize, _ringCqSize);
+        _ringCqSize = 0;
+    }
+
+    _ringSq = mmap(0, _ringSqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if(_ringSq != MAP_FAILED && _ringCqSize > 0)
+    {
+        _ringCq = mmap(0, _ringCqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    }
+    else
+    {
+        _ringCq = _ringSq;
+    }
+    _ringSqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    void* sqes = MAP_FAILED;
+    if(_ringCq != MAP_FAILED)
+    {
+        sqes = mmap(0, _ringSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    }
+    if(sqes == MAP_FAILED)
+    {
+        Ice::Warning out(_instance->initializationData().logger);
+        out << "unable to map the io_uring queues, using epoll instead:\n"
+            << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
+        destroyRing();
+        ::close(fd);
+        return false;
+    }
+    _ringSqes = static_cast<struct io_uring_sqe*>(sqes);
+
+    char* sq = static_cast<char*>(_ringSq);
+    _ringSqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+    _ringSqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+    _ringSqMask = *reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+    _ringSqEntries = *reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_entries);
+    unsigned int* array = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+    for(unsigned int i = 0; i < _ringSqEntries; ++i)
+    {
+        array[i] = i; // The submission queue entries are always used in order.
+    }
+
+    char* cq = static_cast<char*>(_ringCq);
+    _ringCqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+    _ringCqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+    _ringCqMask = *reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+    _ringCqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    _queueFd = fd;
+    _ring = true;
+    return true;
+}
+
+void
+Selector::destroyRing()
+{
+    if(_ringSqes)
+    {
+        munmap(_ringSqes, _ringSqesSize);
+        _ringSqes = 0;
+    }
+    if(_ringCq != MAP_FAILED && _ringCq != _ringSq)
+    {
+        munmap(_ringCq, _ringCqSize);
+    }
+    _ringCq = MAP_FAILED;
+    if(_ringSq != MAP_FAILED)
+    {
+        munmap(_ringSq, _ringSqSize);
+        _ringSq = MAP_FAILED;
+    }
+}
+
+void
+Selector::updateRing(EventHandler* handler)
+{
+    int slot = handler->_ringSlot;
+    if(!handler->_registered)
+    {
+        if(slot >= 0)
+        {
+            cancelRing(slot);
+            _ringSlots[slot].handler = 0;
+            _ringFreeSlots.push_back(slot);
+            handler->_ringSlot = -1;
+        }
+    }
+    else
+    {
+        SOCKET fd = handler->getNativeInfo()->fd();
+        if(slot < 0)
+        {
+            if(_ringFreeSlots.empty())
+            {
+                RingSlot s = { 0, INVALID_SOCKET, 0, SocketOperationNone };
+                _ringSlots.push_back(s);
+                slot = static_cast<int>(_ringSlots.size() - 1);
+            }
+            else
+            {
+                slot = _ringFreeSlots.back();
+                _ringFreeSlots.pop_back();
+            }
+            _ringSlots[slot].handler = handler;
+            _ringSlots[slot].fd = fd;
+            handler->_ringSlot = slot;
+        }
+        else if(_ringSlots[slot].fd != fd)
+        {
+            //
+            // The FD of the handler changed after connect (see NativeInfo::newFd), cancel
+            // the poll requests of the previous FD.
+            //
+            cancelRing(slot);
+            _ringSlots[slot].fd = fd;
+        }
+        armRing(slot);
+    }
+
+    if(_selecting)
+    {
+        submitRing();
+    }
+}
+
+void
+Selector::armRing(int slot)
+{
+    RingSlot& s = _ringSlots[slot];
+    if(!s.handler)
+    {
+        return;
+    }
+
+    SocketOperation status = static_cast<SocketOperation>(s.handler->_registered & ~s.handler->_disabled & ~s.armed);
+    if(status & SocketOperationRead)
+    {
+        queueRing(IORING_OP_POLL_ADD, s.fd, POLLIN, 0, ringUserData(slot, s.generation, SocketOperationRead));
+    }
+    if(status & SocketOperationWrite)
+    {
+        queueRing(IORING_OP_POLL_ADD, s.fd, POLLOUT, 0, ringUserData(slot, s.generation, SocketOperationWrite));
+    }
+    s.armed = static_cast<SocketOperation>(s.armed | (status & (SocketOperationRead | SocketOperationWrite)));
+}
+
+void
+Selector::cancelRing(int slot)
+{
+    RingSlot& s = _ringSlots[slot];
+    if(s.armed & SocketOperationRead)
+    {
+        queueRing(IORING_OP_POLL_REMOVE, INVALID_SOCKET, 0, ringUserData(slot, s.generation, SocketOperationRead), 0);
+    }
+    if(s.armed & SocketOperationWrite)
+    {
+        queueRing(IORING_OP_POLL_REMOVE, INVALID_SOCKET, 0, ringUserData(slot, s.generation, SocketOperationWrite), 0);
+    }
+    s.armed = SocketOperationNone;
+    ++s.generation;
+}
+
+pair<EventHandler*, SocketOperation>
+Selector::completedRing(const struct io_uring_cqe& cqe)
+{
+    pair<EventHandler*, SocketOperation> p(static_cast<EventHandler*>(0), SocketOperationNone);
+
+    SocketOperation op = static_cast<SocketOperation>(cqe.user_data & 3);
+    if(!op)
+    {
+        return p; // Interrupted or poll request removed
+    }
+
+    RingSlot& s = _ringSlots[static_cast<size_t>(cqe.user_data >> 32)];
+    if(((cqe.user_data >> 2) & ringGenerationMask) != (s.generation & ringGenerationMask))
+    {
+        return p; // Poll request canceled
+    }
+
+    //
+    // A poll request which completes with an error is reported as ready, the error is
+    // reported to the handler by the next read or write on the socket.
+    //
+    s.armed = static_cast<SocketOperation>(s.armed & ~op);
+    p.second = static_cast<SocketOperation>(op & s.handler->_registered & ~s.handler->_disabled);
+    if(p.second)
+    {
+        p.first = s.handler;
+        _ringRearm.push_back(static_cast<int>(cqe.user_data >> 32));
+    }
+    return p;
+}
+
+void
+Selector::queueRing(unsigned char opcode, SOCKET fd, short events, unsigned long long addr, unsigned long long data)
+{
+    unsigned int tail = *_ringSqTail;
+    while(tail - __atomic_load_n(_ringSqHead, __ATOMIC_ACQUIRE) == _ringSqEntries)
+    {
+        //
+        // The submission queue is full, submit all the queued requests now.
+        //
+        if(enterRing(_ringSqEntries, 0, 0, 0) < 0 && !interrupted())
+        {
+            Ice::SocketException ex(__FILE__, __LINE__);
+            ex.error = IceInternal::getSocketErrno();
+            throw ex;
+        }
+        _ringPending = 0;
+    }
+
+    struct io_uring_sqe* sqe = &_ringSqes[tail & _ringSqMask];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->poll_events = static_cast<unsigned short>(events);
+    sqe->addr = addr;
+    sqe->user_data = data;
+    __atomic_store_n(_ringSqTail, tail + 1, __ATOMIC_RELEASE);
+    ++_ringPending;
+}
+
+void
+Selector::submitRing()
+{
+    while(_ringPending > 0)
+    {
+        int ret = enterRing(_ringPending, 0, 0, 0);
+        if(ret < 0)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            //
+            // The requests which couldn't be submitted are submitted with the next select.
+            //
+            Ice::Error out(_instance->initializationData().logger);
+            out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
+            return;
+        }
+        _ringPending = static_cast<unsigned int>(ret) < _ringPending ? _ringPending - ret : 0;
+        if(ret == 0)
+        {
+            break;
+        }
+    }
+}
+
+int
+Selector::selectRing(int timeout)
+{
+    //
+    // Submit the requests queued before the select and wait for a completion. The wait is
+    // bounded with the timeout extended argument if a timeout is set.
+    //
+    RingTimespec ts;
+    RingGetEventsArg arg;
+    memset(&arg, 0, sizeof(arg));
+    if(timeout > 0)
+    {
+        ts.tv_sec = timeout / 1000;
+        ts.tv_nsec = static_cast<long long>(timeout % 1000) * 1000000;
+        arg.ts = static_cast<unsigned long long>(reinterpret_cast<size_t>(&ts));
+    }
+
+    int ret = enterRing(_ringSubmit, timeout == 0 ? 0 : 1,
+                        IORING_ENTER_GETEVENTS | (timeout > 0 ? ringEnterExtArg : 0),
+                        timeout > 0 ? &arg : 0);
+    if(ret < 0)
+    {
+        //
+        // ETIME is returned if the wait timed out. EBUSY and EAGAIN are returned if the
+        // requests couldn't be submitted, they'll be submitted with the next select.
+        //
+        int error = IceInternal::getSocketErrno();
+        if(error != ETIME && error != EBUSY && error != EAGAIN)
+        {
+            return SOCKET_ERROR;
+        }
+    }
+    else
+    {
+        _ringSubmit = static_cast<unsigned int>(ret) < _ringSubmit ? _ringSubmit - ret : 0;
+    }
+    return static_cast<int>(__atomic_load_n(_ringCqTail, __ATOMIC_ACQUIRE) - *_ringCqHead);
+}
+
+int
+Selector::enterRing(unsigned int submit, unsigned int wait, unsigned int flags, void* arg)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, _queueFd, submit, wait, flags, arg,
+                                    arg ? sizeof(RingGetEventsArg) : 0));
+}
+
+#endif
+
 #elif defined(ICE_USE_CFSTREAM)
 
 namespace
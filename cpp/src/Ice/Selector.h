@@ -21,6 +21,10 @@
 
 #if defined(ICE_USE_EPOLL)
 #   include <sys/epoll.h>
+#   if defined(ICE_USE_IO_URING)
+struct io_uring_sqe;
+struct io_uring_cqe;
+#   endif
 #elif defined(ICE_USE_KQUEUE)
 #   include <sys/event.h>
 #elif defined(ICE_USE_IOCP)
@@ -143,6 +147,27 @@ private:
     void updateSelector();
     void updateSelectorForEventHandler(EventHandler*, SocketOperation, SocketOperation);
 
+#if defined(ICE_USE_IO_URING)
+    struct RingSlot
+    {
+        EventHandler* handler;
+        SOCKET fd;
+        unsigned int generation;
+        SocketOperation armed; // The operations with a poll request queued or pending in the kernel.
+    };
+
+    bool initializeRing();
+    void destroyRing();
+    void updateRing(EventHandler*);
+    void armRing(int);
+    void cancelRing(int);
+    std::pair<EventHandler*, SocketOperation> completedRing(const struct io_uring_cqe&);
+    void queueRing(unsigned char, SOCKET, short, unsigned long long, unsigned long long);
+    void submitRing();
+    int selectRing(int);
+    int enterRing(unsigned int, unsigned int, unsigned int, void*);
+#endif
+
     const InstancePtr _instance;
 
     SOCKET _fdIntrRead;
@@ -155,7 +180,29 @@ private:
 
 #if defined(ICE_USE_EPOLL)
     std::vector<struct epoll_event> _events;
-    int _queueFd;
+    int _queueFd; // The epoll FD or the io_uring FD if _ring is true.
+#   if defined(ICE_USE_IO_URING)
+    bool _ring;
+    void* _ringSq;
+    size_t _ringSqSize;
+    void* _ringCq;
+    size_t _ringCqSize;
+    struct io_uring_sqe* _ringSqes;
+    size_t _ringSqesSize;
+    unsigned int* _ringSqHead;
+    unsigned int* _ringSqTail;
+    unsigned int _ringSqMask;
+    unsigned int _ringSqEntries;
+    unsigned int* _ringCqHead;
+    unsigned int* _ringCqTail;
+    unsigned int _ringCqMask;
+    struct io_uring_cqe* _ringCqes;
+    unsigned int _ringPending; // Number of queued requests which are not submitted yet.
+    unsigned int _ringSubmit; // Number of queued requests to submit with the next select.
+    std::vector<RingSlot> _ringSlots;
+    std::vector<int> _ringFreeSlots;
+    std::vector<int> _ringRearm; // Slots with a poll request completed by the last select.
+#   endif
 #elif defined(ICE_USE_KQUEUE)
     std::vector<struct kevent> _events;
     std::vector<struct kevent> _changes;
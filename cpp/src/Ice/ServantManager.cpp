@@ -13,6 +13,8 @@
 #include <Ice/LoggerUtil.h>
 #include <Ice/Instance.h>
 #include <Ice/StringUtil.h>
+#include <Ice/HashUtil.h>
+#include <IceUtil/Thread.h>
 
 using namespace std;
 using namespace Ice;
@@ -20,27 +22,130 @@ using namespace IceInternal;
 
 ICE_API IceUtil::Shared* IceInternal::upCast(ServantManager* p) { return p; }
 
-void
-IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity& ident, const string& facet)
+namespace
 {
-    IceUtil::Mutex::Lock sync(*this);
 
-    assert(_instance); // Must not be called after destruction.
+const size_t initialTableSize = 32;
+
+size_t
+hashIdentity(const Identity& ident)
+{
+    size_t h = 5381;
+    for(string::const_iterator p = ident.name.begin(); p != ident.name.end(); ++p)
+    {
+        h = ((h << 5) + h) ^ static_cast<unsigned char>(*p);
+    }
+    for(string::const_iterator p = ident.category.begin(); p != ident.category.end(); ++p)
+    {
+        h = ((h << 5) + h) ^ static_cast<unsigned char>(*p);
+    }
+    return h;
+}
+
+}
+
+//
+// An entry of the active servant map. Entries are immutable once
+// published, updating the facets of an identity replaces its entry.
+//
+struct IceInternal::ServantManager::ServantEntry
+{
+    ServantEntry(const Identity& i, const FacetMap& f) :
+        identity(i),
+        facets(f)
+    {
+    }
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    const Identity identity;
+    const FacetMap facets;
+    IceUtilInternal::AtomicPtr<ServantEntry> next;
+};
 
-    if(p == _servantMapMap.end() || p->first != ident)
+//
+// The active servant map, a hash table with chained entries. The table
+// is replaced by a larger one when it's full.
+//
+struct IceInternal::ServantManager::ServantTable
+{
+    ServantTable(size_t sz) :
+        mask(sz - 1),
+        size(0),
+        buckets(new IceUtilInternal::AtomicPtr<ServantEntry>[sz])
     {
-        p = _servantMapMap.find(ident);
     }
 
-    if(p == _servantMapMap.end())
+    ~ServantTable()
     {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
+        for(size_t i = 0; i <= mask; ++i)
+        {
+            ServantEntry* entry = buckets[i].load();
+            while(entry)
+            {
+                ServantEntry* next = entry->next.load();
+                delete entry;
+                entry = next;
+            }
+        }
+        delete[] buckets;
     }
-    else
+
+    IceUtilInternal::AtomicPtr<ServantEntry>&
+    bucket(const Identity& ident) const
     {
-        if(p->second.find(facet) != p->second.end())
+        return buckets[hashIdentity(ident) & mask];
+    }
+
+    const size_t mask;
+    size_t size; // Only used by updates.
+    IceUtilInternal::AtomicPtr<ServantEntry>* const buckets;
+};
+
+//
+// Registers a lookup with the reader count of the current epoch for the
+// duration of the lookup.
+//
+class IceInternal::ServantManager::ReadGuard
+{
+public:
+
+    ReadGuard(const ServantManager& manager)
+    {
+        const size_t stripe = hashThread() % ReaderStripes;
+        while(true)
+        {
+            const int epoch = manager._epoch;
+            _count = &manager._readers[epoch & 1][stripe].count;
+            ++(*_count);
+            if(manager._epoch == epoch)
+            {
+                break;
+            }
+            --(*_count);
+        }
+    }
+
+    ~ReadGuard()
+    {
+        --(*_count);
+    }
+
+private:
+
+    IceUtilInternal::Atomic* _count;
+};
+
+void
+IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity& ident, const string& facet)
+{
+    IceUtil::Mutex::Lock sync(*this);
+
+    assert(_instance); // Must not be called after destruction.
+
+    ServantEntry* entry = findEntry(ident);
+    FacetMap facets;
+    if(entry)
+    {
+        if(entry->facets.find(facet) != entry->facets.end())
         {
             AlreadyRegisteredException ex(__FILE__, __LINE__);
             ex.kindOfObject = "servant";
@@ -52,11 +157,18 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
             }
             throw ex;
         }
+        facets = entry->facets;
     }
 
-    _servantMapMapHint = p;
-
-    p->second.insert(pair<const string, ObjectPtr>(facet, object));
+    facets.insert(pair<const string, ObjectPtr>(facet, object));
+    if(entry)
+    {
+        replaceEntry(entry, new ServantEntry(ident, facets));
+    }
+    else
+    {
+        insertEntry(new ServantEntry(ident, facets));
+    }
 }
 
 void
@@ -66,8 +178,8 @@ IceInternal::ServantManager::addDefaultServant(const ObjectPtr& object, const st
 
     assert(_instance); // Must not be called after destruction.
 
-    DefaultServantMap::iterator p = _defaultServantMap.find(category);
-    if(p != _defaultServantMap.end())
+    const DefaultServantMap* defaultServantMap = _defaultServantMap.load();
+    if(defaultServantMap && defaultServantMap->find(category) != defaultServantMap->end())
     {
         AlreadyRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "default servant";
@@ -75,7 +187,14 @@ IceInternal::ServantManager::addDefaultServant(const ObjectPtr& object, const st
         throw ex;
     }
 
-    _defaultServantMap.insert(pair<const string, ObjectPtr>(category, object));
+    DefaultServantMap* m = defaultServantMap ? new DefaultServantMap(*defaultServantMap) : new DefaultServantMap;
+    m->insert(pair<const string, ObjectPtr>(category, object));
+    _defaultServantMap.store(m);
+    if(defaultServantMap)
+    {
+        synchronize();
+        delete defaultServantMap;
+    }
 }
 
 ObjectPtr
@@ -92,15 +211,10 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
+    ServantEntry* entry = findEntry(ident);
+    FacetMap::const_iterator q;
 
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
-
-    if(p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if(!entry || (q = entry->facets.find(facet)) == entry->facets.end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -114,19 +228,16 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
     }
 
     servant = q->second;
-    p->second.erase(q);
 
-    if(p->second.empty())
+    if(entry->facets.size() == 1)
     {
-        if(p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
+        replaceEntry(entry, 0);
+    }
+    else
+    {
+        FacetMap facets = entry->facets;
+        facets.erase(facet);
+        replaceEntry(entry, new ServantEntry(ident, facets));
     }
     return servant;
 }
@@ -145,8 +256,9 @@ IceInternal::ServantManager::removeDefaultServant(const string& category)
 
     assert(_instance); // Must not be called after destruction.
 
-    DefaultServantMap::iterator p = _defaultServantMap.find(category);
-    if(p == _defaultServantMap.end())
+    const DefaultServantMap* defaultServantMap = _defaultServantMap.load();
+    DefaultServantMap::const_iterator p;
+    if(!defaultServantMap || (p = defaultServantMap->find(category)) == defaultServantMap->end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "default servant";
@@ -155,7 +267,16 @@ IceInternal::ServantManager::removeDefaultServant(const string& category)
     }
 
     servant = p->second;
-    _defaultServantMap.erase(p);
+
+    DefaultServantMap* m = 0;
+    if(defaultServantMap->size() > 1)
+    {
+        m = new DefaultServantMap(*defaultServantMap);
+        m->erase(category);
+    }
+    _defaultServantMap.store(m);
+    synchronize();
+    delete defaultServantMap;
 
     return servant;
 }
@@ -167,14 +288,8 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
-
-    if(p == _servantMapMap.end())
+    ServantEntry* entry = findEntry(ident);
+    if(!entry)
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -182,145 +297,94 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
         throw ex;
     }
 
-    FacetMap result = p->second;
-
-    if(p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
-    {
-        _servantMapMap.erase(p);
-    }
-
+    FacetMap result = entry->facets;
+    replaceEntry(entry, 0);
     return result;
 }
 
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
-    IceUtil::Mutex::Lock sync(*this);
+    ReadGuard sync(*this);
 
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method might be called after the destruction if the
+    // adapter dispatch incoming requests from bidir connections. The
+    // maps are empty once the servant manager is destroyed.
     //
-    //assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
+    ServantEntry* entry = findEntry(ident);
+    if(entry)
     {
-        p = servantMapMap.find(ident);
+        FacetMap::const_iterator q = entry->facets.find(facet);
+        if(q != entry->facets.end())
+        {
+            return q->second;
+        }
     }
 
-    if(p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    const DefaultServantMap* defaultServantMap = _defaultServantMap.load();
+    if(defaultServantMap)
     {
-        DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
-        if(p == _defaultServantMap.end())
+        DefaultServantMap::const_iterator p = defaultServantMap->find(ident.category);
+        if(p == defaultServantMap->end())
         {
-            p = _defaultServantMap.find("");
-            if(p == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
-            {
-                return p->second;
-            }
+            p = defaultServantMap->find("");
         }
-        else
+        if(p != defaultServantMap->end())
         {
             return p->second;
         }
     }
-    else
-    {
-        _servantMapMapHint = p;
-        return q->second;
-    }
+    return 0;
 }
 
 ObjectPtr
 IceInternal::ServantManager::findDefaultServant(const string& category) const
 {
-    IceUtil::Mutex::Lock sync(*this);
+    ReadGuard sync(*this);
 
-    DefaultServantMap::const_iterator p = _defaultServantMap.find(category);
-    if(p == _defaultServantMap.end())
+    const DefaultServantMap* defaultServantMap = _defaultServantMap.load();
+    if(defaultServantMap)
     {
-        return 0;
-    }
-    else
-    {
-        return p->second;
+        DefaultServantMap::const_iterator p = defaultServantMap->find(category);
+        if(p != defaultServantMap->end())
+        {
+            return p->second;
+        }
     }
+    return 0;
 }
 
 FacetMap
 IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-
-    assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    ReadGuard sync(*this);
 
-    if(p == servantMapMap.end() || p->first != ident)
+    ServantEntry* entry = findEntry(ident);
+    if(entry)
     {
-        p = servantMapMap.find(ident);
-    }
-
-    if(p == servantMapMap.end())
-    {
-        return FacetMap();
+        return entry->facets;
     }
     else
     {
-        _servantMapMapHint = p;
-        return p->second;
+        return FacetMap();
     }
 }
 
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
+    ReadGuard sync(*this);
 
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method might be called after the destruction if the
+    // adapter dispatch incoming requests from bidir connections.
     //
-    //assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
 
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if(p == servantMapMap.end())
-    {
-        return false;
-    }
-    else
-    {
-        _servantMapMapHint = p;
-        assert(!p->second.empty());
-        return true;
-    }
+    ServantEntry* entry = findEntry(ident);
+    assert(!entry || !entry->facets.empty());
+    return entry != 0;
 }
 
 void
@@ -330,8 +394,8 @@ IceInternal::ServantManager::addServantLocator(const ServantLocatorPtr& locator,
 
     assert(_instance); // Must not be called after destruction.
 
-    if((_locatorMapHint != _locatorMap.end() && _locatorMapHint->first == category)
-       || _locatorMap.find(category) != _locatorMap.end())
+    const LocatorMap* locatorMap = _locatorMap.load();
+    if(locatorMap && locatorMap->find(category) != locatorMap->end())
     {
         AlreadyRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant locator";
@@ -339,7 +403,14 @@ IceInternal::ServantManager::addServantLocator(const ServantLocatorPtr& locator,
         throw ex;
     }
 
-    _locatorMapHint = _locatorMap.insert(_locatorMapHint, pair<const string, ServantLocatorPtr>(category, locator));
+    LocatorMap* m = locatorMap ? new LocatorMap(*locatorMap) : new LocatorMap;
+    m->insert(pair<const string, ServantLocatorPtr>(category, locator));
+    _locatorMap.store(m);
+    if(locatorMap)
+    {
+        synchronize();
+        delete locatorMap;
+    }
 }
 
 ServantLocatorPtr
@@ -349,21 +420,9 @@ IceInternal::ServantManager::removeServantLocator(const string& category)
 
     assert(_instance); // Must not be called after destruction.
 
-    map<string, ServantLocatorPtr>::iterator p = _locatorMap.end();
-    if(_locatorMapHint != p)
-    {
-        if(_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if(p == _locatorMap.end())
-    {
-        p = _locatorMap.find(category);
-    }
-
-    if(p == _locatorMap.end())
+    const LocatorMap* locatorMap = _locatorMap.load();
+    LocatorMap::const_iterator p;
+    if(!locatorMap || (p = locatorMap->find(category)) == locatorMap->end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant locator";
@@ -372,58 +431,55 @@ IceInternal::ServantManager::removeServantLocator(const string& category)
     }
 
     ServantLocatorPtr locator = p->second;
-    _locatorMap.erase(p);
-    _locatorMapHint = _locatorMap.begin();
+
+    LocatorMap* m = 0;
+    if(locatorMap->size() > 1)
+    {
+        m = new LocatorMap(*locatorMap);
+        m->erase(category);
+    }
+    _locatorMap.store(m);
+    synchronize();
+    delete locatorMap;
+
     return locator;
 }
 
 ServantLocatorPtr
 IceInternal::ServantManager::findServantLocator(const string& category) const
 {
-    IceUtil::Mutex::Lock sync(*this);
+    ReadGuard sync(*this);
 
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method might be called after the destruction if the
+    // adapter dispatch incoming requests from bidir connections.
     //
-    //assert(_instance); // Must not be called after destruction.
 
-    map<string, ServantLocatorPtr>& locatorMap =
-        const_cast<map<string, ServantLocatorPtr>&>(_locatorMap);
-
-    map<string, ServantLocatorPtr>::iterator p = locatorMap.end();
-    if(_locatorMapHint != locatorMap.end())
+    const LocatorMap* locatorMap = _locatorMap.load();
+    if(locatorMap)
     {
-        if(_locatorMapHint->first == category)
+        LocatorMap::const_iterator p = locatorMap->find(category);
+        if(p != locatorMap->end())
         {
-            p = _locatorMapHint;
+            return p->second;
         }
     }
-
-    if(p == locatorMap.end())
-    {
-        p = locatorMap.find(category);
-    }
-
-    if(p != locatorMap.end())
-    {
-        _locatorMapHint = p;
-        return p->second;
-    }
-    else
-    {
-        return 0;
-    }
+    return 0;
 }
 
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
     : _instance(instance),
       _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
-      _locatorMapHint(_locatorMap.end())
+      _servantTable(new ServantTable(initialTableSize))
 {
+    _epoch.exchange(0);
+    for(int i = 0; i < 2; ++i)
+    {
+        for(int j = 0; j < ReaderStripes; ++j)
+        {
+            _readers[i][j].count.exchange(0);
+        }
+    }
 }
 
 IceInternal::ServantManager::~ServantManager()
@@ -434,14 +490,24 @@ IceInternal::ServantManager::~ServantManager()
     // properly deactivated.
     //
     //assert(!_instance);
+
+    delete _servantTable.load();
+    delete _defaultServantMap.load();
+    delete _locatorMap.load();
+}
+
+void
+IceInternal::ServantManager::setAdmissionController(const AdmissionControllerPtr& admissionController)
+{
+    _admissionController = admissionController;
 }
 
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
-    DefaultServantMap defaultServantMap;
-    map<string, ServantLocatorPtr> locatorMap;
+    ServantTable* servantTable;
+    const DefaultServantMap* defaultServantMap;
+    const LocatorMap* locatorMap;
     Ice::LoggerPtr logger;
 
     {
@@ -456,46 +522,150 @@ IceInternal::ServantManager::destroy()
 
         logger = _instance->initializationData().logger;
 
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
-
-        defaultServantMap.swap(_defaultServantMap);
-
-        locatorMap.swap(_locatorMap);
-        _locatorMapHint = _locatorMap.end();
+        servantTable = _servantTable.exchange(new ServantTable(initialTableSize));
+        defaultServantMap = _defaultServantMap.exchange(0);
+        locatorMap = _locatorMap.exchange(0);
 
         _instance = 0;
+
+        synchronize();
     }
 
-    for(map<string, ServantLocatorPtr>::const_iterator p = locatorMap.begin(); p != locatorMap.end(); ++p)
+    if(locatorMap)
     {
-        try
+        for(LocatorMap::const_iterator p = locatorMap->begin(); p != locatorMap->end(); ++p)
         {
-            p->second->deactivate(p->first);
+            try
+            {
+                p->second->deactivate(p->first);
+            }
+            catch(const Exception& ex)
+            {
+                Error out(logger);
+                out << "exception during locator deactivation:\n"
+                    << "object adapter: `" << _adapterName << "'\n"
+                    << "locator category: `" << p->first << "'\n"
+                    << ex;
+            }
+            catch(...)
+            {
+                Error out(logger);
+                out << "unknown exception during locator deactivation:\n"
+                    << "object adapter: `" << _adapterName << "'\n"
+                    << "locator category: `" << p->first << "'";
+            }
         }
-        catch(const Exception& ex)
+    }
+
+    //
+    // We clear the maps outside the synchronization as we don't want to
+    // hold any internal Ice mutex while running user code (such as servant
+    // or servant locator destructors).
+    //
+    delete servantTable;
+    delete locatorMap;
+    delete defaultServantMap;
+}
+
+IceInternal::ServantManager::ServantEntry*
+IceInternal::ServantManager::findEntry(const Identity& ident) const
+{
+    const ServantTable* table = _servantTable.load();
+    for(ServantEntry* entry = table->bucket(ident).load(); entry; entry = entry->next.load())
+    {
+        if(entry->identity == ident)
         {
-            Error out(logger);
-            out << "exception during locator deactivation:\n"
-                << "object adapter: `" << _adapterName << "'\n"
-                << "locator category: `" << p->first << "'\n"
-                << ex;
+            return entry;
         }
-        catch(...)
+    }
+    return 0;
+}
+
+void
+IceInternal::ServantManager::insertEntry(ServantEntry* entry)
+{
+    //
+    // Must be called with *this locked.
+    //
+
+    ServantTable* table = _servantTable.load();
+    if(table->size > table->mask)
+    {
+        //
+        // Replace the table with a table twice as large. The entries are
+        // copied as lookups might still traverse the entries of the old
+        // table.
+        //
+        ServantTable* newTable = new ServantTable((table->mask + 1) * 2);
+        for(size_t i = 0; i <= table->mask; ++i)
         {
-            Error out(logger);
-            out << "unknown exception during locator deactivation:\n"
-                << "object adapter: `" << _adapterName << "'\n"
-                << "locator category: `" << p->first << "'";
+            for(ServantEntry* p = table->buckets[i].load(); p; p = p->next.load())
+            {
+                ServantEntry* e = new ServantEntry(p->identity, p->facets);
+                IceUtilInternal::AtomicPtr<ServantEntry>& bucket = newTable->bucket(e->identity);
+                e->next.store(bucket.load());
+                bucket.store(e);
+            }
         }
+        newTable->size = table->size;
+        _servantTable.store(newTable);
+        synchronize();
+        delete table;
+        table = newTable;
     }
 
+    IceUtilInternal::AtomicPtr<ServantEntry>& bucket = table->bucket(entry->identity);
+    entry->next.store(bucket.load());
+    bucket.store(entry);
+    ++table->size;
+}
+
+void
+IceInternal::ServantManager::replaceEntry(ServantEntry* entry, ServantEntry* newEntry)
+{
     //
-    // We clear the maps outside the synchronization as we don't want to
-    // hold any internal Ice mutex while running user code (such as servant
-    // or servant locator destructors).
+    // Must be called with *this locked. The replaced entry is deleted
+    // once no lookups reference it anymore. If the new entry is null,
+    // the entry is removed.
     //
-    servantMapMap.clear();
-    locatorMap.clear();
-    defaultServantMap.clear();
+
+    ServantTable* table = _servantTable.load();
+    IceUtilInternal::AtomicPtr<ServantEntry>* link = &table->bucket(entry->identity);
+    while(link->load() != entry)
+    {
+        link = &link->load()->next;
+    }
+
+    if(newEntry)
+    {
+        newEntry->next.store(entry->next.load());
+        link->store(newEntry);
+    }
+    else
+    {
+        link->store(entry->next.load());
+        --table->size;
+    }
+
+    synchronize();
+    delete entry;
+}
+
+void
+IceInternal::ServantManager::synchronize()
+{
+    //
+    // Must be called with *this locked. Start a new epoch and wait for
+    // the lookups of the previous epoch to complete. Lookups which start
+    // after this no longer see the data replaced before the call.
+    //
+    const int epoch = _epoch;
+    _epoch.exchange((epoch + 1) & 0x7fffffff);
+    for(int i = 0; i < ReaderStripes; ++i)
+    {
+        while(_readers[epoch & 1][i].count != 0)
+        {
+            IceUtil::ThreadControl::yield();
+        }
+    }
 }
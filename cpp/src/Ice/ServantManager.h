@@ -12,9 +12,11 @@
 
 #include <IceUtil/Shared.h>
 #include <IceUtil/Mutex.h>
+#include <IceUtil/Atomic.h>
 #include <Ice/ServantManagerF.h>
 #include <Ice/InstanceF.h>
 #include <Ice/ServantLocatorF.h>
+#include <Ice/AdmissionControllerF.h>
 #include <Ice/Identity.h>
 #include <Ice/FacetMap.h>
 
@@ -28,6 +30,14 @@ class ObjectAdapterI;
 namespace IceInternal
 {
 
+//
+// The servant manager maps are read without locking: lookups don't
+// acquire the mutex, which only serializes the updates. An update never
+// modifies data visible to lookups in place, it publishes new entries
+// or maps with atomic pointers. The replaced data is deleted once all
+// the lookups which might still reference it have completed (see
+// synchronize()).
+//
 class ServantManager : public IceUtil::Shared, public IceUtil::Mutex
 {
 public:
@@ -46,27 +56,64 @@ public:
     Ice::ServantLocatorPtr removeServantLocator(const std::string&);
     Ice::ServantLocatorPtr findServantLocator(const std::string&) const;
 
+    //
+    // The admission controller of the adapter, null if the adapter
+    // doesn't use admission control.
+    //
+    const AdmissionControllerPtr& getAdmissionController() const
+    {
+        return _admissionController;
+    }
+
 private:
 
     ServantManager(const InstancePtr&, const std::string&);
     ~ServantManager();
     void destroy();
+    void setAdmissionController(const AdmissionControllerPtr&);
     friend class Ice::ObjectAdapterI;
 
     InstancePtr _instance;
 
     const std::string _adapterName;
 
-    typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
-    typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
+    //
+    // Set by the adapter before it's activated and immutable afterwards,
+    // it's read without locking like the maps.
+    //
+    AdmissionControllerPtr _admissionController;
 
-    ServantMapMap _servantMapMap;
-    mutable ServantMapMap::iterator _servantMapMapHint;
+    class ReadGuard;
+    friend class ReadGuard;
 
-    DefaultServantMap _defaultServantMap;
+    struct ServantEntry;
+    struct ServantTable;
 
-    std::map<std::string, Ice::ServantLocatorPtr> _locatorMap;
-    mutable std::map<std::string, Ice::ServantLocatorPtr>::iterator _locatorMapHint;
+    typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
+    typedef std::map<std::string, Ice::ServantLocatorPtr> LocatorMap;
+
+    ServantEntry* findEntry(const Ice::Identity&) const;
+    void insertEntry(ServantEntry*);
+    void replaceEntry(ServantEntry*, ServantEntry*);
+    void synchronize();
+
+    IceUtilInternal::AtomicPtr<ServantTable> _servantTable;
+    IceUtilInternal::AtomicPtr<const DefaultServantMap> _defaultServantMap;
+    IceUtilInternal::AtomicPtr<const LocatorMap> _locatorMap;
+
+    //
+    // The lookups in progress are counted in the reader counts of the
+    // current epoch. The counts are spread over several cache lines to
+    // avoid contention between lookups from different threads.
+    //
+    enum { ReaderStripes = 16 };
+    struct ReaderCount
+    {
+        IceUtilInternal::Atomic count;
+        char padding[64];
+    };
+    IceUtilInternal::Atomic _epoch;
+    mutable ReaderCount _readers[2][ReaderStripes];
 };
 
 }
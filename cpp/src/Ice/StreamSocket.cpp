@@ -228,6 +228,102 @@ StreamSocket::write(Buffer& buf)
     return buf.i != buf.b.end() ? SocketOperationWrite : SocketOperationNone;
 }
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+SocketOperation
+StreamSocket::write(std::vector<Buffer*>& buffers)
+{
+    assert(_fd != INVALID_SOCKET);
+
+    std::vector<Buffer*>::iterator first = buffers.begin();
+    while(true)
+    {
+        while(first != buffers.end() && (*first)->i == (*first)->b.end())
+        {
+            ++first;
+        }
+
+        if(first == buffers.end())
+        {
+            return SocketOperationNone;
+        }
+
+        if(_state == StateProxyWrite || first + 1 == buffers.end())
+        {
+            //
+            // The proxy handshake and single buffers are written with the
+            // regular write, the proxy needs to be notified of each write.
+            //
+            SocketOperation op = write(**first);
+            if(op != SocketOperationNone)
+            {
+                return op;
+            }
+            continue;
+        }
+
+        //
+        // Gather the pending data of the remaining buffers in a single
+        // sendmsg() call.
+        //
+        const size_t maxIov = 64;
+        struct iovec iov[maxIov];
+        size_t count = 0;
+        for(std::vector<Buffer*>::iterator p = first; p != buffers.end() && count < maxIov; ++p)
+        {
+            iov[count].iov_base = reinterpret_cast<char*>(&*(*p)->i);
+            iov[count].iov_len = static_cast<size_t>((*p)->b.end() - (*p)->i);
+            ++count;
+        }
+
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = count;
+
+        ssize_t ret = ::sendmsg(_fd, &msg, 0);
+        if(ret == 0)
+        {
+            Ice::ConnectionLostException ex(__FILE__, __LINE__);
+            ex.error = 0;
+            throw ex;
+        }
+        else if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            if(connectionLost())
+            {
+                Ice::ConnectionLostException ex(__FILE__, __LINE__);
+                ex.error = getSocketErrno();
+                throw ex;
+            }
+            else
+            {
+                Ice::SocketException ex(__FILE__, __LINE__);
+                ex.error = getSocketErrno();
+                throw ex;
+            }
+        }
+
+        size_t sent = static_cast<size_t>(ret);
+        for(std::vector<Buffer*>::iterator p = first; sent > 0; ++p)
+        {
+            size_t length = std::min(sent, static_cast<size_t>((*p)->b.end() - (*p)->i));
+            (*p)->i += length;
+            sent -= length;
+        }
+    }
+}
+#endif
+
 #if !defined(ICE_OS_UWP)
 ssize_t
 StreamSocket::read(char* buf, size_t length)
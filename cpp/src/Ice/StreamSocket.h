@@ -35,6 +35,9 @@ public:
 
     SocketOperation read(Buffer&);
     SocketOperation write(Buffer&);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    SocketOperation write(std::vector<Buffer*>&);
+#endif
 
 #if !defined(ICE_OS_UWP)
     ssize_t read(char*, size_t);
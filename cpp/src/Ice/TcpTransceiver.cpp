@@ -56,6 +56,14 @@ IceInternal::TcpTransceiver::read(Buffer& buf)
     return _stream->read(buf);
 }
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+SocketOperation
+IceInternal::TcpTransceiver::writeBuffers(vector<Buffer*>& buffers)
+{
+    return _stream->write(buffers);
+}
+#endif
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
 bool
 IceInternal::TcpTransceiver::startWrite(Buffer& buf)
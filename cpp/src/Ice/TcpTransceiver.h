@@ -33,6 +33,9 @@ public:
     virtual void close();
     virtual SocketOperation write(Buffer&);
     virtual SocketOperation read(Buffer&);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    virtual SocketOperation writeBuffers(std::vector<Buffer*>&);
+#endif
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&);
     virtual void finishWrite(Buffer&);
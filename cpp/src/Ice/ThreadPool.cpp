@@ -17,6 +17,7 @@
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Properties.h>
 #include <Ice/TraceLevels.h>
+#include <Ice/InstrumentationI.h>
 
 #if defined(ICE_OS_UWP)
 #   include <Ice/StringConverter.h>
@@ -248,7 +249,7 @@ IceInternal::ThreadPoolWorkQueue::getNativeInfo()
     return 0;
 }
 
-IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout) :
+IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout, ThreadPool* parent) :
     _instance(instance),
     _dispatcher(_instance->initializationData().dispatcher),
     _destroyed(false),
@@ -267,8 +268,15 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _stackSize(0),
     _inUse(0),
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _parent(parent),
+    _reactorId(parent ? parent->_reactors.size() : 0),
+    _workStealing(_instance->initializationData().properties->getPropertyAsInt(_prefix + ".ReactorWorkStealing") > 0),
+    _nextReactor(0),
+    _handlerCount(0),
     _inUseIO(0),
     _nextHandler(_handlers.end()),
+    _dispatchThreads(0),
+    _dispatchDestroyed(false),
 #endif
     _promote(true)
 {
@@ -342,6 +350,49 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
 #endif
     const_cast<int&>(_threadIdleTime) = threadIdleTime;
 
+    //
+    // A thread pool with several reactors is sharded: each reactor is a thread pool with
+    // its own selector and threads and the event handlers are spread over the reactors.
+    // The Size, SizeMax and SizeWarn properties apply to each reactor.
+    //
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    int reactors = _parent ? 1 : properties->getPropertyAsIntWithDefault(_prefix + ".Reactors", 1);
+    if(reactors < 1)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".Reactors < 1; Reactors adjusted to 1";
+        reactors = 1;
+    }
+#else
+    if(properties->getPropertyAsIntWithDefault(_prefix + ".Reactors", 1) > 1)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".Reactors is not supported with this platform; Reactors adjusted to 1";
+    }
+#endif
+
+    //
+    // With dispatch threads, the threads of the thread pool only perform IO and the messages
+    // are dispatched by the dispatch threads. With a sharded thread pool, each reactor has its
+    // own dispatch threads.
+    //
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    int dispatchThreads = properties->getPropertyAsInt(_prefix + ".DispatchThreads");
+    if(dispatchThreads < 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".DispatchThreads < 0; DispatchThreads adjusted to 0";
+        dispatchThreads = 0;
+    }
+    const_cast<int&>(_dispatchThreads) = reactors > 1 ? 0 : dispatchThreads;
+#else
+    if(properties->getPropertyAsInt(_prefix + ".DispatchThreads") > 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".DispatchThreads is not supported with this platform; DispatchThreads adjusted to 0";
+    }
+#endif
+
 #ifdef ICE_USE_IOCP
     _selector.setup(_sizeIO);
 #endif
@@ -375,17 +426,33 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _workQueue = ICE_MAKE_SHARED(ThreadPoolWorkQueue, *this);
     _selector.initialize(_workQueue.get());
 
-    if(_instance->traceLevels()->threadPool >= 1)
+    if(_instance->traceLevels()->threadPool >= 1 && !_parent)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
         out << "creating " << _prefix << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = "
             << _sizeWarn;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        if(reactors > 1)
+        {
+            out << ", Reactors = " << reactors;
+        }
+        if(dispatchThreads > 0)
+        {
+            out << ", DispatchThreads = " << dispatchThreads;
+        }
+#endif
     }
 
     __setNoDelete(true);
     try
     {
-        for(int i = 0 ; i < _size ; ++i)
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        for(int i = 0; reactors > 1 && i < reactors; ++i)
+        {
+            _reactors.push_back(new ThreadPool(_instance, _prefix, timeout, this));
+        }
+#endif
+        for(int i = 0 ; i < _size && _reactors.empty(); ++i)
         {
             EventHandlerThreadPtr thread = new EventHandlerThread(this, nextThreadId());
             if(_hasPriority)
@@ -398,6 +465,26 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
             }
             _threads.insert(thread);
         }
+
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        for(int i = 0; i < _dispatchThreads; ++i)
+        {
+            _dispatchQueues.push_back(new DispatchQueue());
+        }
+        for(int i = 0; i < _dispatchThreads; ++i)
+        {
+            EventHandlerThreadPtr thread = new EventHandlerThread(this, nextThreadId(), i);
+            if(_hasPriority)
+            {
+                thread->start(_stackSize, _priority);
+            }
+            else
+            {
+                thread->start(_stackSize);
+            }
+            _dispatchers.insert(thread);
+        }
+#endif
     }
     catch(const IceUtil::Exception& ex)
     {
@@ -422,6 +509,12 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
 IceInternal::ThreadPool::~ThreadPool()
 {
     assert(_destroyed);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    for(vector<DispatchQueue*>::const_iterator p = _dispatchQueues.begin(); p != _dispatchQueues.end(); ++p)
+    {
+        delete *p;
+    }
+#endif
 }
 
 void
@@ -434,6 +527,22 @@ IceInternal::ThreadPool::destroy()
     }
     _destroyed = true;
     _workQueue->destroy();
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        (*p)->destroy();
+    }
+
+    if(_dispatchThreads > 0)
+    {
+        //
+        // The dispatch threads terminate once their queues are empty.
+        //
+        IceUtil::Monitor<IceUtil::Mutex>::Lock syncDispatch(_dispatchMonitor);
+        _dispatchDestroyed = true;
+        _dispatchMonitor.notifyAll();
+    }
+#endif
 }
 
 void
@@ -444,14 +553,42 @@ IceInternal::ThreadPool::updateObservers()
     {
         (*p)->updateObserver();
     }
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        (*p)->updateObservers();
+    }
+
+    //
+    // The observers of the dispatch threads are protected by the dispatch monitor.
+    //
+    IceUtil::Monitor<IceUtil::Mutex>::Lock syncDispatch(_dispatchMonitor);
+    for(set<EventHandlerThreadPtr>::iterator p = _dispatchers.begin(); p != _dispatchers.end(); ++p)
+    {
+        (*p)->updateObserver();
+    }
+#endif
 }
 
 void
 IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(!_reactors.empty())
+    {
+        ThreadPool* reactor = nextReactor();
+        handler->_reactor = reactor;
+        reactor->initialize(handler);
+        return;
+    }
+#endif
+
     Lock sync(*this);
     assert(!_destroyed);
     _selector.initialize(handler.get());
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    ++_handlerCount;
+#endif
 
     class ReadyCallbackI : public ReadyCallback
     {
@@ -479,6 +616,14 @@ IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 void
 IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation remove, SocketOperation add)
 {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(!_reactors.empty())
+    {
+        reactor(handler)->update(handler, remove, add);
+        return;
+    }
+#endif
+
     Lock sync(*this);
     assert(!_destroyed);
 
@@ -499,9 +644,18 @@ IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation
 bool
 IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(!_reactors.empty())
+    {
+        return reactor(handler)->finish(handler, closeNow);
+    }
+#endif
+
     Lock sync(*this);
     assert(!_destroyed);
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    assert(_handlerCount > 0);
+    --_handlerCount;
     closeNow = _selector.finish(handler.get(), closeNow); // This must be called before!
     _workQueue->queue(new FinishedWorkItem(handler, !closeNow));
     return closeNow;
@@ -523,6 +677,14 @@ IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 void
 IceInternal::ThreadPool::ready(const EventHandlerPtr& handler, SocketOperation op, bool value)
 {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(!_reactors.empty())
+    {
+        reactor(handler)->ready(handler, op, value);
+        return;
+    }
+#endif
+
     Lock sync(*this);
     if(_destroyed)
     {
@@ -574,6 +736,14 @@ IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workI
 void
 IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem)
 {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(!_reactors.empty())
+    {
+        dispatchReactor(workItem)->dispatch(workItem);
+        return;
+    }
+#endif
+
     Lock sync(*this);
     if(_destroyed)
     {
@@ -597,6 +767,16 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         (*p)->getThreadControl().join();
     }
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        (*p)->joinWithAllThreads();
+    }
+    for(set<EventHandlerThreadPtr>::iterator p = _dispatchers.begin(); p != _dispatchers.end(); ++p)
+    {
+        (*p)->getThreadControl().join();
+    }
+#endif
     _selector.destroy();
 }
 
@@ -606,6 +786,21 @@ IceInternal::ThreadPool::prefix() const
     return _prefix;
 }
 
+int
+IceInternal::ThreadPool::dispatchQueueSize() const
+{
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    //
+    // The pending work items include the work items being dispatched
+    // by the dispatch threads which aren't idle.
+    //
+    int queued = _dispatchPending - (_dispatchThreads - _dispatchIdle);
+    return queued > 0 ? queued : 0;
+#else
+    return 0;
+#endif
+}
+
 void
 IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
 {
@@ -644,8 +839,13 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             }
             catch(const SelectorTimeoutException&)
             {
+                //
+                // The reactor of a sharded thread pool is only idle if all the other reactors are
+                // idle as well. This is checked before locking to respect the locking order.
+                //
+                bool idle = !_parent || _parent->idle();
                 Lock sync(*this);
-                if(!_destroyed && _inUse == 0)
+                if(!_destroyed && _inUse == 0 && _dispatchPending == 0 && idle)
                 {
                     _workQueue->queue(new ShutdownWorkItem(_instance)); // Select timed-out.
                 }
@@ -684,7 +884,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
                     // If the handler called ioCompleted(), we re-enable the handler in
                     // case it was disabled and we decrease the number of thread in use.
                     //
-                    if(_serialize && current._handler.get() != _workQueue.get())
+                    if(_serialize && current._handler.get() != _workQueue.get() && !current._dispatchQueued)
                     {
                         _selector.enable(current._handler.get(), current.operation);
                     }
@@ -709,6 +909,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             if(_nextHandler != _handlers.end())
             {
                 current._ioCompleted = false;
+                current._dispatchQueued = false;
                 current._handler = ICE_GET_SHARED_FROM_THIS(_nextHandler->first);
                 current.operation = _nextHandler->second;
                 ++_nextHandler;
@@ -1082,6 +1283,243 @@ IceInternal::ThreadPool::promoteFollower(ThreadPoolCurrent& current)
     current._leader = false;
 }
 
+ThreadPool*
+IceInternal::ThreadPool::reactor(const EventHandlerPtr& handler) const
+{
+    assert(handler->_reactor);
+    return handler->_reactor;
+}
+
+ThreadPool*
+IceInternal::ThreadPool::nextReactor()
+{
+    //
+    // Assign the event handler to the reactor with the fewest event handlers, the
+    // round-robin starting point ensures reactors with the same count are used in
+    // turn.
+    //
+    Lock sync(*this);
+    assert(!_reactors.empty());
+    ThreadPool* reactor = 0;
+    size_t count = 0;
+    for(size_t i = 0; i < _reactors.size(); ++i)
+    {
+        ThreadPool* p = _reactors[(_nextReactor + i) % _reactors.size()].get();
+        Lock syncReactor(*p);
+        if(!reactor || p->_handlerCount < count)
+        {
+            reactor = p;
+            count = p->_handlerCount;
+        }
+    }
+    _nextReactor = (_nextReactor + 1) % _reactors.size();
+    return reactor;
+}
+
+ThreadPool*
+IceInternal::ThreadPool::dispatchReactor(const DispatchWorkItemPtr& workItem)
+{
+    //
+    // Work items for a connection are dispatched by the reactor of the connection
+    // unless work stealing is enabled. With work stealing, the work item is handed
+    // off to the reactor with the fewest threads in use so that a busy reactor
+    // doesn't delay dispatching.
+    //
+    if(!_workStealing && workItem->getConnection())
+    {
+        EventHandler* handler = dynamic_cast<EventHandler*>(workItem->getConnection().get());
+        if(handler && handler->_reactor)
+        {
+            return handler->_reactor;
+        }
+    }
+
+    Lock sync(*this);
+    assert(!_reactors.empty());
+    ThreadPool* reactor = 0;
+    int inUse = 0;
+    for(size_t i = 0; i < _reactors.size(); ++i)
+    {
+        ThreadPool* p = _reactors[(_nextReactor + i) % _reactors.size()].get();
+        if(!_workStealing)
+        {
+            reactor = p;
+            break;
+        }
+
+        Lock syncReactor(*p);
+        if(!reactor || p->_inUse < inUse)
+        {
+            reactor = p;
+            inUse = p->_inUse;
+        }
+    }
+    _nextReactor = (_nextReactor + 1) % _reactors.size();
+    return reactor;
+}
+
+bool
+IceInternal::ThreadPool::idle()
+{
+    for(vector<ThreadPoolPtr>::const_iterator p = _reactors.begin(); p != _reactors.end(); ++p)
+    {
+        Lock sync(**p);
+        if((*p)->_inUse > 0 || (*p)->_dispatchPending > 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+IceInternal::ThreadPool::queueDispatch(ThreadPoolCurrent& current, const DispatchWorkItemPtr& workItem)
+{
+    DispatchEntry entry;
+    entry.workItem = workItem;
+    entry.operation = current.operation;
+    entry.queued = IceUtil::Time::now(IceUtil::Time::Monotonic);
+
+    //
+    // With serialization, the handler was disabled by ioCompleted() and it's re-enabled by
+    // the dispatch thread once the dispatch completes instead of once message() returns.
+    //
+    if(_serialize && current._ioCompleted && current._handler.get() != _workQueue.get())
+    {
+        entry.handler = current._handler;
+        current._dispatchQueued = true;
+    }
+
+    //
+    // The work items of a connection are queued to the same queue to preserve their order
+    // unless they are stolen by another dispatch thread.
+    //
+    size_t index;
+    if(workItem->getConnection())
+    {
+        index = reinterpret_cast<size_t>(workItem->getConnection().get()) / sizeof(void*);
+    }
+    else
+    {
+        index = static_cast<unsigned int>(_nextDispatchQueue++);
+    }
+    DispatchQueue& queue = *_dispatchQueues[index % _dispatchQueues.size()];
+
+    ++_dispatchPending;
+    {
+        IceUtil::Mutex::Lock sync(queue);
+        queue.entries.push_back(entry);
+    }
+
+    //
+    // A dispatch thread increments the idle count before checking the queues for the last
+    // time, so it's either going to find the work item or be notified.
+    //
+    if(_dispatchIdle > 0)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_dispatchMonitor);
+        _dispatchMonitor.notify();
+    }
+}
+
+void
+IceInternal::ThreadPool::runDispatch(const EventHandlerThreadPtr& thread)
+{
+    const size_t index = static_cast<size_t>(thread->dispatchQueue());
+    const bool observer = _instance->initializationData().observer != ICE_NULLPTR;
+    while(true)
+    {
+        EventHandlerPtr handler;
+        SocketOperation operation;
+        DispatchWorkItemPtr workItem;
+        IceUtil::Time queued;
+        if(!nextDispatch(index, handler, operation, workItem, queued))
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_dispatchMonitor);
+            ++_dispatchIdle;
+            bool destroyed = false;
+            while(!nextDispatch(index, handler, operation, workItem, queued))
+            {
+                if(_dispatchDestroyed)
+                {
+                    destroyed = true;
+                    break;
+                }
+                _dispatchMonitor.wait();
+            }
+            --_dispatchIdle;
+            if(destroyed)
+            {
+                return;
+            }
+        }
+
+        if(observer)
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_dispatchMonitor);
+            thread->dispatched(IceUtil::Time::now(IceUtil::Time::Monotonic) - queued);
+            thread->setState(ICE_ENUM(ThreadState, ThreadStateInUseForUser));
+        }
+
+        try
+        {
+            dispatchFromThisThread(workItem);
+        }
+        catch(const exception& ex)
+        {
+            Error out(_instance->initializationData().logger);
+            out << "exception in `" << _prefix << "':\n" << ex;
+        }
+        catch(...)
+        {
+            Error out(_instance->initializationData().logger);
+            out << "unknown exception in `" << _prefix << "'";
+        }
+        workItem = 0;
+
+        if(handler)
+        {
+            Lock sync(*this);
+            _selector.enable(handler.get(), operation);
+        }
+        --_dispatchPending;
+
+        if(observer)
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_dispatchMonitor);
+            thread->setState(ICE_ENUM(ThreadState, ThreadStateIdle));
+        }
+    }
+}
+
+bool
+IceInternal::ThreadPool::nextDispatch(size_t index, EventHandlerPtr& handler, SocketOperation& operation,
+                                      DispatchWorkItemPtr& workItem, IceUtil::Time& queued)
+{
+    //
+    // Take the oldest work item from the queue of this dispatch thread or otherwise steal
+    // the oldest work item of another queue. Stealing the oldest work item keeps the
+    // dispatch order close to the arrival order, the time spent in the queue by the work
+    // items reflects the queue length (see AdmissionController).
+    //
+    for(size_t i = 0; i < _dispatchQueues.size(); ++i)
+    {
+        DispatchQueue& queue = *_dispatchQueues[(index + i) % _dispatchQueues.size()];
+        IceUtil::Mutex::Lock sync(queue);
+        if(!queue.entries.empty())
+        {
+            DispatchEntry& entry = queue.entries.front();
+            workItem = entry.workItem;
+            handler = entry.handler;
+            operation = entry.operation;
+            queued = entry.queued;
+            queue.entries.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
 bool
 IceInternal::ThreadPool::followerWait(ThreadPoolCurrent& current)
 {
@@ -1137,14 +1575,23 @@ string
 IceInternal::ThreadPool::nextThreadId()
 {
     ostringstream os;
-    os << _prefix << "-" << _nextThreadId++;
+    os << _prefix << "-";
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    if(_parent)
+    {
+        os << _reactorId << "-";
+    }
+#endif
+    os << _nextThreadId++;
     return os.str();
 }
 
-IceInternal::ThreadPool::EventHandlerThread::EventHandlerThread(const ThreadPoolPtr& pool, const string& name) :
+IceInternal::ThreadPool::EventHandlerThread::EventHandlerThread(const ThreadPoolPtr& pool, const string& name,
+                                                               int dispatchQueue) :
     IceUtil::Thread(name),
     _pool(pool),
-    _state(ICE_ENUM(ThreadState, ThreadStateIdle))
+    _state(ICE_ENUM(ThreadState, ThreadStateIdle)),
+    _dispatchQueue(dispatchQueue)
 {
     updateObserver();
 }
@@ -1174,6 +1621,25 @@ IceInternal::ThreadPool::EventHandlerThread::setState(Ice::Instrumentation::Thre
     _state = s;
 }
 
+void
+IceInternal::ThreadPool::EventHandlerThread::dispatched(const IceUtil::Time& waitTime)
+{
+    //
+    // The time spent by the work items in the dispatch queues is only
+    // recorded by the metrics of the built-in observer, it's not part
+    // of the instrumentation interface.
+    //
+#ifdef ICE_CPP11_MAPPING
+    ThreadObserverI* observer = dynamic_cast<ThreadObserverI*>(_observer.get().get());
+#else
+    ThreadObserverI* observer = dynamic_cast<ThreadObserverI*>(_observer.get());
+#endif
+    if(observer)
+    {
+        observer->dispatched(waitTime.toMicroSeconds());
+    }
+}
+
 void
 IceInternal::ThreadPool::EventHandlerThread::run()
 {
@@ -1205,7 +1671,16 @@ IceInternal::ThreadPool::EventHandlerThread::run()
 
     try
     {
-        _pool->run(this);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        if(_dispatchQueue >= 0)
+        {
+            _pool->runDispatch(this);
+        }
+        else
+#endif
+        {
+            _pool->run(this);
+        }
     }
     catch(const exception& ex)
     {
@@ -1259,6 +1734,7 @@ ThreadPoolCurrent::ThreadPoolCurrent(const InstancePtr& instance,
     _ioCompleted(false)
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     , _leader(false)
+    , _dispatchQueued(false)
 #endif
 {
 }
@@ -14,6 +14,7 @@
 #include <IceUtil/Mutex.h>
 #include <IceUtil/Monitor.h>
 #include <IceUtil/Thread.h>
+#include <IceUtil/Atomic.h>
 
 #include <Ice/Config.h>
 #include <Ice/Dispatcher.h>
@@ -28,6 +29,7 @@
 
 #include <set>
 #include <list>
+#include <deque>
 
 namespace IceInternal
 {
@@ -72,23 +74,30 @@ class ThreadPool : public IceUtil::Shared, private IceUtil::Monitor<IceUtil::Mut
     {
     public:
 
-        EventHandlerThread(const ThreadPoolPtr&, const std::string&);
+        EventHandlerThread(const ThreadPoolPtr&, const std::string&, int = -1);
         virtual void run();
 
         void updateObserver();
         void setState(Ice::Instrumentation::ThreadState);
+        void dispatched(const IceUtil::Time&);
+
+        int dispatchQueue() const
+        {
+            return _dispatchQueue;
+        }
 
     private:
 
         ThreadPoolPtr _pool;
         ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
         Ice::Instrumentation::ThreadState _state;
+        const int _dispatchQueue; // The dispatch queue of a dispatch thread, -1 for an IO thread.
     };
     typedef IceUtil::Handle<EventHandlerThread> EventHandlerThreadPtr;
 
 public:
 
-    ThreadPool(const InstancePtr&, const std::string&, int);
+    ThreadPool(const InstancePtr&, const std::string&, int, ThreadPool* = 0);
     virtual ~ThreadPool();
 
     void destroy();
@@ -115,10 +124,28 @@ public:
 
     std::string prefix() const;
 
+    //
+    // The approximate number of work items waiting for a dispatch
+    // thread, computed without locking the dispatch queues. It's 0
+    // if the thread pool doesn't use dispatch threads.
+    //
+    int dispatchQueueSize() const;
+
 private:
 
     void run(const EventHandlerThreadPtr&);
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    ThreadPool* reactor(const EventHandlerPtr&) const;
+    ThreadPool* nextReactor();
+    ThreadPool* dispatchReactor(const DispatchWorkItemPtr&);
+    bool idle();
+
+    void queueDispatch(ThreadPoolCurrent&, const DispatchWorkItemPtr&);
+    void runDispatch(const EventHandlerThreadPtr&);
+    bool nextDispatch(size_t, EventHandlerPtr&, SocketOperation&, DispatchWorkItemPtr&, IceUtil::Time&);
+#endif
+
     bool ioCompleted(ThreadPoolCurrent&);
 
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
@@ -161,9 +188,43 @@ private:
     std::set<EventHandlerThreadPtr> _threads; // All threads, running or not.
     int _inUse; // Number of threads that are currently in use.
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    ThreadPool* _parent; // The sharded thread pool if this thread pool is one of its reactors.
+    const size_t _reactorId;
+    std::vector<ThreadPoolPtr> _reactors; // The reactors if this thread pool is sharded.
+    const bool _workStealing; // True if dispatch work items can be handed off to the least busy reactor.
+    size_t _nextReactor;
+    size_t _handlerCount; // Number of event handlers initialized with this reactor.
     int _inUseIO; // Number of threads that are currently performing IO.
     std::vector<std::pair<EventHandler*, SocketOperation> > _handlers;
     std::vector<std::pair<EventHandler*, SocketOperation> >::const_iterator _nextHandler;
+
+    //
+    // With dispatch threads, the IO threads only read messages and queue the dispatch of
+    // the messages. Each dispatch thread has its own queue and steals work items from the
+    // queues of the other dispatch threads when its queue is empty. The work items of a
+    // connection are queued to the same queue.
+    //
+    struct DispatchEntry
+    {
+        DispatchWorkItemPtr workItem;
+        EventHandlerPtr handler; // The handler to re-enable after the dispatch with serialization.
+        SocketOperation operation;
+        IceUtil::Time queued;
+    };
+
+    struct DispatchQueue : public IceUtil::Mutex
+    {
+        std::deque<DispatchEntry> entries;
+    };
+
+    const int _dispatchThreads; // Number of dispatch threads, 0 if IO threads dispatch messages.
+    std::vector<DispatchQueue*> _dispatchQueues;
+    std::set<EventHandlerThreadPtr> _dispatchers;
+    IceUtil::Monitor<IceUtil::Mutex> _dispatchMonitor;
+    bool _dispatchDestroyed;
+    IceUtilInternal::Atomic _dispatchIdle; // Number of dispatch threads waiting for work.
+    IceUtilInternal::Atomic _dispatchPending; // Number of work items queued or being dispatched.
+    IceUtilInternal::Atomic _nextDispatchQueue;
 #endif
 
     bool _promote;
@@ -202,9 +263,30 @@ public:
 
     void dispatchFromThisThread(const DispatchWorkItemPtr& workItem)
     {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        if(_threadPool->_dispatchThreads > 0)
+        {
+            _threadPool->queueDispatch(*this, workItem);
+            return;
+        }
+#endif
         _threadPool->dispatchFromThisThread(workItem);
     }
 
+    //
+    // Returns true if the messages are dispatched by dispatch threads,
+    // in which case the event handler must dispatch its messages with
+    // dispatchFromThisThread.
+    //
+    bool hasDispatchThreads() const
+    {
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+        return _threadPool->_dispatchThreads > 0;
+#else
+        return false;
+#endif
+    }
+
 private:
 
     ThreadPool* _threadPool;
@@ -213,6 +295,7 @@ private:
     bool _ioCompleted;
 #if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
     bool _leader;
+    bool _dispatchQueued; // True if the handler is re-enabled by a dispatch thread.
 #else
     DWORD _count;
     int _error;
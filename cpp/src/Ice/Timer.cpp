@@ -11,10 +11,454 @@
 #include <IceUtil/Exception.h>
 #include <Ice/ConsoleUtil.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace IceUtil;
 using namespace IceInternal;
 
+namespace
+{
+
+//
+// The timing wheel has 4 levels of 256 slots. With a 1ms tick, the
+// first level covers 256ms, the second 65s, the third 4.6 hours and the
+// last 49 days. Tasks scheduled further away are kept in the last level
+// until they get closer.
+//
+const int wheelBits = 8;
+const int wheelSize = 1 << wheelBits;
+const IceUtil::Int64 wheelMask = wheelSize - 1;
+const int wheelLevels = 4;
+const IceUtil::Int64 wheelRange = ICE_INT64(1) << (wheelBits * wheelLevels);
+
+//
+// The maximum number of entries kept for re-use.
+//
+const size_t maxFreeEntries = 1024;
+
+}
+
+//
+// A hierarchical timing wheel (see "Hashed and Hierarchical Timing
+// Wheels", Varghese & Lauck). The tasks are also kept in a hash table
+// indexed by the task pointer to cancel them in constant time. The
+// timing wheel isn't thread safe, it's protected by the timer monitor.
+//
+class Timer::TimingWheel
+{
+public:
+
+    struct Entry
+    {
+        IceUtil::Int64 expiration; // The expiration tick.
+        IceUtil::Time delay; // The delay of repeated tasks.
+        TimerTaskPtr task;
+        int slot; // The slot of the entry, -1 if the entry expired.
+        Entry* prev;
+        Entry* next;
+        Entry* hashNext;
+    };
+
+    TimingWheel(const IceUtil::Time& tick) :
+        _start(IceUtil::Time::now(IceUtil::Time::Monotonic)),
+        _tick(tick.toMicroSeconds()),
+        _current(0),
+        _count(0),
+        _size(0),
+        _buckets(64)
+    {
+        if(_tick <= 0)
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "invalid timer tick");
+        }
+        for(int i = 0; i < wheelSize * wheelLevels; ++i)
+        {
+            _slots[i] = 0;
+        }
+    }
+
+    ~TimingWheel()
+    {
+        clear();
+        for(vector<Entry*>::const_iterator p = _free.begin(); p != _free.end(); ++p)
+        {
+            delete *p;
+        }
+    }
+
+    bool
+    empty() const
+    {
+        return _count == 0;
+    }
+
+    //
+    // Schedule the task and return the time at which it will run.
+    //
+    IceUtil::Time
+    schedule(const TimerTaskPtr& task, const IceUtil::Time& time, const IceUtil::Time& delay)
+    {
+        if(find(task))
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        }
+
+        Entry* entry;
+        if(_free.empty())
+        {
+            entry = new Entry;
+        }
+        else
+        {
+            entry = _free.back();
+            _free.pop_back();
+        }
+        entry->expiration = max(toTick(time), _current);
+        entry->delay = delay;
+        entry->task = task;
+        addToIndex(entry);
+        insert(entry);
+        return toTime(entry->expiration);
+    }
+
+    bool
+    cancel(const TimerTaskPtr& task)
+    {
+        Entry* entry = find(task);
+        if(!entry)
+        {
+            return false;
+        }
+
+        removeFromIndex(entry);
+
+        //
+        // If the entry expired, it's a repeated task which is running. The
+        // timer thread releases it once the task returns.
+        //
+        if(entry->slot >= 0)
+        {
+            unlink(entry);
+            release(entry);
+        }
+        return true;
+    }
+
+    //
+    // Collect the entries which expired at the given time. One-shot tasks
+    // are removed from the index, they can no longer be canceled. Repeated
+    // tasks remain in the index until they're rescheduled.
+    //
+    void
+    expire(const IceUtil::Time& now, vector<Entry*>& expired)
+    {
+        const IceUtil::Int64 last = (now - _start).toMicroSeconds() / _tick;
+        while(_count > 0 && _current <= last)
+        {
+            const int index = static_cast<int>(_current & wheelMask);
+            if(index == 0)
+            {
+                for(int level = 1; level < wheelLevels; ++level)
+                {
+                    const int i = static_cast<int>((_current >> (wheelBits * level)) & wheelMask);
+                    cascade(level * wheelSize + i);
+                    if(i != 0)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            Entry* entry = _slots[index];
+            _slots[index] = 0;
+            while(entry)
+            {
+                Entry* next = entry->next;
+                entry->slot = -1;
+                if(entry->delay == IceUtil::Time())
+                {
+                    removeFromIndex(entry);
+                }
+                expired.push_back(entry);
+                --_count;
+                entry = next;
+            }
+            ++_current;
+        }
+
+        if(_count == 0 && _current <= last)
+        {
+            _current = last + 1;
+        }
+    }
+
+    //
+    // Reschedule the expired repeated tasks which weren't canceled while
+    // running and release the other entries.
+    //
+    void
+    reschedule(vector<Entry*>& expired)
+    {
+        IceUtil::Time now;
+        for(vector<Entry*>::const_iterator p = expired.begin(); p != expired.end(); ++p)
+        {
+            Entry* entry = *p;
+            if(entry->delay != IceUtil::Time() && find(entry->task) == entry)
+            {
+                if(now == IceUtil::Time())
+                {
+                    now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+                }
+                entry->expiration = max(toTick(now + entry->delay), _current);
+                insert(entry);
+            }
+            else
+            {
+                release(entry);
+            }
+        }
+        expired.clear();
+    }
+
+    //
+    // Returns the time of the next tick to process. It's the next
+    // expiration time or the time of the next cascade of the higher
+    // levels which might bring entries to the first level.
+    //
+    IceUtil::Time
+    next() const
+    {
+        IceUtil::Int64 tick = _current;
+        for(; tick < _current + wheelSize; ++tick)
+        {
+            if(((tick & wheelMask) == 0 && cascades(tick)) || _slots[tick & wheelMask])
+            {
+                return toTime(tick);
+            }
+        }
+        for(int i = 0; i < wheelSize && !cascades(tick); ++i)
+        {
+            tick = (tick | wheelMask) + 1;
+        }
+        return toTime(tick);
+    }
+
+    void
+    clear()
+    {
+        for(int i = 0; i < wheelSize * wheelLevels; ++i)
+        {
+            Entry* entry = _slots[i];
+            _slots[i] = 0;
+            while(entry)
+            {
+                Entry* next = entry->next;
+                release(entry);
+                entry = next;
+            }
+        }
+        fill(_buckets.begin(), _buckets.end(), static_cast<Entry*>(0));
+        _count = 0;
+        _size = 0;
+    }
+
+private:
+
+    IceUtil::Int64
+    toTick(const IceUtil::Time& time) const
+    {
+        //
+        // Round up to not run tasks before their scheduled time.
+        //
+        IceUtil::Int64 t = (time - _start).toMicroSeconds();
+        return t <= 0 ? 0 : (t + _tick - 1) / _tick;
+    }
+
+    IceUtil::Time
+    toTime(IceUtil::Int64 tick) const
+    {
+        return _start + IceUtil::Time::microSeconds(tick * _tick);
+    }
+
+    void
+    insert(Entry* entry)
+    {
+        IceUtil::Int64 expiration = entry->expiration;
+        IceUtil::Int64 delta = expiration - _current;
+        int slot;
+        if(delta < 0)
+        {
+            slot = static_cast<int>(_current & wheelMask);
+        }
+        else if(delta < wheelSize)
+        {
+            slot = static_cast<int>(expiration & wheelMask);
+        }
+        else
+        {
+            if(delta >= wheelRange)
+            {
+                expiration = _current + wheelRange - 1;
+                delta = wheelRange - 1;
+            }
+            int level = 1;
+            while(delta >= (ICE_INT64(1) << (wheelBits * (level + 1))))
+            {
+                ++level;
+            }
+            slot = level * wheelSize + static_cast<int>((expiration >> (wheelBits * level)) & wheelMask);
+        }
+
+        entry->slot = slot;
+        entry->prev = 0;
+        entry->next = _slots[slot];
+        if(entry->next)
+        {
+            entry->next->prev = entry;
+        }
+        _slots[slot] = entry;
+        ++_count;
+    }
+
+    void
+    unlink(Entry* entry)
+    {
+        if(entry->prev)
+        {
+            entry->prev->next = entry->next;
+        }
+        else
+        {
+            _slots[entry->slot] = entry->next;
+        }
+        if(entry->next)
+        {
+            entry->next->prev = entry->prev;
+        }
+        entry->slot = -1;
+        --_count;
+    }
+
+    void
+    cascade(int slot)
+    {
+        Entry* entry = _slots[slot];
+        _slots[slot] = 0;
+        while(entry)
+        {
+            Entry* next = entry->next;
+            --_count;
+            insert(entry);
+            entry = next;
+        }
+    }
+
+    //
+    // Returns true if processing the given tick cascades entries from the
+    // higher levels.
+    //
+    bool
+    cascades(IceUtil::Int64 tick) const
+    {
+        for(int level = 1; level < wheelLevels; ++level)
+        {
+            const int i = static_cast<int>((tick >> (wheelBits * level)) & wheelMask);
+            if(_slots[level * wheelSize + i])
+            {
+                return true;
+            }
+            if(i != 0)
+            {
+                break;
+            }
+        }
+        return false;
+    }
+
+    void
+    release(Entry* entry)
+    {
+        entry->task = ICE_NULLPTR;
+        if(_free.size() < maxFreeEntries)
+        {
+            _free.push_back(entry);
+        }
+        else
+        {
+            delete entry;
+        }
+    }
+
+    size_t
+    hash(const TimerTaskPtr& task) const
+    {
+        size_t h = reinterpret_cast<size_t>(task.get()) >> 4;
+        return (h ^ (h >> 12)) & (_buckets.size() - 1);
+    }
+
+    Entry*
+    find(const TimerTaskPtr& task) const
+    {
+        for(Entry* entry = _buckets[hash(task)]; entry; entry = entry->hashNext)
+        {
+            if(entry->task.get() == task.get())
+            {
+                return entry;
+            }
+        }
+        return 0;
+    }
+
+    void
+    addToIndex(Entry* entry)
+    {
+        if(_size >= _buckets.size())
+        {
+            vector<Entry*> buckets(_buckets.size() * 2);
+            _buckets.swap(buckets);
+            for(vector<Entry*>::const_iterator p = buckets.begin(); p != buckets.end(); ++p)
+            {
+                Entry* e = *p;
+                while(e)
+                {
+                    Entry* next = e->hashNext;
+                    size_t h = hash(e->task);
+                    e->hashNext = _buckets[h];
+                    _buckets[h] = e;
+                    e = next;
+                }
+            }
+        }
+
+        size_t h = hash(entry->task);
+        entry->hashNext = _buckets[h];
+        _buckets[h] = entry;
+        ++_size;
+    }
+
+    void
+    removeFromIndex(Entry* entry)
+    {
+        Entry** p = &_buckets[hash(entry->task)];
+        while(*p != entry)
+        {
+            p = &(*p)->hashNext;
+        }
+        *p = entry->hashNext;
+        --_size;
+    }
+
+    const IceUtil::Time _start;
+    const IceUtil::Int64 _tick; // The tick in micro-seconds.
+    IceUtil::Int64 _current; // The next tick to process.
+    size_t _count; // The number of entries in the wheel.
+    size_t _size; // The number of entries in the index.
+    Entry* _slots[wheelSize * wheelLevels];
+    vector<Entry*> _buckets;
+    vector<Entry*> _free;
+};
+
 TimerTask::~TimerTask()
 {
     // Out of line to avoid weak vtable
@@ -22,7 +466,8 @@ TimerTask::~TimerTask()
 
 Timer::Timer() :
     Thread("IceUtil timer thread"),
-    _destroyed(false)
+    _destroyed(false),
+    _wheel(0)
 {
     __setNoDelete(true);
     start();
@@ -31,13 +476,39 @@ Timer::Timer() :
 
 Timer::Timer(int priority) :
     Thread("IceUtil timer thread"),
-    _destroyed(false)
+    _destroyed(false),
+    _wheel(0)
 {
     __setNoDelete(true);
     start(0, priority);
     __setNoDelete(false);
 }
 
+Timer::Timer(const IceUtil::Time& tick) :
+    Thread("IceUtil timer thread"),
+    _destroyed(false),
+    _wheel(new TimingWheel(tick))
+{
+    __setNoDelete(true);
+    start();
+    __setNoDelete(false);
+}
+
+Timer::Timer(const IceUtil::Time& tick, int priority) :
+    Thread("IceUtil timer thread"),
+    _destroyed(false),
+    _wheel(new TimingWheel(tick))
+{
+    __setNoDelete(true);
+    start(0, priority);
+    __setNoDelete(false);
+}
+
+Timer::~Timer()
+{
+    delete _wheel;
+}
+
 void
 Timer::destroy()
 {
@@ -51,6 +522,10 @@ Timer::destroy()
         _monitor.notify();
         _tasks.clear();
         _tokens.clear();
+        if(_wheel)
+        {
+            _wheel->clear();
+        }
     }
 
     if(getThreadControl() == ThreadControl())
@@ -79,12 +554,19 @@ Timer::schedule(const TimerTaskPtr& task, const IceUtil::Time& delay)
         throw IllegalArgumentException(__FILE__, __LINE__, "invalid delay");
     }
 
-    bool inserted = _tasks.insert(make_pair(task, time)).second;
-    if(!inserted)
+    if(_wheel)
     {
-        throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        time = _wheel->schedule(task, time, IceUtil::Time());
+    }
+    else
+    {
+        bool inserted = _tasks.insert(make_pair(task, time)).second;
+        if(!inserted)
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        }
+        _tokens.insert(Token(time, IceUtil::Time(), task));
     }
-    _tokens.insert(Token(time, IceUtil::Time(), task));
 
     if(_wakeUpTime == IceUtil::Time() || time < _wakeUpTime)
     {
@@ -102,20 +584,27 @@ Timer::scheduleRepeated(const TimerTaskPtr& task, const IceUtil::Time& delay)
     }
 
     IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
-    const Token token(now + delay, delay, task);
-    if(delay > IceUtil::Time() && token.scheduledTime < now) 
+    IceUtil::Time time = now + delay;
+    if(delay > IceUtil::Time() && time < now) 
     {
         throw IllegalArgumentException(__FILE__, __LINE__, "invalid delay");
     }
 
-    bool inserted = _tasks.insert(make_pair(task, token.scheduledTime)).second;
-    if(!inserted)
+    if(_wheel)
     {
-        throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        time = _wheel->schedule(task, time, delay);
+    }
+    else
+    {
+        bool inserted = _tasks.insert(make_pair(task, time)).second;
+        if(!inserted)
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "task is already schedulded");
+        }
+        _tokens.insert(Token(time, delay, task));
     }
-    _tokens.insert(token); 
    
-    if(_wakeUpTime == IceUtil::Time() || token.scheduledTime < _wakeUpTime)
+    if(_wakeUpTime == IceUtil::Time() || time < _wakeUpTime)
     {
         _monitor.notify();
     }
@@ -130,6 +619,11 @@ Timer::cancel(const TimerTaskPtr& task)
         return false;
     }
 
+    if(_wheel)
+    {
+        return _wheel->cancel(task);
+    }
+
     map<TimerTaskPtr, IceUtil::Time, TimerTaskCompare>::iterator p = _tasks.find(task);
     if(p == _tasks.end())
     {
@@ -145,6 +639,12 @@ Timer::cancel(const TimerTaskPtr& task)
 void
 Timer::run()
 {
+    if(_wheel)
+    {
+        runWheel();
+        return;
+    }
+
     Token token(IceUtil::Time(), IceUtil::Time(), 0);
     while(true)
     {
@@ -227,27 +727,85 @@ Timer::run()
 
         if(token.task)
         {
-            try
+            runTask(token.task);
+        }
+    }
+}
+
+void
+Timer::runWheel()
+{
+    vector<TimingWheel::Entry*> expired;
+    while(true)
+    {
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+
+            //
+            // Reschedule the repeated tasks we just ran if they weren't
+            // canceled.
+            //
+            _wheel->reschedule(expired);
+
+            while(!_destroyed)
             {
-                runTimerTask(token.task);
+                const IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+                _wheel->expire(now, expired);
+                if(!expired.empty())
+                {
+                    break;
+                }
+
+                if(_wheel->empty())
+                {
+                    _wakeUpTime = IceUtil::Time();
+                    _monitor.wait();
+                }
+                else
+                {
+                    _wakeUpTime = _wheel->next();
+                    if(_wakeUpTime > now)
+                    {
+                        _monitor.timedWait(_wakeUpTime - now);
+                    }
+                }
             }
-            catch(const IceUtil::Exception& e)
-            {
-                consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what();
-#ifdef __GNUC__
-                consoleErr << "\n" << e.ice_stackTrace();
-#endif
-                consoleErr << endl;
-            } 
-            catch(const std::exception& e)
-            {
-                consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what() << endl;
-            } 
-            catch(...)
+
+            if(_destroyed)
             {
-                consoleErr << "IceUtil::Timer::run(): uncaught exception" << endl;
+                break;
             }
         }
+
+        for(vector<TimingWheel::Entry*>::const_iterator p = expired.begin(); p != expired.end(); ++p)
+        {
+            runTask((*p)->task);
+        }
+    }
+}
+
+void
+Timer::runTask(const TimerTaskPtr& task)
+{
+    try
+    {
+        runTimerTask(task);
+    }
+    catch(const IceUtil::Exception& e)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what();
+#ifdef __GNUC__
+        consoleErr << "\n" << e.ice_stackTrace();
+#endif
+        consoleErr << endl;
+    } 
+    catch(const std::exception& e)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what() << endl;
+    } 
+    catch(...)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception" << endl;
     }
 }
 
@@ -20,6 +20,7 @@
 #include <Ice/InputStream.h>
 #include <Ice/Protocol.h>
 #include <Ice/ReplyStatus.h>
+#include <Ice/Compressor.h>
 #include <set>
 
 using namespace std;
@@ -159,7 +160,7 @@ printHeader(ostream& s, InputStream& stream)
     stream.read(compress);
     s << "\ncompression status = "  << static_cast<int>(compress) << ' ';
 
-    switch(compress)
+    switch(compress & 0x0f)
     {
         case 0:
         {
@@ -186,6 +187,25 @@ printHeader(ostream& s, InputStream& stream)
         }
     }
 
+    if(compress >> 4)
+    {
+        if(type == validateConnectionMsg)
+        {
+            s << "\ncompression codecs = " << codecName(CompressionCodecBZip2);
+            for(Byte codec = 1; codec <= 4; ++codec)
+            {
+                if((compress >> 4) & (1 << (codec - 1)))
+                {
+                    s << ", " << codecName(codec);
+                }
+            }
+        }
+        else
+        {
+            s << "\ncompression codec = " << codecName(static_cast<Byte>(compress >> 4));
+        }
+    }
+
     Int size;
     stream.read(size);
     s << "\nmessage size = " << size;
@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Transceiver.h>
+#include <Ice/Buffer.h>
 
 using namespace std;
 using namespace Ice;
@@ -22,3 +23,28 @@ IceInternal::Transceiver::bind()
     return 0;
 }
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+//
+// Write the given buffers in order. Transceivers which don't support
+// gathered writes write the buffers one after the other and stop on
+// the first buffer which can't be written completely. Datagram
+// transceivers send each buffer as a separate datagram.
+//
+SocketOperation
+IceInternal::Transceiver::writeBuffers(vector<Buffer*>& buffers)
+{
+    for(vector<Buffer*>::iterator p = buffers.begin(); p != buffers.end(); ++p)
+    {
+        if((*p)->i != (*p)->b.end())
+        {
+            SocketOperation op = write(**p);
+            if(op != SocketOperationNone)
+            {
+                return op;
+            }
+        }
+    }
+    return SocketOperationNone;
+}
+#endif
+
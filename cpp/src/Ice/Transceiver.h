@@ -16,6 +16,8 @@
 #include <Ice/EndpointIF.h>
 #include <Ice/Network.h>
 
+#include <vector>
+
 namespace IceInternal
 {
 
@@ -34,6 +36,9 @@ public:
     virtual EndpointIPtr bind();
     virtual SocketOperation write(Buffer&) = 0;
     virtual SocketOperation read(Buffer&) = 0;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    virtual SocketOperation writeBuffers(std::vector<Buffer*>&);
+#endif
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&) = 0;
     virtual void finishWrite(Buffer&) = 0;
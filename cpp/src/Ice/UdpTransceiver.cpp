@@ -34,6 +34,24 @@ using namespace Windows::Networking::Sockets;
 
 IceUtil::Shared* IceInternal::upCast(UdpTransceiver* p) { return p; }
 
+#ifdef ICE_USE_MMSG
+namespace
+{
+
+size_t
+getRcvBatchSize(const ProtocolInstancePtr& instance)
+{
+    //
+    // The batch size is bounded by the maximum number of messages
+    // accepted by recvmmsg (UIO_MAXIOV).
+    //
+    Int size = instance->properties()->getPropertyAsIntWithDefault("Ice.UDP.RcvBatchSize", 1);
+    return static_cast<size_t>(max(1, min(size, 1024)));
+}
+
+}
+#endif
+
 NativeInfoPtr
 IceInternal::UdpTransceiver::getNativeInfo()
 {
@@ -268,6 +286,45 @@ IceInternal::UdpTransceiver::read(Buffer& buf)
     assert(_fd != INVALID_SOCKET);
 
     const int packetSize = min(_maxPacketSize, _rcvSize - _udpOverhead);
+
+#ifdef ICE_USE_MMSG
+    //
+    // Receive a batch of datagrams with recvmmsg and return them one
+    // at a time. The transceiver is marked as ready for reading while
+    // datagrams are left in the batch since the socket might not have
+    // any more data to read. Unconnected incoming transceivers which
+    // must connect to the first peer receive a single datagram.
+    //
+    if(_rcvBatchSize > 1 && _state != StateNeedConnect)
+    {
+        if(_rcvBatchPos == _rcvBatchCount)
+        {
+            SocketOperation op = readBatch(packetSize);
+            if(op != SocketOperationNone)
+            {
+                return op;
+            }
+        }
+
+        if(_state == StateNotConnected)
+        {
+            _peerAddr = _rcvAddrs[_rcvBatchPos];
+        }
+
+        size_t size = _rcvMsgs[_rcvBatchPos].msg_len;
+        buf.b.resize(size);
+        if(size > 0)
+        {
+            memcpy(&buf.b[0], &_rcvBatch[_rcvBatchPos * static_cast<size_t>(_rcvBatchPacketSize)], size);
+        }
+        buf.i = buf.b.end();
+        ++_rcvBatchPos;
+
+        ready(SocketOperationRead, _rcvBatchPos < _rcvBatchCount);
+        return SocketOperationNone;
+    }
+#endif
+
     buf.b.resize(packetSize);
     buf.i = buf.b.begin();
 
@@ -359,6 +416,155 @@ repeat:
 #endif
 }
 
+#ifdef ICE_USE_MMSG
+SocketOperation
+IceInternal::UdpTransceiver::writeBuffers(vector<Buffer*>& buffers)
+{
+    //
+    // Each buffer is sent as a separate datagram, the datagrams are
+    // sent with a single sendmmsg call. Unconnected transceivers send
+    // to the last peer, this is rare so they send one datagram at a
+    // time.
+    //
+    if(_state != StateConnected)
+    {
+        return Transceiver::writeBuffers(buffers);
+    }
+
+    assert(_fd != INVALID_SOCKET);
+
+    _sndMsgs.resize(buffers.size());
+    _sndIovs.resize(buffers.size());
+    size_t count = 0;
+    for(vector<Buffer*>::const_iterator p = buffers.begin(); p != buffers.end(); ++p)
+    {
+        if((*p)->i == (*p)->b.end())
+        {
+            continue;
+        }
+        assert((*p)->i == (*p)->b.begin());
+
+        // The caller is supposed to check the send size before by calling checkSendSize
+        assert(min(_maxPacketSize, _sndSize - _udpOverhead) >= static_cast<int>((*p)->b.size()));
+
+        _sndIovs[count].iov_base = (*p)->i;
+        _sndIovs[count].iov_len = (*p)->b.size();
+        memset(&_sndMsgs[count], 0, sizeof(mmsghdr));
+        _sndMsgs[count].msg_hdr.msg_iov = &_sndIovs[count];
+        _sndMsgs[count].msg_hdr.msg_iovlen = 1;
+        ++count;
+    }
+
+    size_t sent = 0;
+    while(sent < count)
+    {
+        int ret = ::sendmmsg(_fd, &_sndMsgs[sent], static_cast<unsigned int>(count - sent), 0);
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(wouldBlock())
+            {
+                break;
+            }
+
+            SocketException ex(__FILE__, __LINE__);
+            ex.error = getSocketErrno();
+            throw ex;
+        }
+        sent += static_cast<size_t>(ret);
+    }
+
+    for(vector<Buffer*>::const_iterator p = buffers.begin(); p != buffers.end() && sent > 0; ++p)
+    {
+        if((*p)->i != (*p)->b.end())
+        {
+            (*p)->i = (*p)->b.end();
+            --sent;
+        }
+    }
+
+    for(vector<Buffer*>::const_iterator p = buffers.begin(); p != buffers.end(); ++p)
+    {
+        if((*p)->i != (*p)->b.end())
+        {
+            return SocketOperationWrite;
+        }
+    }
+    return SocketOperationNone;
+}
+
+SocketOperation
+IceInternal::UdpTransceiver::readBatch(int packetSize)
+{
+    assert(_rcvBatchPos == _rcvBatchCount);
+
+    _rcvBatchPos = _rcvBatchCount = 0;
+    _rcvBatchPacketSize = packetSize;
+    _rcvBatch.resize(_rcvBatchSize * static_cast<size_t>(packetSize));
+    _rcvMsgs.resize(_rcvBatchSize);
+    _rcvIovs.resize(_rcvBatchSize);
+    _rcvAddrs.resize(_rcvBatchSize);
+    for(size_t i = 0; i < _rcvBatchSize; ++i)
+    {
+        _rcvIovs[i].iov_base = &_rcvBatch[i * static_cast<size_t>(packetSize)];
+        _rcvIovs[i].iov_len = static_cast<size_t>(packetSize);
+        memset(&_rcvMsgs[i], 0, sizeof(mmsghdr));
+        _rcvMsgs[i].msg_hdr.msg_iov = &_rcvIovs[i];
+        _rcvMsgs[i].msg_hdr.msg_iovlen = 1;
+        if(_state == StateNotConnected)
+        {
+            _rcvMsgs[i].msg_hdr.msg_name = &_rcvAddrs[i].saStorage;
+            _rcvMsgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(sizeof(sockaddr_storage));
+        }
+    }
+
+    //
+    // A datagram larger than the packet size is truncated, this is
+    // detected at the connection level when the Ice message size is
+    // checked against the datagram size.
+    //
+    int ret;
+    while(true)
+    {
+        ret = ::recvmmsg(_fd, &_rcvMsgs[0], static_cast<unsigned int>(_rcvBatchSize), 0, 0);
+        if(ret != SOCKET_ERROR)
+        {
+            break;
+        }
+
+        if(interrupted())
+        {
+            continue;
+        }
+
+        if(wouldBlock())
+        {
+            return SocketOperationRead;
+        }
+
+        if(connectionLost())
+        {
+            ConnectionLostException ex(__FILE__, __LINE__);
+            ex.error = getSocketErrno();
+            throw ex;
+        }
+        else
+        {
+            SocketException ex(__FILE__, __LINE__);
+            ex.error = getSocketErrno();
+            throw ex;
+        }
+    }
+
+    _rcvBatchCount = static_cast<size_t>(ret);
+    return SocketOperationNone;
+}
+#endif
+
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
 bool
 IceInternal::UdpTransceiver::startWrite(Buffer& buf)
@@ -920,6 +1126,12 @@ IceInternal::UdpTransceiver::UdpTransceiver(const ProtocolInstancePtr& instance,
     _bound(false),
     _addr(addr),
     _state(StateNeedConnect)
+#ifdef ICE_USE_MMSG
+    , _rcvBatchSize(getRcvBatchSize(instance)),
+    _rcvBatchPacketSize(0),
+    _rcvBatchPos(0),
+    _rcvBatchCount(0)
+#endif
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead),
     _write(SocketOperationWrite)
@@ -1002,6 +1214,12 @@ IceInternal::UdpTransceiver::UdpTransceiver(const UdpEndpointIPtr& endpoint, con
     _mcastInterface(mcastInterface),
     _port(port),
     _state(connect ? StateNeedConnect : StateNotConnected)
+#ifdef ICE_USE_MMSG
+    , _rcvBatchSize(getRcvBatchSize(instance)),
+    _rcvBatchPacketSize(0),
+    _rcvBatchPos(0),
+    _rcvBatchCount(0)
+#endif
 #ifdef ICE_OS_UWP
     , _readPending(false)
 #elif defined(ICE_USE_IOCP)
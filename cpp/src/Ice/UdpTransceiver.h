@@ -48,6 +48,9 @@ public:
     virtual EndpointIPtr bind();
     virtual SocketOperation write(Buffer&);
     virtual SocketOperation read(Buffer&);
+#ifdef ICE_USE_MMSG
+    virtual SocketOperation writeBuffers(std::vector<Buffer*>&);
+#endif
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&);
     virtual void finishWrite(Buffer&);
@@ -72,6 +75,9 @@ private:
     virtual ~UdpTransceiver();
 
     void setBufSize(int, int);
+#ifdef ICE_USE_MMSG
+    SocketOperation readBatch(int);
+#endif
 
 #ifdef ICE_OS_UWP
     void appendMessage(Windows::Networking::Sockets::DatagramSocketMessageReceivedEventArgs^);
@@ -104,6 +110,24 @@ private:
     static const int _udpOverhead;
     static const int _maxPacketSize;
 
+#ifdef ICE_USE_MMSG
+    //
+    // The datagrams received with recvmmsg which aren't read yet, the
+    // number of datagrams received at once is set with Ice.UDP.RcvBatchSize.
+    //
+    const size_t _rcvBatchSize;
+    std::vector<Ice::Byte> _rcvBatch;
+    std::vector<mmsghdr> _rcvMsgs;
+    std::vector<iovec> _rcvIovs;
+    std::vector<Address> _rcvAddrs;
+    int _rcvBatchPacketSize;
+    size_t _rcvBatchPos;
+    size_t _rcvBatchCount;
+
+    std::vector<mmsghdr> _sndMsgs;
+    std::vector<iovec> _sndIovs;
+#endif
+
 #if defined(ICE_USE_IOCP)
     AsyncInfo _read;
     AsyncInfo _write;
@@ -30,6 +30,20 @@ typedef unsigned short uint16_t;
 
 #include <climits>
 
+//
+// The masking of the frame payloads uses SSE2 when it's available, and
+// AVX2 if the CPU supports it with GCC and clang on x86.
+//
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define ICE_WS_SSE2
+#   include <emmintrin.h>
+#   if (defined(__x86_64__) || defined(__i386__)) && \
+       (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#       define ICE_WS_AVX2
+#       include <immintrin.h>
+#   endif
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -67,6 +81,11 @@ namespace
 const string _iceProtocol = "ice.zeroc.com";
 const string _wsUUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
 
+//
+// The maximum size of the frames gathered by writeBuffers().
+//
+const size_t maxGatherSize = 16 * 1024;
+
 //
 // Rename to avoid conflict with OS 10.10 htonll
 //
@@ -176,6 +195,100 @@ Short ntohs(Short value)
 }
 #endif
 
+//
+// The helpers below mask the given number of bytes from src into dest
+// with a 32-bit key stored in memory order (dest and src can be the
+// same). They return the number of bytes masked, which is a multiple of
+// 4 so that the key stays aligned with the remaining data.
+//
+#ifdef ICE_WS_AVX2
+__attribute__((target("avx2"))) size_t
+maskAVX2(Byte* dest, const Byte* src, size_t n, Int key)
+{
+    const __m256i k = _mm256_set1_epi32(key);
+    size_t i = 0;
+    for(; i + 32 <= n; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_xor_si256(v, k));
+    }
+    return i;
+}
+
+bool
+hasAVX2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+}
+
+const bool avx2 = hasAVX2();
+#endif
+
+#ifdef ICE_WS_SSE2
+size_t
+maskSSE2(Byte* dest, const Byte* src, size_t n, Int key)
+{
+    const __m128i k = _mm_set1_epi32(key);
+    size_t i = 0;
+    for(; i + 16 <= n; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_xor_si128(v, k));
+    }
+    return i;
+}
+#endif
+
+size_t
+maskWords(Byte* dest, const Byte* src, size_t n, Int key)
+{
+    Long k;
+    memcpy(&k, &key, sizeof(key));
+    memcpy(reinterpret_cast<Byte*>(&k) + sizeof(key), &key, sizeof(key));
+    size_t i = 0;
+    for(; i + sizeof(Long) <= n; i += sizeof(Long))
+    {
+        Long v;
+        memcpy(&v, src + i, sizeof(Long));
+        v ^= k;
+        memcpy(dest + i, &v, sizeof(Long));
+    }
+    return i;
+}
+
+//
+// Apply the frame mask to n bytes of payload starting at the given
+// offset in the frame payload.
+//
+void
+applyMask(Byte* dest, const Byte* src, size_t n, const unsigned char* mask, size_t offset)
+{
+    Byte key[4];
+    for(size_t i = 0; i < 4; ++i)
+    {
+        key[i] = mask[(offset + i) % 4];
+    }
+    Int k;
+    memcpy(&k, key, sizeof(k));
+
+    size_t i = 0;
+#ifdef ICE_WS_AVX2
+    if(avx2)
+    {
+        i += maskAVX2(dest, src, n, k);
+    }
+#endif
+#ifdef ICE_WS_SSE2
+    i += maskSSE2(dest + i, src + i, n - i, k);
+#endif
+    i += maskWords(dest + i, src + i, n - i, k);
+    for(; i < n; ++i)
+    {
+        dest[i] = src[i] ^ key[i % 4];
+    }
+}
+
 }
 
 NativeInfoPtr
@@ -516,7 +629,24 @@ IceInternal::WSTransceiver::write(Buffer& buf)
         {
             if(_writeBuffer.i < _writeBuffer.b.end())
             {
-                SocketOperation s = _delegate->write(_writeBuffer);
+                SocketOperation s;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+                if(_incoming && _writeState == WriteStatePayload)
+                {
+                    //
+                    // Send the frame header and the message with a single
+                    // gathered write.
+                    //
+                    _writeBuffers.clear();
+                    _writeBuffers.push_back(&_writeBuffer);
+                    _writeBuffers.push_back(&buf);
+                    s = _delegate->writeBuffers(_writeBuffers);
+                }
+                else
+#endif
+                {
+                    s = _delegate->write(_writeBuffer);
+                }
                 if(s)
                 {
                     return s;
@@ -541,6 +671,100 @@ IceInternal::WSTransceiver::write(Buffer& buf)
     return SocketOperationNone;
 }
 
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+SocketOperation
+IceInternal::WSTransceiver::writeBuffers(vector<Buffer*>& buffers)
+{
+    //
+    // The messages which fit in the gather buffer with their frame
+    // header are framed in the gather buffer and sent with a single
+    // write of the delegate. The messages are only marked as written
+    // once the gather buffer is written: if the write would block, the
+    // caller retries with the same messages, more messages might follow
+    // them. Control frames and messages which are partially written are
+    // sent with write().
+    //
+    size_t start = 0;
+    while(true)
+    {
+        while(start < buffers.size() && buffers[start]->i == buffers[start]->b.end())
+        {
+            ++start;
+        }
+        if(start == buffers.size())
+        {
+            return SocketOperationNone;
+        }
+
+        if(_gathered == 0)
+        {
+            size_t size = 0;
+            size_t n = start;
+            if(_state == StateOpened && _writeState == WriteStateHeader && !_writePending)
+            {
+                while(n < buffers.size() && buffers[n]->i == buffers[n]->b.begin())
+                {
+                    size_t sz = buffers[n]->b.size();
+                    size_t headerSize = 2 + (sz <= 125 ? 0 : (sz <= USHRT_MAX ? 2 : 8)) + (_incoming ? 0 : 4);
+                    if(size + headerSize + sz > maxGatherSize)
+                    {
+                        break;
+                    }
+                    size += headerSize + sz;
+                    ++n;
+                }
+            }
+
+            if(n - start < 2)
+            {
+                SocketOperation op = write(*buffers[start]);
+                if(op)
+                {
+                    return op;
+                }
+                continue;
+            }
+
+            _gatherBuffer.b.resize(size);
+            _gatherBuffer.i = _gatherBuffer.b.begin();
+            for(size_t i = start; i < n; ++i)
+            {
+                Buffer& buf = *buffers[i];
+                prepareWriteHeader(OP_DATA, buf.b.size());
+                size_t headerSize = static_cast<size_t>(_writeBuffer.i - _writeBuffer.b.begin());
+                memcpy(_gatherBuffer.i, _writeBuffer.b.begin(), headerSize);
+                _gatherBuffer.i += headerSize;
+                if(_incoming)
+                {
+                    memcpy(_gatherBuffer.i, buf.b.begin(), buf.b.size());
+                }
+                else
+                {
+                    applyMask(_gatherBuffer.i, buf.b.begin(), buf.b.size(), _writeMask, 0);
+                }
+                _gatherBuffer.i += buf.b.size();
+            }
+            assert(_gatherBuffer.i == _gatherBuffer.b.end());
+            _gatherBuffer.i = _gatherBuffer.b.begin();
+            _writeBuffer.i = _writeBuffer.b.end();
+            _gathered = n - start;
+        }
+
+        assert(buffers.size() >= start + _gathered);
+        SocketOperation op = _delegate->write(_gatherBuffer);
+        if(op)
+        {
+            return op;
+        }
+        for(size_t i = start; i < start + _gathered; ++i)
+        {
+            buffers[i]->i = buffers[i]->b.end();
+        }
+        _gathered = 0;
+    }
+}
+#endif
+
 SocketOperation
 IceInternal::WSTransceiver::read(Buffer& buf)
 {
@@ -864,8 +1088,12 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readOpCode(0),
     _readHeaderLength(0),
     _readPayloadLength(0),
+    _readFrameOffset(0),
     _writeState(WriteStateHeader),
     _writeBufferSize(16 * 1024),
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _gathered(0),
+#endif
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
@@ -892,8 +1120,12 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readOpCode(0),
     _readHeaderLength(0),
     _readPayloadLength(0),
+    _readFrameOffset(0),
     _writeState(WriteStateHeader),
     _writeBufferSize(1024),
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    _gathered(0),
+#endif
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
@@ -1280,7 +1512,7 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                 }
                 _readState = ReadStatePayload;
                 assert(buf.i != buf.b.end());
-                _readFrameStart = buf.i;
+                _readFrameOffset = 0;
                 break;
             }
             case OP_CLOSE: // Connection close
@@ -1436,13 +1668,12 @@ IceInternal::WSTransceiver::postRead(Buffer& buf)
     if(_incoming)
     {
         //
-        // Unmask the data we just read.
+        // Unmask the data we just read. The mask offset is tracked
+        // separately from the buffer as the payload of a frame isn't
+        // necessarily read in a single buffer.
         //
-        IceInternal::Buffer::Container::iterator p = _readStart;
-        for(size_t n = _readStart - _readFrameStart; p < buf.i; ++p, ++n)
-        {
-            *p ^= _readMask[n % 4];
-        }
+        applyMask(_readStart, _readStart, buf.i - _readStart, _readMask, _readFrameOffset);
+        _readFrameOffset += buf.i - _readStart;
     }
 
     _readPayloadLength -= buf.i - _readStart;
@@ -1471,6 +1702,17 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
 
             assert(buf.i = buf.b.begin());
             prepareWriteHeader(OP_DATA, buf.b.size());
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+            if(_incoming)
+            {
+                //
+                // The message isn't copied for incoming connections, the
+                // header is sent with the message, see write().
+                //
+                _writeBuffer.b.resize(_writeBuffer.i - _writeBuffer.b.begin());
+                _writeBuffer.i = _writeBuffer.b.begin();
+            }
+#endif
 
             _writeState = WriteStatePayload;
         }
@@ -1534,10 +1776,11 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
         //
         // For an outgoing connection, each message must be masked with a random
         // 32-bit value, so we copy the entire message into the internal buffer
-        // for writing. For incoming connections, we just copy the start of the
-        // message in the internal buffer after the hedaer. If the message is
-        // larger, the reminder is sent directly from the message buffer to avoid
-        // copying.
+        // for writing. For incoming connections, the message is sent directly
+        // from the message buffer with a gathered write after the header. With
+        // IOCP and UWP, we just copy the start of the message in the internal
+        // buffer after the header and the reminder is sent directly from the
+        // message buffer to avoid copying.
         //
 
         if(!_incoming && (_writePayloadLength == 0 || _writeBuffer.i == _writeBuffer.b.end()))
@@ -1548,17 +1791,17 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
             }
 
             size_t n = buf.i - buf.b.begin();
-            for(; n < buf.b.size() && _writeBuffer.i < _writeBuffer.b.end(); ++_writeBuffer.i, ++n)
-            {
-                *_writeBuffer.i = buf.b[n] ^ _writeMask[n % 4];
-            }
-            _writePayloadLength = n;
+            size_t sz = min(buf.b.size() - n, static_cast<size_t>(_writeBuffer.b.end() - _writeBuffer.i));
+            applyMask(_writeBuffer.i, buf.b.begin() + n, sz, _writeMask, n);
+            _writeBuffer.i += sz;
+            _writePayloadLength = n + sz;
             if(_writeBuffer.i < _writeBuffer.b.end())
             {
                 _writeBuffer.b.resize(_writeBuffer.i - _writeBuffer.b.begin());
             }
             _writeBuffer.i = _writeBuffer.b.begin();
         }
+#if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
         else if(_writePayloadLength == 0)
         {
             size_t n = min(_writeBuffer.b.end() - _writeBuffer.i, buf.b.end() - buf.i);
@@ -1572,6 +1815,7 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
             }
             _writeBuffer.i = _writeBuffer.b.begin();
         }
+#endif
         return true;
     }
     else
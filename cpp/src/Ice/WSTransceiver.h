@@ -37,6 +37,9 @@ public:
     virtual SocketOperation closing(bool, const Ice::LocalException&);
     virtual void close();
     virtual SocketOperation write(Buffer&);
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    virtual SocketOperation writeBuffers(std::vector<Buffer*>&);
+#endif
     virtual SocketOperation read(Buffer&);
 #if defined(ICE_USE_IOCP) || defined(ICE_OS_UWP)
     virtual bool startWrite(Buffer&);
@@ -116,7 +119,7 @@ private:
     size_t _readHeaderLength;
     size_t _readPayloadLength;
     Buffer::Container::iterator _readStart;
-    Buffer::Container::iterator _readFrameStart;
+    size_t _readFrameOffset;
     unsigned char _readMask[4];
 
     enum WriteState
@@ -131,6 +134,11 @@ private:
     const Buffer::Container::size_type _writeBufferSize;
     unsigned char _writeMask[4];
     size_t _writePayloadLength;
+#if !defined(ICE_USE_IOCP) && !defined(ICE_OS_UWP)
+    std::vector<Buffer*> _writeBuffers;
+    Buffer _gatherBuffer;
+    size_t _gathered;
+#endif
 
     bool _readPending;
     bool _writePending;
@@ -30,6 +30,11 @@
 #include <openssl/err.h>
 #include <openssl/ssl.h>
 #include <openssl/pkcs12.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#  include <openssl/core_names.h>
+#else
+#  include <openssl/hmac.h>
+#endif
 
 using namespace std;
 using namespace Ice;
@@ -123,6 +128,55 @@ IceSSL_opensslPasswordCallback(char* buf, int size, int flag, void* userData)
     return sz;
 }
 
+int
+IceSSL_opensslNewSessionCallback(SSL* ssl, SSL_SESSION* session)
+{
+    OpenSSL::TransceiverI* p = reinterpret_cast<OpenSSL::TransceiverI*>(SSL_get_ex_data(ssl, 0));
+    return p && p->newSession(session) ? 1 : 0;
+}
+
+//
+// OpenSSL 3.0 deprecates the HMAC_CTX ticket key callback.
+//
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+int
+IceSSL_opensslTicketKeyCallback(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* ctx,
+                                EVP_MAC_CTX* hctx, int enc)
+{
+    OpenSSL::SSLEngine* p = reinterpret_cast<OpenSSL::SSLEngine*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), 0));
+    unsigned char hmacKey[32];
+    int ret = p->ticketKey(name, iv, ctx, hmacKey, enc);
+    if(ret > 0)
+    {
+        OSSL_PARAM params[3];
+        params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, hmacKey, sizeof(hmacKey));
+        params[1] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>("SHA256"), 0);
+        params[2] = OSSL_PARAM_construct_end();
+        if(!EVP_MAC_CTX_set_params(hctx, params))
+        {
+            ret = -1;
+        }
+    }
+    OPENSSL_cleanse(hmacKey, sizeof(hmacKey));
+    return ret;
+}
+#else
+int
+IceSSL_opensslTicketKeyCallback(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* ctx,
+                                HMAC_CTX* hctx, int enc)
+{
+    OpenSSL::SSLEngine* p = reinterpret_cast<OpenSSL::SSLEngine*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), 0));
+    unsigned char hmacKey[32];
+    int ret = p->ticketKey(name, iv, ctx, hmacKey, enc);
+    if(ret > 0 && !HMAC_Init_ex(hctx, hmacKey, sizeof(hmacKey), EVP_sha256(), 0))
+    {
+        ret = -1;
+    }
+    OPENSSL_cleanse(hmacKey, sizeof(hmacKey));
+    return ret;
+}
+#endif
+
 #ifndef OPENSSL_NO_DH
 DH*
 IceSSL_opensslDHCallback(SSL* ssl, int /*isExport*/, int keyLength)
@@ -199,7 +253,8 @@ OpenSSL::upCast(OpenSSL::SSLEngine* p)
 
 OpenSSL::SSLEngine::SSLEngine(const CommunicatorPtr& communicator) :
     IceSSL::SSLEngine(communicator),
-    _ctx(0)
+    _ctx(0),
+    _sessionCacheSize(0)
 {
     __setNoDelete(true);
 
@@ -810,17 +865,81 @@ OpenSSL::SSLEngine::initialize()
         SSL_CTX_set_ex_data(_ctx, 0, this);
 
         //
+        // Session caching is disabled unless IceSSL.SessionCacheSize is set.
         // This is necessary for successful interop with Java. Without it, a Java
         // client would fail to reestablish a connection: the server gets the
         // error "session id context uninitialized" and the client receives
         // "SSLHandshakeException: Remote host closed connection during handshake".
         //
-        SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+        _sessionCacheSize = properties->getPropertyAsIntWithDefault(propPrefix + "SessionCacheSize", 0);
+        if(_sessionCacheSize > 0)
+        {
+            int timeout = properties->getPropertyAsIntWithDefault(propPrefix + "SessionCacheTimeout", 300);
+            if(timeout <= 0)
+            {
+                throw PluginInitializationException(__FILE__, __LINE__,
+                                                    "IceSSL: invalid value for " + propPrefix + "SessionCacheTimeout");
+            }
+
+            //
+            // Servers cache the sessions in the context cache. Clients cache the
+            // sessions by target endpoint with the new session callback, see
+            // TransceiverI::newSession.
+            //
+            SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_BOTH);
+            SSL_CTX_sess_set_cache_size(_ctx, _sessionCacheSize);
+            SSL_CTX_set_timeout(_ctx, timeout);
+            SSL_CTX_sess_set_new_cb(_ctx, IceSSL_opensslNewSessionCallback);
+
+            if(properties->getPropertyAsIntWithDefault(propPrefix + "SessionTickets", 1) > 0)
+            {
+                //
+                // Encrypt the session tickets with our own keys to rotate them,
+                // otherwise OpenSSL uses the same key for the life of the context.
+                //
+                int rotation = properties->getPropertyAsIntWithDefault(propPrefix + "SessionTicketKeyRotation", 3600);
+                if(rotation <= 0)
+                {
+                    throw PluginInitializationException(__FILE__, __LINE__, "IceSSL: invalid value for " +
+                                                        propPrefix + "SessionTicketKeyRotation");
+                }
+                _ticketKeyRotation = IceUtil::Time::seconds(rotation);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+                SSL_CTX_set_tlsext_ticket_key_evp_cb(_ctx, IceSSL_opensslTicketKeyCallback);
+#else
+                SSL_CTX_set_tlsext_ticket_key_cb(_ctx, IceSSL_opensslTicketKeyCallback);
+#endif
+            }
+            else
+            {
+                SSL_CTX_set_options(_ctx, SSL_OP_NO_TICKET);
+            }
+        }
+        else
+        {
+            SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+        }
+
+        //
+        // Let OpenSSL enable kernel TLS after the handshake if the kernel and
+        // the negotiated cipher support it.
+        //
+        if(properties->getPropertyAsInt(propPrefix + "KernelTLS") > 0)
+        {
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+            SSL_CTX_set_options(_ctx, SSL_OP_ENABLE_KTLS);
+#else
+            if(securityTraceLevel() >= 1)
+            {
+                getLogger()->trace(securityTraceCategory(), "IceSSL: kernel TLS isn't supported by this OpenSSL version");
+            }
+#endif
+        }
 
         //
-        // Although we disable session caching, we still need to set a session ID
-        // context (ICE-5103). The value can be anything; here we just use the
-        // pointer to this SharedInstance object.
+        // We need to set a session ID context even if session caching is disabled
+        // (ICE-5103). The value can be anything; here we just use the pointer to
+        // this SharedInstance object.
         //
         SSL_CTX_set_session_id_context(_ctx, reinterpret_cast<unsigned char*>(this),
                                         static_cast<unsigned int>(sizeof(this)));
@@ -905,12 +1024,144 @@ OpenSSL::SSLEngine::sslErrors() const
 void
 OpenSSL::SSLEngine::destroy()
 {
+    {
+        IceUtil::Mutex::Lock sync(_sessionMutex);
+        for(map<string, SSL_SESSION*>::const_iterator p = _sessions.begin(); p != _sessions.end(); ++p)
+        {
+            SSL_SESSION_free(p->second);
+        }
+        _sessions.clear();
+        _sessionQueue.clear();
+
+        for(deque<TicketKey>::iterator p = _ticketKeys.begin(); p != _ticketKeys.end(); ++p)
+        {
+            OPENSSL_cleanse(p->aesKey, sizeof(p->aesKey));
+            OPENSSL_cleanse(p->hmacKey, sizeof(p->hmacKey));
+        }
+        _ticketKeys.clear();
+    }
+
     if(_ctx)
     {
         SSL_CTX_free(_ctx);
     }
 }
 
+bool
+OpenSSL::SSLEngine::sessionCacheEnabled() const
+{
+    return _sessionCacheSize > 0;
+}
+
+void
+OpenSSL::SSLEngine::setSession(SSL* ssl, const string& key)
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    map<string, SSL_SESSION*>::const_iterator p = _sessions.find(key);
+    if(p != _sessions.end())
+    {
+        SSL_set_session(ssl, p->second);
+    }
+}
+
+void
+OpenSSL::SSLEngine::addSession(const string& key, SSL_SESSION* session)
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    map<string, SSL_SESSION*>::iterator p = _sessions.find(key);
+    if(p != _sessions.end())
+    {
+        SSL_SESSION_free(p->second);
+        p->second = session;
+        return;
+    }
+
+    //
+    // Evict the session of the oldest target endpoint if the cache is full.
+    //
+    if(_sessions.size() >= static_cast<size_t>(_sessionCacheSize))
+    {
+        p = _sessions.find(_sessionQueue.front());
+        assert(p != _sessions.end());
+        SSL_SESSION_free(p->second);
+        _sessions.erase(p);
+        _sessionQueue.pop_front();
+    }
+    _sessions.insert(make_pair(key, session));
+    _sessionQueue.push_back(key);
+}
+
+int
+OpenSSL::SSLEngine::ticketKey(unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* ctx, unsigned char* hmacKey,
+                              int enc)
+{
+    IceUtil::Mutex::Lock sync(_sessionMutex);
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    if(enc)
+    {
+        //
+        // Rotate the key used to encrypt new tickets. The previous key is kept
+        // to decrypt the tickets issued before the rotation.
+        //
+        if(_ticketKeys.empty() || now - _ticketKeys.front().created >= _ticketKeyRotation)
+        {
+            TicketKey key;
+            if(RAND_bytes(key.name, sizeof(key.name)) <= 0 ||
+               RAND_bytes(key.aesKey, sizeof(key.aesKey)) <= 0 ||
+               RAND_bytes(key.hmacKey, sizeof(key.hmacKey)) <= 0)
+            {
+                return -1;
+            }
+            key.created = now;
+            _ticketKeys.push_front(key);
+            OPENSSL_cleanse(key.aesKey, sizeof(key.aesKey));
+            OPENSSL_cleanse(key.hmacKey, sizeof(key.hmacKey));
+            if(_ticketKeys.size() > 2)
+            {
+                OPENSSL_cleanse(_ticketKeys.back().aesKey, sizeof(key.aesKey));
+                OPENSSL_cleanse(_ticketKeys.back().hmacKey, sizeof(key.hmacKey));
+                _ticketKeys.pop_back();
+            }
+        }
+
+        const TicketKey& key = _ticketKeys.front();
+        if(RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) <= 0 ||
+           !EVP_EncryptInit_ex(ctx, EVP_aes_256_cbc(), 0, key.aesKey, iv))
+        {
+            return -1;
+        }
+        memcpy(name, key.name, sizeof(key.name));
+        memcpy(hmacKey, key.hmacKey, sizeof(key.hmacKey));
+        return 1;
+    }
+    else
+    {
+        for(deque<TicketKey>::const_iterator p = _ticketKeys.begin(); p != _ticketKeys.end(); ++p)
+        {
+            if(memcmp(name, p->name, sizeof(p->name)) == 0)
+            {
+                if(now - p->created >= _ticketKeyRotation * 2)
+                {
+                    return 0; // The key expired, perform a full handshake.
+                }
+
+                if(!EVP_DecryptInit_ex(ctx, EVP_aes_256_cbc(), 0, p->aesKey, iv))
+                {
+                    return -1;
+                }
+                memcpy(hmacKey, p->hmacKey, sizeof(p->hmacKey));
+
+                //
+                // Always issue a new ticket, TLS 1.3 clients only use a ticket once
+                // and tickets encrypted with the previous key must be renewed.
+                //
+                return 2;
+            }
+        }
+        return 0; // Unknown key, perform a full handshake.
+    }
+}
+
 void
 OpenSSL::SSLEngine::verifyPeer(const string& address, const IceSSL::ConnectionInfoPtr& info, const string& desc)
 {
@@ -15,6 +15,10 @@
 #include <IceSSL/OpenSSLUtil.h>
 
 #include <Ice/BuiltinSequences.h>
+#include <IceUtil/Time.h>
+
+#include <deque>
+#include <map>
 
 namespace IceSSL
 {
@@ -43,6 +47,19 @@ public:
     void context(SSL_CTX*);
     std::string sslErrors() const;
 
+    //
+    // Client session cache, the sessions are cached by target endpoint.
+    //
+    bool sessionCacheEnabled() const;
+    void setSession(SSL*, const std::string&);
+    void addSession(const std::string&, SSL_SESSION*);
+
+    //
+    // Get the session ticket key for encrypting a new ticket or decrypting a
+    // ticket with the given key name.
+    //
+    int ticketKey(unsigned char*, unsigned char*, EVP_CIPHER_CTX*, unsigned char*, int);
+
 private:
 
     SSL_METHOD* getMethod(int);
@@ -52,6 +69,21 @@ private:
 
     SSL_CTX* _ctx;
 
+    int _sessionCacheSize;
+    IceUtil::Mutex _sessionMutex;
+    std::map<std::string, SSL_SESSION*> _sessions;
+    std::deque<std::string> _sessionQueue;
+
+    struct TicketKey
+    {
+        unsigned char name[16];
+        unsigned char aesKey[32];
+        unsigned char hmacKey[32];
+        IceUtil::Time created;
+    };
+    IceUtil::Time _ticketKeyRotation;
+    std::deque<TicketKey> _ticketKeys;
+
 #ifndef OPENSSL_NO_DH
     IceSSL::OpenSSL::DHParamsPtr _dhParams;
 #endif
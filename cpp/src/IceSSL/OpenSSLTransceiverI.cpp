@@ -31,6 +31,19 @@ using namespace std;
 using namespace Ice;
 using namespace IceSSL;
 
+#ifndef ICE_USE_IOCP
+namespace
+{
+
+//
+// The maximum size of the buffers gathered by writeBuffers(), the size
+// of the payload of an SSL record.
+//
+const size_t maxGatherSize = 16 * 1024;
+
+}
+#endif
+
 //
 // BUGFIX: an openssl bug that affects OpenSSL < 1.0.0k
 // could cause a deadlock when decoding public keys.
@@ -151,6 +164,22 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         //
         SSL_set_ex_data(_ssl, 0, this);
 
+        //
+        // Resume the session of a previous connection to the same target endpoint.
+        //
+        if(!_incoming && _engine->sessionCacheEnabled())
+        {
+            ostringstream os;
+            os << _host;
+            Ice::IPConnectionInfoPtr info = ICE_DYNAMIC_CAST(Ice::IPConnectionInfo, _delegate->getInfo());
+            if(info)
+            {
+                os << ' ' << info->remoteAddress << ':' << info->remotePort;
+            }
+            _sessionKey = os.str();
+            _engine->setSession(_ssl, _sessionKey);
+        }
+
         //
         // Determine whether a certificate is required from the peer.
         //
@@ -309,6 +338,42 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         }
     }
 
+    _resumed = SSL_session_reused(_ssl) != 0;
+    if(_resumed)
+    {
+        //
+        // The verify callback isn't called when a session is resumed, rebuild
+        // the verified certificate chain from the peer certificates of the session.
+        //
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+        X509* peer = SSL_get1_peer_certificate(_ssl);
+#else
+        X509* peer = SSL_get_peer_certificate(_ssl);
+#endif
+        if(peer)
+        {
+            X509_STORE_CTX* ctx = X509_STORE_CTX_new();
+            if(ctx && X509_STORE_CTX_init(ctx, SSL_CTX_get_cert_store(_engine->context()), peer,
+                                          SSL_get_peer_cert_chain(_ssl)))
+            {
+                X509_verify_cert(ctx); // The verification result is saved with the session.
+                STACK_OF(X509)* chain = X509_STORE_CTX_get1_chain(ctx);
+                if(chain != 0)
+                {
+                    _certs.clear();
+                    for(int i = 0; i < sk_X509_num(chain); ++i)
+                    {
+                        CertificatePtr cert = OpenSSL::Certificate::create(X509_dup(sk_X509_value(chain, i)));
+                        _certs.push_back(cert);
+                    }
+                    sk_X509_pop_free(chain, X509_free);
+                }
+            }
+            X509_STORE_CTX_free(ctx);
+            X509_free(peer);
+        }
+    }
+
     long result = SSL_get_verify_result(_ssl);
     if(result != X509_V_OK)
     {
@@ -340,6 +405,16 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         _verified = true;
     }
 
+#if !defined(ICE_USE_IOCP) && defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+    //
+    // If OpenSSL enabled kernel TLS for sending, the kernel encrypts the data
+    // written to the socket and the messages are written with the delegate
+    // transceiver, which also supports gathered writes. Reads still go through
+    // SSL_read as OpenSSL must process the TLS control records.
+    //
+    _kernelTLS = BIO_get_ktls_send(SSL_get_wbio(_ssl)) != 0;
+#endif
+
     _cipher = SSL_get_cipher_name(_ssl); // Nothing needs to be free'd.
     _engine->verifyPeer(_host, ICE_DYNAMIC_CAST(ConnectionInfo, getInfo()), toString());
 
@@ -362,6 +437,18 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
             out << "cipher = " << SSL_CIPHER_get_name(cipher) << "\n";
             out << "bits = " << SSL_CIPHER_get_bits(cipher, 0) << "\n";
             out << "protocol = " << SSL_get_version(_ssl) << "\n";
+            out << "resumed = " << (_resumed ? "true" : "false") << "\n";
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+            if(SSL_get_options(_ssl) & SSL_OP_ENABLE_KTLS)
+            {
+                out << "kernel TLS = " << (_kernelTLS ? "send" : "none");
+                if(BIO_get_ktls_recv(SSL_get_rbio(_ssl)))
+                {
+                    out << (_kernelTLS ? ", receive" : "receive");
+                }
+                out << "\n";
+            }
+#endif
         }
         out << IceInternal::fdToString(SSL_get_fd(_ssl));
     }
@@ -415,6 +502,13 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
         return _delegate->write(buf);
     }
 
+#ifndef ICE_USE_IOCP
+    if(_kernelTLS)
+    {
+        return _delegate->write(buf);
+    }
+#endif
+
 #ifdef ICE_USE_IOCP
     if(_writeBuffer.i != _writeBuffer.b.end())
     {
@@ -545,6 +639,86 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
     return IceInternal::SocketOperationNone;
 }
 
+#ifndef ICE_USE_IOCP
+IceInternal::SocketOperation
+OpenSSL::TransceiverI::writeBuffers(vector<IceInternal::Buffer*>& buffers)
+{
+    if(_kernelTLS)
+    {
+        return _delegate->writeBuffers(buffers);
+    }
+
+    //
+    // The buffers which fit in a single SSL record are copied into the
+    // gather buffer and sent with a single SSL_write call. The gathered
+    // buffers are only marked as written once the gather buffer is
+    // written: if the write would block, the caller retries with the
+    // same buffers, more buffers might follow them.
+    //
+    size_t start = 0;
+    while(true)
+    {
+        while(start < buffers.size() && buffers[start]->i == buffers[start]->b.end())
+        {
+            ++start;
+        }
+        if(start == buffers.size())
+        {
+            return IceInternal::SocketOperationNone;
+        }
+
+        if(_gathered == 0)
+        {
+            size_t size = 0;
+            size_t n = start;
+            while(n < buffers.size())
+            {
+                size_t sz = static_cast<size_t>(buffers[n]->b.end() - buffers[n]->i);
+                if(size + sz > maxGatherSize)
+                {
+                    break;
+                }
+                size += sz;
+                ++n;
+            }
+
+            if(n - start < 2)
+            {
+                IceInternal::SocketOperation op = write(*buffers[start]);
+                if(op)
+                {
+                    return op;
+                }
+                continue;
+            }
+
+            _gatherBuffer.b.resize(size);
+            Byte* p = _gatherBuffer.b.begin();
+            for(size_t i = start; i < n; ++i)
+            {
+                size_t sz = static_cast<size_t>(buffers[i]->b.end() - buffers[i]->i);
+                memcpy(p, buffers[i]->i, sz);
+                p += sz;
+            }
+            _gatherBuffer.i = _gatherBuffer.b.begin();
+            _gathered = n - start;
+        }
+
+        assert(buffers.size() >= start + _gathered);
+        IceInternal::SocketOperation op = write(_gatherBuffer);
+        if(op)
+        {
+            return op;
+        }
+        for(size_t i = start; i < start + _gathered; ++i)
+        {
+            buffers[i]->i = buffers[i]->b.end();
+        }
+        _gathered = 0;
+    }
+}
+#endif
+
 IceInternal::SocketOperation
 OpenSSL::TransceiverI::read(IceInternal::Buffer& buf)
 {
@@ -782,6 +956,7 @@ OpenSSL::TransceiverI::getInfo() const
     info->cipher = _cipher;
     info->certs = _certs;
     info->verified = _verified;
+    info->resumed = _resumed;
     return info;
 }
 
@@ -842,6 +1017,21 @@ OpenSSL::TransceiverI::verifyCallback(int ok, X509_STORE_CTX* c)
     return 1;
 }
 
+bool
+OpenSSL::TransceiverI::newSession(SSL_SESSION* session)
+{
+    //
+    // Servers cache the sessions in the SSL context cache, clients cache them
+    // with the engine by target endpoint.
+    //
+    if(_incoming || _sessionKey.empty())
+    {
+        return false;
+    }
+    _engine->addSession(_sessionKey, session);
+    return true;
+}
+
 OpenSSL::TransceiverI::TransceiverI(const InstancePtr& instance,
                                     const IceInternal::TransceiverPtr& delegate,
                                     const string& hostOrAdapterName,
@@ -854,12 +1044,16 @@ OpenSSL::TransceiverI::TransceiverI(const InstancePtr& instance,
     _delegate(delegate),
     _connected(false),
     _verified(false),
+    _resumed(false),
+    _kernelTLS(false),
     _ssl(0)
 #ifdef ICE_USE_IOCP
     , _iocpBio(0),
     _sentBytes(0),
     _maxSendPacketSize(0),
     _maxRecvPacketSize(0)
+#else
+    , _gathered(0)
 #endif
 {
 }
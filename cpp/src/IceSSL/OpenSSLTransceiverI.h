@@ -23,6 +23,7 @@
 
 typedef struct ssl_st SSL;
 typedef struct bio_st BIO;
+typedef struct ssl_session_st SSL_SESSION;
 
 namespace IceSSL
 {
@@ -40,6 +41,9 @@ public:
     virtual IceInternal::SocketOperation closing(bool, const Ice::LocalException&);
     virtual void close();
     virtual IceInternal::SocketOperation write(IceInternal::Buffer&);
+#ifndef ICE_USE_IOCP
+    virtual IceInternal::SocketOperation writeBuffers(std::vector<IceInternal::Buffer*>&);
+#endif
     virtual IceInternal::SocketOperation read(IceInternal::Buffer&);
 #ifdef ICE_USE_IOCP
     virtual bool startWrite(IceInternal::Buffer&);
@@ -55,6 +59,7 @@ public:
     virtual void setBufferSize(int rcvSize, int sndSize);
 
     int verifyCallback(int , X509_STORE_CTX*);
+    bool newSession(SSL_SESSION*);
 
 private:
 
@@ -78,6 +83,9 @@ private:
     std::string _cipher;
     std::vector<IceSSL::CertificatePtr> _certs;
     bool _verified;
+    bool _resumed;
+    bool _kernelTLS;
+    std::string _sessionKey;
 
     SSL* _ssl;
 #ifdef ICE_USE_IOCP
@@ -87,6 +95,9 @@ private:
     int _sentBytes;
     size_t _maxSendPacketSize;
     size_t _maxRecvPacketSize; 
+#else
+    IceInternal::Buffer _gatherBuffer;
+    size_t _gathered;
 #endif
 };
 typedef IceUtil::Handle<TransceiverI> TransceiverIPtr;
@@ -996,6 +996,7 @@ SChannel::TransceiverI::getInfo() const
     info->cipher = _cipher;
     info->certs = _certs;
     info->verified = _verified;
+    info->resumed = false;
     return info;
 }
 
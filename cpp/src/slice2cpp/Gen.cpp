@@ -79,6 +79,73 @@ isConstexprType(const TypePtr& type)
     }
 }
 
+//
+// Returns true if the given struct only contains numeric built-in types
+// other than bool, or nested structs with this property, in which case
+// the encoding of the struct matches its C++ layout if the struct has no
+// padding. The generated StreamableTraits select the
+// StreamHelperCategoryStructPacked category when the sizeof of the struct
+// is equal to its encoded size, sequences of such structs are marshaled
+// with a single copy.
+//
+bool
+isPackedStruct(const StructPtr& p)
+{
+    if(findMetaData(p->getMetaData(), false) == "%class")
+    {
+        return false;
+    }
+
+    DataMemberList members = p->dataMembers();
+    for(DataMemberList::const_iterator q = members.begin(); q != members.end(); ++q)
+    {
+        BuiltinPtr builtin = BuiltinPtr::dynamicCast((*q)->type());
+        if(builtin)
+        {
+            switch(builtin->kind())
+            {
+                case Builtin::KindByte:
+                case Builtin::KindShort:
+                case Builtin::KindInt:
+                case Builtin::KindLong:
+                case Builtin::KindFloat:
+                case Builtin::KindDouble:
+                {
+                    break;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            StructPtr st = StructPtr::dynamicCast((*q)->type());
+            if(!st || !isPackedStruct(st))
+            {
+                return false;
+            }
+        }
+    }
+    return !members.empty();
+}
+
+//
+// Returns the StreamHelperCategory of the given struct.
+//
+string
+structHelperCategory(const StructPtr& p, const string& scoped)
+{
+    if(isPackedStruct(p))
+    {
+        ostringstream os;
+        os << "sizeof(" << scoped << ") == " << p->minWireSize()
+           << " ? StreamHelperCategoryStructPacked : StreamHelperCategoryStruct";
+        return os.str();
+    }
+    return "StreamHelperCategoryStruct";
+}
 
 string
 getDeprecateSymbol(const ContainedPtr& p1, const ContainedPtr& p2)
@@ -376,6 +443,99 @@ condString(bool ok, const string& str)
     return ok ? str : "";
 }
 
+//
+// Returns true if the operations of the given class or interface are
+// dispatched with a binary search of the sorted operation names instead
+// of the generated switch.
+//
+bool
+binarySearchDispatch(const ClassDefPtr& p)
+{
+    return p->hasMetaData("cpp:dispatch:binary-search");
+}
+
+//
+// Writes the dispatch of operations with names of the same length. The
+// operations are split on the character which best discriminates them
+// until a single operation remains, the name of this operation is then
+// compared with the requested operation.
+//
+void
+writeDispatchCharSwitch(IceUtilInternal::Output& C, const vector<string>& names)
+{
+    if(names.size() == 1)
+    {
+        C << nl << "if(current.operation == \"" << names.front() << "\")";
+        C << sb;
+        C << nl << "return _iceD_" << names.front() << "(in, current);";
+        C << eb;
+        return;
+    }
+
+    size_t pos = 0;
+    size_t count = 0;
+    for(size_t i = 0; i < names.front().size(); ++i)
+    {
+        set<char> chars;
+        for(vector<string>::const_iterator q = names.begin(); q != names.end(); ++q)
+        {
+            chars.insert((*q)[i]);
+        }
+        if(chars.size() > count)
+        {
+            pos = i;
+            count = chars.size();
+        }
+    }
+    assert(count > 1);
+
+    map<char, vector<string> > cases;
+    for(vector<string>::const_iterator q = names.begin(); q != names.end(); ++q)
+    {
+        cases[(*q)[pos]].push_back(*q);
+    }
+
+    C << nl << "switch(current.operation[" << pos << "])";
+    C << sb;
+    for(map<char, vector<string> >::const_iterator q = cases.begin(); q != cases.end(); ++q)
+    {
+        C << nl << "case '" << q->first << "':";
+        C << sb;
+        writeDispatchCharSwitch(C, q->second);
+        C << nl << "break;";
+        C << eb;
+    }
+    C << eb;
+}
+
+//
+// Writes the body of _iceDispatch which switches on the length of the
+// operation name and then on the characters of the name.
+//
+void
+writeDispatchSwitch(IceUtilInternal::Output& C, const StringList& allOpNames)
+{
+    map<size_t, vector<string> > lengths;
+    for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
+    {
+        lengths[q->size()].push_back(*q);
+    }
+
+    C << nl << "switch(current.operation.size())";
+    C << sb;
+    for(map<size_t, vector<string> >::const_iterator q = lengths.begin(); q != lengths.end(); ++q)
+    {
+        C << nl << "case " << q->first << ':';
+        C << sb;
+        writeDispatchCharSwitch(C, q->second);
+        C << nl << "break;";
+        C << eb;
+    }
+    C << eb;
+    C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
+      << "current.facet, current.operation);";
+}
+
 }
 
 Slice::Gen::Gen(const string& base, const string& headerExtension, const string& sourceExtension,
@@ -2572,67 +2732,77 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
             H << sp;
             H << nl << "virtual bool _iceDispatch(::IceInternal::Incoming&, const ::Ice::Current&);";
 
-            string flatName = "iceC" + p->flattenedScope() + p->name() + "_all";
-            C << sp << nl << "namespace";
-            C << nl << "{";
-            C << nl << "const ::std::string " << flatName << "[] =";
-            C << sb;
+            //
+            // Check if we need to generate ice_operationAttributes()
+            //
+            map<string, int> attributesMap;
+            for(OperationList::iterator r = allOps.begin(); r != allOps.end(); ++r)
+            {
+                int attributes = (*r)->attributes();
+                if(attributes != 0)
+                {
+                    attributesMap.insert(map<string, int>::value_type((*r)->name(), attributes));
+                }
+            }
 
-            for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end();)
+            string flatName = "iceC" + p->flattenedScope() + p->name() + "_all";
+            if(binarySearchDispatch(p) || !attributesMap.empty())
             {
-                C << nl << '"' << *q << '"';
-                if(++q != allOpNames.end())
+                C << sp << nl << "namespace";
+                C << nl << "{";
+                C << nl << "const ::std::string " << flatName << "[] =";
+                C << sb;
+
+                for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end();)
                 {
-                    C << ',';
+                    C << nl << '"' << *q << '"';
+                    if(++q != allOpNames.end())
+                    {
+                        C << ',';
+                    }
                 }
+                C << eb << ';';
+                C << sp << nl << "}";
             }
-            C << eb << ';';
-            C << sp << nl << "}";
             C << sp;
             C << nl << "bool";
             C << nl << scoped.substr(2) << "::_iceDispatch(::IceInternal::Incoming& in, const ::Ice::Current& current)";
             C << sb;
 
-            C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
-              << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-              << ", current.operation);";
-            C << nl << "if(r.first == r.second)";
-            C << sb;
-            C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
-              << "current.facet, current.operation);";
-            C << eb;
-            C << sp;
-            C << nl << "switch(r.first - " << flatName << ')';
-            C << sb;
-            int i = 0;
-            for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
+            if(binarySearchDispatch(p))
             {
-                C << nl << "case " << i++ << ':';
+                C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
+                  << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
+                  << ", current.operation);";
+                C << nl << "if(r.first == r.second)";
                 C << sb;
-                C << nl << "return _iceD_" << *q << "(in, current);";
+                C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
+                  << "current.facet, current.operation);";
                 C << eb;
-            }
-            C << nl << "default:";
-            C << sb;
-            C << nl << "assert(false);";
-            C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
-              << "current.facet, current.operation);";
-            C << eb;
-            C << eb;
-            C << eb;
-
-            //
-            // Check if we need to generate ice_operationAttributes()
-            //
-            map<string, int> attributesMap;
-            for(OperationList::iterator r = allOps.begin(); r != allOps.end(); ++r)
-            {
-                int attributes = (*r)->attributes();
-                if(attributes != 0)
+                C << sp;
+                C << nl << "switch(r.first - " << flatName << ')';
+                C << sb;
+                int i = 0;
+                for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
                 {
-                    attributesMap.insert(map<string, int>::value_type((*r)->name(), attributes));
+                    C << nl << "case " << i++ << ':';
+                    C << sb;
+                    C << nl << "return _iceD_" << *q << "(in, current);";
+                    C << eb;
                 }
+                C << nl << "default:";
+                C << sb;
+                C << nl << "assert(false);";
+                C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
+                  << "current.facet, current.operation);";
+                C << eb;
+                C << eb;
+            }
+            else
+            {
+                writeDispatchSwitch(C, allOpNames);
             }
+            C << eb;
 
             if(!attributesMap.empty())
             {
@@ -4457,7 +4627,7 @@ Slice::Gen::StreamVisitor::visitStructStart(const StructPtr& p)
         }
         else
         {
-            H << nl << "static const StreamHelperCategory helper = StreamHelperCategoryStruct;";
+            H << nl << "static const StreamHelperCategory helper = " << structHelperCategory(p, fullStructName) << ";";
         }
         H << nl << "static const int minWireSize = " << p->minWireSize() << ";";
         if(p->isVariableLength())
@@ -4820,6 +4990,13 @@ Slice::Gen::MetaDataVisitor::validate(const SyntaxTreeBasePtr& cont, const Strin
             {
                 continue;
             }
+            {
+                ClassDefPtr cl = ClassDefPtr::dynamicCast(cont);
+                if(cl && !cl->isLocal() && ss == "dispatch:binary-search")
+                {
+                    continue;
+                }
+            }
             if(!cpp11 && EnumPtr::dynamicCast(cont) && ss == "scoped")
             {
                 continue;
@@ -5272,17 +5449,20 @@ Slice::Gen::Cpp11DeclVisitor::visitClassDefStart(const ClassDefPtr& p)
         allOpNames.sort();
         allOpNames.unique();
 
-        C << nl << "const ::std::string iceC" << p->flattenedScope() << p->name() << "_ops[] =";
-        C << sb;
-        for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end();)
+        if(binarySearchDispatch(p))
         {
-            C << nl << '"' << *q << '"';
-            if(++q != allOpNames.end())
+            C << nl << "const ::std::string iceC" << p->flattenedScope() << p->name() << "_ops[] =";
+            C << sb;
+            for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end();)
             {
-                C << ',';
+                C << nl << '"' << *q << '"';
+                if(++q != allOpNames.end())
+                {
+                    C << ',';
+                }
             }
+            C << eb << ';';
         }
-        C << eb << ';';
     }
 
     return true;
@@ -6911,29 +7091,39 @@ Slice::Gen::Cpp11InterfaceVisitor::visitClassDefEnd(const ClassDefPtr& p)
         C << nl << scoped.substr(2) << "::_iceDispatch(::IceInternal::Incoming& in, const ::Ice::Current& current)";
         C << sb;
 
-        C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
-          << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size() << ", current.operation);";
-        C << nl << "if(r.first == r.second)";
-        C << sb;
-        C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, current.facet, current.operation);";
-        C << eb;
-        C << sp;
-        C << nl << "switch(r.first - " << flatName << ')';
-        C << sb;
-        int i = 0;
-        for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
+        if(binarySearchDispatch(p))
         {
-            C << nl << "case " << i++ << ':';
+            C << nl << "::std::pair<const ::std::string*, const ::std::string*> r = "
+              << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
+              << ", current.operation);";
+            C << nl << "if(r.first == r.second)";
+            C << sb;
+            C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, current.facet, "
+              << "current.operation);";
+            C << eb;
+            C << sp;
+            C << nl << "switch(r.first - " << flatName << ')';
+            C << sb;
+            int i = 0;
+            for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
+            {
+                C << nl << "case " << i++ << ':';
+                C << sb;
+                C << nl << "return _iceD_" << *q << "(in, current);";
+                C << eb;
+            }
+            C << nl << "default:";
             C << sb;
-            C << nl << "return _iceD_" << *q << "(in, current);";
+            C << nl << "assert(false);";
+            C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, current.facet, "
+              << "current.operation);";
+            C << eb;
             C << eb;
         }
-        C << nl << "default:";
-        C << sb;
-        C << nl << "assert(false);";
-        C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, current.facet, current.operation);";
-        C << eb;
-        C << eb;
+        else
+        {
+            writeDispatchSwitch(C, allOpNames);
+        }
         C << eb;
     }
 
@@ -7604,7 +7794,7 @@ Slice::Gen::Cpp11StreamVisitor::visitStructStart(const StructPtr& p)
     H << nl << "template<>";
     H << nl << "struct StreamableTraits<" << scoped << ">";
     H << sb;
-    H << nl << "static const StreamHelperCategory helper = StreamHelperCategoryStruct;";
+    H << nl << "static const StreamHelperCategory helper = " << structHelperCategory(p, scoped) << ";";
     H << nl << "static const int minWireSize = " << p->minWireSize() << ";";
     H << nl << "static const bool fixedLength = " << (p->isVariableLength() ? "false" : "true") << ";";
     H << eb << ";" << nl;
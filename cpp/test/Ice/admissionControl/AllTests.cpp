@@ -0,0 +1,90 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Test.h>
+
+using namespace std;
+using namespace Test;
+
+TestIntfPrxPtr
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    string ref = "test:" + getTestEndpoint(communicator, 0);
+    TestIntfPrxPtr obj = ICE_CHECKED_CAST(TestIntfPrx, communicator->stringToProxy(ref));
+    test(obj);
+
+    cout << "testing admission control... " << flush;
+    {
+        int count = obj->getOpCallCount();
+
+        //
+        // While the dispatch thread is busy, the requests which find more
+        // than one request waiting behind them when they are dispatched
+        // are rejected. ice_ping and the requests with the priority
+        // context are always admitted.
+        //
+        Ice::Context ctx;
+        ctx["priority"] = "";
+#ifdef ICE_CPP11_MAPPING
+        auto sleep = obj->sleepAsync(500, ctx);
+        auto ping = obj->ice_pingAsync();
+        auto priority = obj->opAsync(ctx);
+        vector<future<void>> results;
+        for(int i = 0; i < 4; ++i)
+        {
+            results.push_back(obj->opAsync());
+        }
+        sleep.get();
+        ping.get();
+        priority.get();
+        for(int i = 0; i < 4; ++i)
+        {
+            try
+            {
+                results[i].get();
+                test(i >= 2);
+            }
+            catch(const Ice::UnknownLocalException&)
+            {
+                test(i < 2);
+            }
+        }
+#else
+        Ice::AsyncResultPtr sleep = obj->begin_sleep(500, ctx);
+        Ice::AsyncResultPtr ping = obj->begin_ice_ping();
+        Ice::AsyncResultPtr priority = obj->begin_op(ctx);
+        vector<Ice::AsyncResultPtr> results;
+        for(int i = 0; i < 4; ++i)
+        {
+            results.push_back(obj->begin_op());
+        }
+        obj->end_sleep(sleep);
+        obj->end_ice_ping(ping);
+        obj->end_op(priority);
+        for(int i = 0; i < 4; ++i)
+        {
+            try
+            {
+                obj->end_op(results[i]);
+                test(i >= 2);
+            }
+            catch(const Ice::UnknownLocalException&)
+            {
+                test(i < 2);
+            }
+        }
+#endif
+        test(obj->getOpCallCount() == count + 3);
+    }
+    cout << "ok" << endl;
+
+    return obj;
+}
@@ -0,0 +1,43 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+TestIntfI::TestIntfI() : _opCallCount(0)
+{
+}
+
+void
+TestIntfI::sleep(Ice::Int ms, const Ice::Current&)
+{
+    IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(ms));
+}
+
+void
+TestIntfI::op(const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    ++_opCallCount;
+}
+
+Ice::Int
+TestIntfI::getOpCallCount(const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    return _opCallCount;
+}
+
+void
+TestIntfI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,28 @@
+# -*- coding: utf-8 -*-
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+testsuite = TestSuite(__file__, options = { "compress" : [False], "serialize" : [False] })
+
+#
+# Also run the client/server test with small write coalescing limits to
+# exercise messages partially written along with the previous message.
+#
+testsuite.addTestCase(ClientServerTestCase("client/server with small write coalescing", props = {
+    "Ice.WriteCoalesceCount" : 3,
+    "Ice.WriteCoalesceSize" : 1,
+}))
+
+#
+# And with the io_uring selector, the selector falls back to epoll if io_uring
+# isn't supported.
+#
+testsuite.addTestCase(ClientServerTestCase("client/server with io_uring", props = {
+    "Ice.IoUring" : 1,
+}, options = { "protocol" : ["tcp", "ws"] }))
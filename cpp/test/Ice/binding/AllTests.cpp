@@ -554,6 +554,206 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing parallel connection establishment... " << flush;
+    {
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter37", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter38", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter39", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Ordered)));
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_parallelConnect(3));
+        test(test->ice_getParallelConnect() == 3);
+
+        //
+        // The next connectors are only tried if the connection to the first connector
+        // fails or doesn't complete within the parallel connect delay.
+        //
+        test(test->getAdapterName() == "Adapter37");
+        test->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+
+        com->deactivateObjectAdapter(adapters[0]);
+        test(test->getAdapterName() == "Adapter38");
+        test->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+
+        com->deactivateObjectAdapter(adapters[1]);
+        test(test->getAdapterName() == "Adapter39");
+        test->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+
+        com->deactivateObjectAdapter(adapters[2]);
+        try
+        {
+            test->getAdapterName();
+            test(false);
+        }
+        catch(const Ice::ConnectFailedException&)
+        {
+        }
+#ifdef _WIN32
+        catch(const Ice::ConnectTimeoutException&)
+        {
+        }
+#endif
+
+        //
+        // A held adapter doesn't accept connections, the connection establishment with
+        // its endpoint only fails once the connect timeout expires. The connection to the
+        // second endpoint must be established without waiting for the connect timeout.
+        //
+        adapters.clear();
+        adapters.push_back(com->createObjectAdapter("Adapter42", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter43", "default"));
+        adapters[0]->hold();
+
+        test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Ordered)));
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_timeout(10000));
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        test(ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_parallelConnect(2))->getAdapterName() == "Adapter43");
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(5000));
+
+        adapters[0]->activate();
+        deactivate(com, adapters);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection pools... " << flush;
+    {
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter40", "default");
+        TestIntfPrxPtr test = ICE_UNCHECKED_CAST(TestIntfPrx, adapter->getTestIntf()->ice_connectionPoolSize(3));
+        test(test->ice_getConnectionPoolSize() == 3);
+
+        //
+        // Requests are spread over the connections of the pool once they are
+        // established. The first connection is shared with proxies without a
+        // pool.
+        //
+        set<Ice::ConnectionPtr> connections;
+        for(int i = 0; i < 100 && connections.size() < 3; ++i)
+        {
+            test(test->getAdapterName() == "Adapter40");
+            connections.insert(test->ice_getConnection());
+        }
+        test(connections.size() == 3);
+        test(connections.find(adapter->getTestIntf()->ice_getConnection()) != connections.end());
+        test(connections.find(test->ice_getCachedConnection()) != connections.end());
+
+        //
+        // Requests sent over a closed connection of the pool are retried.
+        //
+        (*connections.begin())->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+        for(int i = 0; i < 10; ++i)
+        {
+            test(test->getAdapterName() == "Adapter40");
+        }
+
+        Ice::ObjectPrxPtr batch = test->ice_batchOneway();
+        batch->ice_ping();
+        batch->ice_ping();
+        batch->ice_flushBatchRequests();
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing adaptive endpoint selection... " << flush;
+    {
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter91", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter92", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter93", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Adaptive)));
+        test(test->ice_getEndpointSelection() == Ice::ICE_ENUM(EndpointSelectionType, Adaptive));
+
+        //
+        // The endpoints without latency are preferred, all the endpoints
+        // are used without closing the connections.
+        //
+        set<string> names;
+        names.insert("Adapter91");
+        names.insert("Adapter92");
+        names.insert("Adapter93");
+        for(int i = 0; i < 100 && !names.empty(); ++i)
+        {
+            names.erase(test->getAdapterName());
+        }
+        test(names.empty());
+
+        //
+        // The requests sent to a held adapter time out, the latency of its
+        // endpoint increases and the next requests are sent with the other
+        // endpoints.
+        //
+        adapters[2]->hold();
+        TestIntfPrxPtr timeout = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_invocationTimeout(500));
+        int timeouts = 0;
+        for(int i = 0; i < 50; ++i)
+        {
+            try
+            {
+                string name = timeout->getAdapterName();
+                test(name == "Adapter91" || name == "Adapter92");
+            }
+            catch(const Ice::InvocationTimeoutException&)
+            {
+                ++timeouts;
+            }
+        }
+        test(timeouts <= 2);
+        adapters[2]->activate();
+
+        //
+        // The requests sent to a deactivated adapter are retried with
+        // the other endpoints.
+        //
+        com->deactivateObjectAdapter(adapters[0]);
+        for(int i = 0; i < 20; ++i)
+        {
+            string name = test->getAdapterName();
+            test(name == "Adapter92" || name == "Adapter93");
+        }
+
+        deactivate(com, adapters);
+
+        //
+        // An endpoint whose connection establishment failed is tried again
+        // once the latency of the failure decayed. The loads are decayed
+        // faster with a separate communicator.
+        //
+        adapters.clear();
+        adapters.push_back(com->createObjectAdapter("Adapter94", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter95", "default"));
+        string proxy = communicator->proxyToString(createTestIntfPrx(adapters));
+        string endpoint = adapters[0]->getTestIntf()->ice_getEndpoints()[0]->toString();
+        com->deactivateObjectAdapter(adapters[0]);
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.AdaptiveSelection.DecayTime", "100");
+        Ice::CommunicatorHolder ich(initData);
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, ich->stringToProxy(proxy));
+        test = ICE_UNCHECKED_CAST(TestIntfPrx, test->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Adaptive)));
+        for(int i = 0; i < 10; ++i)
+        {
+            test(test->getAdapterName() == "Adapter95");
+        }
+
+        adapters[0] = com->createObjectAdapter("Adapter96", endpoint);
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        while(test->getAdapterName() != "Adapter96")
+        {
+            test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::seconds(10));
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+
+        deactivate(com, adapters);
+    }
+    cout << "ok" << endl;
+
     cout << "testing per request binding with single endpoint... " << flush;
     {
         RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter41", "default");
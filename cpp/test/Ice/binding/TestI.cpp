@@ -77,6 +77,18 @@ RemoteObjectAdapterI::getTestIntf(const Ice::Current&)
     return _testIntf;
 }
 
+void
+RemoteObjectAdapterI::hold(const Ice::Current&)
+{
+    _adapter->hold();
+}
+
+void
+RemoteObjectAdapterI::activate(const Ice::Current&)
+{
+    _adapter->activate();
+}
+
 void
 RemoteObjectAdapterI::deactivate(const Ice::Current& current)
 {
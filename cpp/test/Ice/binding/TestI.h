@@ -40,6 +40,8 @@ public:
     RemoteObjectAdapterI(const Ice::ObjectAdapterPtr&);
     
     virtual Test::TestIntfPrxPtr getTestIntf(const Ice::Current&);
+    virtual void hold(const Ice::Current&);
+    virtual void activate(const Ice::Current&);
     virtual void deactivate(const Ice::Current&);
 
 private:
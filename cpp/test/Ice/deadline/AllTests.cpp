@@ -0,0 +1,118 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Test.h>
+#include <TestI.h>
+
+using namespace std;
+using namespace Test;
+
+TestIntfPrxPtr
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    string ref = "test:" + getTestEndpoint(communicator, 0);
+    TestIntfPrxPtr obj = ICE_CHECKED_CAST(TestIntfPrx, communicator->stringToProxy(ref));
+    test(obj);
+
+    cout << "testing deadline propagation... " << flush;
+    {
+        communicator->getProperties()->setProperty("CallbackAdapter.Endpoints", "tcp -h 127.0.0.1");
+        communicator->getProperties()->setProperty("CallbackAdapter.ThreadPool.Size", "1");
+        communicator->getProperties()->setProperty("CallbackAdapter.ThreadPool.DispatchThreads", "1");
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("CallbackAdapter");
+        adapter->activate();
+        TestIntfPrxPtr deadline = ICE_UNCHECKED_CAST(TestIntfPrx, adapter->addWithUUID(ICE_MAKE_SHARED(TestIntfI)));
+
+        test(obj->getDeadline() == 0);
+        Ice::Long remaining = obj->ice_invocationTimeout(5000)->getDeadline();
+        test(remaining > 0 && remaining <= 5000);
+
+        Ice::Context ctx;
+        ctx["test"] = "1";
+        remaining = obj->ice_invocationTimeout(5000)->getDeadline(ctx);
+        test(remaining > 0 && remaining <= 5000);
+
+        //
+        // The deadline is inherited by the invocations made by the servant,
+        // the server calls back the adapter of the client.
+        //
+        TestIntfPrxPtr callback = deadline->ice_collocationOptimized(false);
+        test(obj->getNestedDeadline(callback) == 0);
+        remaining = obj->ice_invocationTimeout(5000)->getNestedDeadline(callback);
+        test(remaining > 0 && remaining <= 5000);
+
+        //
+        // Same with collocated calls.
+        //
+        remaining = deadline->ice_invocationTimeout(5000)->getNestedDeadline(deadline);
+        test(remaining > 0 && remaining <= 5000);
+
+        //
+        // The remaining time is computed when the request is sent, here once
+        // the connection to the held adapter is established.
+        //
+        {
+            communicator->getProperties()->setProperty("HoldAdapter.Endpoints", "tcp -h 127.0.0.1");
+            Ice::ObjectAdapterPtr held = communicator->createObjectAdapter("HoldAdapter");
+            TestIntfPrxPtr prx = ICE_UNCHECKED_CAST(TestIntfPrx, held->addWithUUID(ICE_MAKE_SHARED(TestIntfI)));
+            prx = prx->ice_collocationOptimized(false)->ice_invocationTimeout(5000);
+#ifdef ICE_CPP11_MAPPING
+            auto f = prx->getDeadlineAsync();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+            held->activate();
+            remaining = f.get();
+#else
+            Ice::AsyncResultPtr r = prx->begin_getDeadline();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(500));
+            held->activate();
+            remaining = prx->end_getDeadline(r);
+#endif
+            test(remaining > 0 && remaining <= 4600);
+            held->destroy();
+        }
+
+        //
+        // A request whose deadline expired while it waited for a dispatch
+        // thread isn't dispatched.
+        //
+        int count = callback->getDeadlineCallCount();
+
+        // Keep the dispatch thread busy.
+#ifdef ICE_CPP11_MAPPING
+        auto f = callback->sleepAsync(500);
+#else
+        Ice::AsyncResultPtr r = callback->begin_sleep(500);
+#endif
+        try
+        {
+            callback->ice_invocationTimeout(100)->getDeadline();
+            test(false);
+        }
+        catch(const Ice::InvocationTimeoutException&)
+        {
+        }
+#ifdef ICE_CPP11_MAPPING
+        f.get();
+#else
+        callback->end_sleep(r);
+#endif
+        test(callback->getDeadlineCallCount() == count);
+
+        remaining = callback->ice_invocationTimeout(1000)->getDeadline();
+        test(remaining > 0 && remaining <= 1000);
+        test(callback->getDeadlineCallCount() == count + 1);
+
+        adapter->destroy();
+    }
+    cout << "ok" << endl;
+
+    return obj;
+}
@@ -0,0 +1,59 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <TestI.h>
+
+using namespace std;
+
+TestIntfI::TestIntfI() : _deadlineCallCount(0)
+{
+}
+
+Ice::Long
+TestIntfI::getDeadline(const Ice::Current& current)
+{
+    test(current.ctx.find("_deadline") == current.ctx.end());
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        ++_deadlineCallCount;
+    }
+    if(current.deadline == 0)
+    {
+        return 0;
+    }
+    return current.deadline - IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+}
+
+Ice::Long
+TestIntfI::getNestedDeadline(ICE_IN(Test::TestIntfPrxPtr) prx, const Ice::Current&)
+{
+    return prx->getDeadline();
+}
+
+Ice::Int
+TestIntfI::getDeadlineCallCount(const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    return _deadlineCallCount;
+}
+
+void
+TestIntfI::sleep(Ice::Int ms, const Ice::Current&)
+{
+    IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(ms));
+}
+
+void
+TestIntfI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
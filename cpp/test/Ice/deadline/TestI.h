@@ -0,0 +1,36 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+class TestIntfI : public virtual Test::TestIntf
+{
+public:
+
+    TestIntfI();
+
+    virtual Ice::Long getDeadline(const Ice::Current&);
+    virtual Ice::Long getNestedDeadline(ICE_IN(Test::TestIntfPrxPtr), const Ice::Current&);
+    virtual Ice::Int getDeadlineCallCount(const Ice::Current&);
+
+    virtual void sleep(Ice::Int, const Ice::Current&);
+
+    virtual void shutdown(const Ice::Current&);
+
+private:
+
+    IceUtil::Mutex _mutex;
+    int _deadlineCallCount;
+};
+
+#endif
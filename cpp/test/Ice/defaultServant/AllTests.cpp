@@ -14,6 +14,62 @@
 using namespace std;
 using namespace Test;
 
+namespace
+{
+
+class LookupThread : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    LookupThread(const Ice::ObjectAdapterPtr& oa, const Ice::ObjectPtr& servant) :
+        _oa(oa), _servant(servant), _done(false)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        Ice::Identity identity;
+        identity.category = "concurrent";
+        int i = 0;
+        while(true)
+        {
+            {
+                Lock sync(*this);
+                if(_done)
+                {
+                    break;
+                }
+            }
+
+            identity.name = "concurrent" + string(1, static_cast<char>('0' + (i++ % 10)));
+            Ice::ObjectPtr r = _oa->find(identity);
+            test(!r || r == _servant);
+            r = _oa->findFacet(identity, "facet");
+            test(!r || r == _servant);
+        }
+    }
+
+    void
+    stop()
+    {
+        {
+            Lock sync(*this);
+            _done = true;
+        }
+        getThreadControl().join();
+    }
+
+private:
+
+    const Ice::ObjectAdapterPtr _oa;
+    const Ice::ObjectPtr _servant;
+    bool _done;
+};
+ICE_DEFINE_PTR(LookupThreadPtr, LookupThread);
+
+}
+
 void
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -157,4 +213,45 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
 
     cout << "ok" << endl;
+
+    cout << "testing concurrent lookups... " << flush;
+    {
+        oa->removeDefaultServant("");
+
+        vector<LookupThreadPtr> threads;
+        for(int i = 0; i < 4; ++i)
+        {
+            threads.push_back(new LookupThread(oa, servant));
+            threads.back()->start();
+        }
+
+        Ice::Identity identity;
+        identity.category = "concurrent";
+        for(int i = 0; i < 2000; ++i)
+        {
+            identity.name = "concurrent" + string(1, static_cast<char>('0' + (i % 10)));
+            oa->add(servant, identity);
+            oa->addFacet(servant, identity, "facet");
+            test(oa->find(identity) == servant);
+            test(oa->findFacet(identity, "facet") == servant);
+            test(oa->findAllFacets(identity).size() == 2);
+            oa->removeFacet(identity, "facet");
+            test(!oa->findFacet(identity, "facet"));
+            if(i % 2)
+            {
+                oa->remove(identity);
+            }
+            else
+            {
+                oa->removeAllFacets(identity);
+            }
+            test(!oa->find(identity));
+        }
+
+        for(vector<LookupThreadPtr>::const_iterator p = threads.begin(); p != threads.end(); ++p)
+        {
+            (*p)->stop();
+        }
+    }
+    cout << "ok" << endl;
 }
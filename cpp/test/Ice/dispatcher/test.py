@@ -0,0 +1,19 @@
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+testsuite = TestSuite(__file__)
+
+#
+# Also run the client/server test with dispatch threads, the messages must
+# still be dispatched by the dispatcher.
+#
+testsuite.addTestCase(ClientServerTestCase("client/server with dispatch threads", props = {
+    "Ice.ThreadPool.Client.DispatchThreads" : 2,
+    "Ice.ThreadPool.Server.DispatchThreads" : 2,
+}))
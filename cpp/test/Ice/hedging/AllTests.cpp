@@ -0,0 +1,69 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Test.h>
+
+using namespace std;
+using namespace Test;
+
+TestIntfPrxPtr
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    //
+    // The connection is established with the first adapter, the hedged
+    // requests are sent to the second adapter.
+    //
+    string ref = "test:" + getTestEndpoint(communicator, 0) + ":" + getTestEndpoint(communicator, 1);
+    Ice::ObjectPrxPtr base = communicator->stringToProxy(ref);
+    TestIntfPrxPtr obj = ICE_CHECKED_CAST(TestIntfPrx,
+                                          base->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Ordered)));
+    test(obj);
+
+    ref = "controller:" + getTestEndpoint(communicator, 2);
+    TestIntfControllerPrxPtr controller = ICE_UNCHECKED_CAST(TestIntfControllerPrx, communicator->stringToProxy(ref));
+
+    cout << "testing hedged invocations... " << flush;
+    {
+        TestIntfPrxPtr hedging = obj->ice_hedgingDelay(50)->ice_invocationTimeout(1000);
+        hedging->ice_ping();
+
+        //
+        // The first adapter doesn't dispatch requests while it's on hold.
+        // The invocations of idempotent operations are completed by their
+        // hedged request sent to the second adapter, the other invocations
+        // time out.
+        //
+        controller->holdAdapter();
+        hedging->ice_ping();
+        test(hedging->ice_id() == TestIntf::ice_staticId());
+        hedging->opIdempotent();
+        try
+        {
+            hedging->op();
+            test(false);
+        }
+        catch(const Ice::InvocationTimeoutException&)
+        {
+        }
+        try
+        {
+            hedging->ice_hedgingDelay(0)->ice_ping();
+            test(false);
+        }
+        catch(const Ice::InvocationTimeoutException&)
+        {
+        }
+        controller->resumeAdapter();
+    }
+    cout << "ok" << endl;
+
+    return obj;
+}
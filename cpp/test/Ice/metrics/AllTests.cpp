@@ -411,6 +411,104 @@ toMap(const IceMX::MetricsMap& mmap)
     return m;
 }
 
+//
+// Observer of the host resolver thread, the thread can be held before
+// it starts a DNS lookup.
+//
+class HostResolverThreadObserverI : public ThreadObserverI
+{
+public:
+
+    HostResolverThreadObserverI() : _hold(false), _lookups(0)
+    {
+        reset();
+    }
+
+    virtual void
+    stateChanged(Ice::Instrumentation::ThreadState oldState, Ice::Instrumentation::ThreadState newState)
+    {
+        ThreadObserverI::stateChanged(oldState, newState);
+        if(newState == Ice::Instrumentation::ICE_ENUM(ThreadState, ThreadStateInUseForOther))
+        {
+            IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+            ++_lookups;
+            _monitor.notifyAll();
+            while(_hold)
+            {
+                _monitor.wait();
+            }
+        }
+    }
+
+    void
+    hold()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _hold = true;
+    }
+
+    void
+    release()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _hold = false;
+        _monitor.notifyAll();
+    }
+
+    void
+    waitForLookups(int lookups)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        while(_lookups < lookups)
+        {
+            _monitor.wait();
+        }
+    }
+
+private:
+
+    IceUtil::Monitor<IceUtil::Mutex> _monitor;
+    bool _hold;
+    int _lookups;
+};
+ICE_DEFINE_PTR(HostResolverThreadObserverIPtr, HostResolverThreadObserverI);
+
+class HostResolverObserverI : public CommunicatorObserverI
+{
+public:
+
+    HostResolverObserverI() : resolverObserver(ICE_MAKE_SHARED(HostResolverThreadObserverI))
+    {
+    }
+
+    virtual Ice::Instrumentation::ThreadObserverPtr
+    getThreadObserver(const string& parent, const string& id, Ice::Instrumentation::ThreadState state,
+                      const Ice::Instrumentation::ThreadObserverPtr& old)
+    {
+        if(id == "Ice.HostResolver")
+        {
+            return resolverObserver;
+        }
+        return CommunicatorObserverI::getThreadObserver(parent, id, state, old);
+    }
+
+    const HostResolverThreadObserverIPtr resolverObserver;
+};
+ICE_DEFINE_PTR(HostResolverObserverIPtr, HostResolverObserverI);
+
+IceMX::HostResolverMetricsPtr
+getHostResolverMetrics(const Ice::CommunicatorPtr& communicator)
+{
+    IceMX::MetricsAdminPtr admin = ICE_DYNAMIC_CAST(IceMX::MetricsAdmin, communicator->findAdminFacet("Metrics"));
+    test(admin);
+    Ice::Long timestamp;
+    IceMX::MetricsView view = admin->getMetricsView("Resolver", timestamp, Ice::emptyCurrent);
+    test(view["HostResolver"].size() == 1);
+    IceMX::HostResolverMetricsPtr m = ICE_DYNAMIC_CAST(IceMX::HostResolverMetrics, view["HostResolver"][0]);
+    test(m && m->id == "HostResolver");
+    return m;
+}
+
 }
 
 MetricsPrxPtr
@@ -546,6 +644,212 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
 
     cout << "ok" << endl;
 
+    cout << "testing buffer pool metrics..." << flush;
+    {
+        //
+        // The BufferPool map provides the statistics of the 13 size
+        // classes of the pool, from 256 bytes to 1MB.
+        //
+        view = clientMetrics->getMetricsView("View", timestamp);
+        test(view["BufferPool"].size() == 13);
+        test(view["BufferPool"][0]->id == "256");
+        test(view["BufferPool"][12]->id == "1048576");
+
+        Ice::Long allocated = 0;
+        for(IceMX::MetricsMap::const_iterator p = view["BufferPool"].begin(); p != view["BufferPool"].end(); ++p)
+        {
+            IceMX::BufferPoolMetricsPtr m = ICE_DYNAMIC_CAST(IceMX::BufferPoolMetrics, *p);
+            test(m && !m->id.empty());
+            test(m->misses <= m->allocated);
+            test(m->cached >= 0);
+            allocated += m->allocated;
+        }
+        test(allocated > 0);
+
+        //
+        // Marshaling a large request allocates blocks from the pool.
+        //
+        metrics->opByteS(Test::ByteSeq(100 * 1024));
+
+        view = clientMetrics->getMetricsView("View", timestamp);
+        Ice::Long allocated2 = 0;
+        for(IceMX::MetricsMap::const_iterator p = view["BufferPool"].begin(); p != view["BufferPool"].end(); ++p)
+        {
+            allocated2 += ICE_DYNAMIC_CAST(IceMX::BufferPoolMetrics, *p)->allocated;
+        }
+        test(allocated2 > allocated);
+
+        if(!collocated)
+        {
+            metrics->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+            waitForCurrent(clientMetrics, "View", "Connection", 0);
+            waitForCurrent(serverMetrics, "View", "Connection", 0);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing host resolver metrics..." << flush;
+
+    view = clientMetrics->getMetricsView("View", timestamp);
+#ifndef ICE_OS_UWP
+    {
+        //
+        // The cache is disabled by default.
+        //
+        test(view["HostResolver"].size() == 1);
+        IceMX::HostResolverMetricsPtr m = ICE_DYNAMIC_CAST(IceMX::HostResolverMetrics, view["HostResolver"][0]);
+        test(m && m->id == "HostResolver");
+        test(m->failedLookups <= m->lookups);
+        test(m->hits == 0 && m->negativeHits == 0 && m->cached == 0 && m->negativeCached == 0);
+    }
+
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties();
+        initData.properties->setProperty("Ice.Admin.Enabled", "1");
+        initData.properties->setProperty("IceMX.Metrics.Resolver.GroupBy", "none");
+        initData.properties->setProperty("Ice.HostResolver.Threads", "1");
+        initData.properties->setProperty("Ice.HostResolver.CacheTTL", "1");
+        initData.properties->setProperty("Ice.HostResolver.NegativeCacheTTL", "60");
+        initData.properties->setProperty("Ice.IPv6", "0");
+        initData.properties->setProperty("Ice.RetryIntervals", "-1");
+        HostResolverObserverIPtr observer = ICE_MAKE_SHARED(HostResolverObserverI);
+        initData.observer = observer;
+        Ice::CommunicatorHolder ich(initData);
+
+        //
+        // Nothing listens on this port, the connection establishment fails
+        // once the host name is resolved.
+        //
+        ostringstream os;
+        os << "test:tcp -h localhost -p " << getTestPort(properties, 2);
+        Ice::ObjectPrxPtr prx = ich->stringToProxy(os.str());
+
+        //
+        // Concurrent lookups of the same host name are coalesced.
+        //
+        observer->resolverObserver->hold();
+        vector<Ice::ObjectPrxPtr> proxies;
+        for(int i = 0; i < 5; ++i)
+        {
+            ostringstream id;
+            id << "coalesced-" << i;
+            proxies.push_back(prx->ice_connectionId(id.str()));
+        }
+#ifdef ICE_CPP11_MAPPING
+        vector<future<shared_ptr<Ice::Connection>>> results;
+#else
+        vector<Ice::AsyncResultPtr> results;
+#endif
+        for(vector<Ice::ObjectPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+        {
+#ifdef ICE_CPP11_MAPPING
+            results.push_back((*p)->ice_getConnectionAsync());
+#else
+            results.push_back((*p)->begin_ice_getConnection());
+#endif
+            if(p == proxies.begin())
+            {
+                observer->resolverObserver->waitForLookups(1);
+            }
+        }
+        for(int i = 0; i < 100 && getHostResolverMetrics(ich.communicator())->coalesced < 4; ++i)
+        {
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        observer->resolverObserver->release();
+        for(size_t i = 0; i < results.size(); ++i)
+        {
+            try
+            {
+#ifdef ICE_CPP11_MAPPING
+                results[i].get();
+#else
+                proxies[i]->end_ice_getConnection(results[i]);
+#endif
+            }
+            catch(const Ice::LocalException&)
+            {
+            }
+        }
+        IceMX::HostResolverMetricsPtr m = getHostResolverMetrics(ich.communicator());
+        test(m->lookups == 1 && m->coalesced == 4 && m->failedLookups == 0);
+        test(m->cached == 1 && m->hits == 0);
+
+        //
+        // The host name is resolved from the cache until the entry expires.
+        //
+        try
+        {
+            prx->ice_connectionId("hit")->ice_getConnection();
+        }
+        catch(const Ice::LocalException&)
+        {
+        }
+        m = getHostResolverMetrics(ich.communicator());
+        test(m->lookups == 1 && m->hits == 1);
+
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1500));
+        try
+        {
+            prx->ice_connectionId("expired")->ice_getConnection();
+        }
+        catch(const Ice::LocalException&)
+        {
+        }
+        m = getHostResolverMetrics(ich.communicator());
+        test(m->lookups == 2 && m->hits == 1 && m->cached == 1);
+
+        //
+        // Failed lookups are cached unless the DNS failure is temporary.
+        //
+        for(int i = 0; i < 2; ++i)
+        {
+            try
+            {
+                ich->stringToProxy("test:tcp -h unknownfoo.zeroc.com -p 10000")->ice_getConnection();
+                test(false);
+            }
+            catch(const Ice::DNSException&)
+            {
+            }
+        }
+        m = getHostResolverMetrics(ich.communicator());
+        test((m->lookups == 3 && m->negativeHits == 1 && m->negativeCached == 1) ||
+             (m->lookups == 4 && m->negativeHits == 0 && m->negativeCached == 0));
+        test(m->failedLookups == m->lookups - 2);
+    }
+#endif
+
+    cout << "ok" << endl;
+
+    if(!collocated)
+    {
+        cout << "testing endpoint load metrics..." << flush;
+
+        view = clientMetrics->getMetricsView("View", timestamp);
+        test(view["EndpointLoad"].empty());
+
+        Ice::ObjectPrxPtr adaptive = metrics->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Adaptive));
+        for(int i = 0; i < 5; ++i)
+        {
+            adaptive->ice_ping();
+        }
+
+        view = clientMetrics->getMetricsView("View", timestamp);
+        test(view["EndpointLoad"].size() == 1);
+        IceMX::EndpointLoadMetricsPtr load = ICE_DYNAMIC_CAST(IceMX::EndpointLoadMetrics, view["EndpointLoad"][0]);
+        test(load && !load->id.empty());
+        test(load->total == 5 && load->current == 0 && load->failures == 0);
+        test(load->latency > 0 && load->cost >= load->latency);
+
+        adaptive->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+        waitForCurrent(clientMetrics, "View", "Connection", 0);
+        waitForCurrent(serverMetrics, "View", "Connection", 0);
+
+        cout << "ok" << endl;
+    }
+
     map<string, IceMX::MetricsPtr> map;
 
     string type;
@@ -1416,11 +1720,70 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
     test(im1->current == 0 && im1->total == 1 && im1->failures == 0 && im1->retry == 0);
     test(im1->remotes.size() == 0);
 
+    metricsBatchOneway->op();
+    metricsBatchOneway->ice_flushBatchRequests();
+
+    map = toMap(clientMetrics->getMetricsView("View", timestamp)["Invocation"]);
+    test(map.size() == 2);
+
+    im1 = ICE_DYNAMIC_CAST(IceMX::InvocationMetrics, map["ice_flushBatchRequests"]);
+    test(im1->current <= 1 && im1->total == 1 && im1->failures == 0);
+    test(im1->batchRequests == 2);
+
     testAttribute(clientMetrics, clientProps, update.get(), "Invocation", "mode", "batch-oneway",
                   InvokeOp(metricsBatchOneway));
 
     cout << "ok" << endl;
 
+#ifndef _WIN32
+    cout << "testing dispatch thread metrics..." << flush;
+    {
+        //
+        // The requests sent to the admin object of a communicator which
+        // uses dispatch threads for its server thread pool are queued to
+        // the dispatch threads, the thread metrics provide the number of
+        // dispatched requests and the time they spent in the queues.
+        //
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Admin.InstanceName", "dispatch");
+        initData.properties->setProperty("Ice.Admin.DelayCreation", "0");
+        initData.properties->setProperty("Ice.Default.CollocationOptimized", "0");
+        initData.properties->setProperty("Ice.ThreadPool.Server.DispatchThreads", "2");
+        initData.properties->setProperty("IceMX.Metrics.Dispatch.Map.Thread.GroupBy", "parent");
+        Ice::CommunicatorHolder ich(initData);
+
+        IceMX::MetricsAdminPrxPtr m = ICE_CHECKED_CAST(IceMX::MetricsAdminPrx, ich->getAdmin(), "Metrics");
+        for(int i = 0; i < 10; ++i)
+        {
+            m->getMetricsView("Dispatch", timestamp);
+        }
+
+        IceMX::ThreadMetricsPtr tm;
+        view = m->getMetricsView("Dispatch", timestamp);
+        for(IceMX::MetricsMap::const_iterator p = view["Thread"].begin(); p != view["Thread"].end(); ++p)
+        {
+            if((*p)->id == "Ice.ThreadPool.Server")
+            {
+                tm = ICE_DYNAMIC_CAST(IceMX::ThreadMetrics, *p);
+            }
+            else
+            {
+                test(ICE_DYNAMIC_CAST(IceMX::ThreadMetrics, *p)->dispatched == 0);
+            }
+        }
+        test(tm);
+
+        //
+        // The checkedCast and the 11 getMetricsView requests were
+        // dispatched by the dispatch threads.
+        //
+        test(tm->dispatched == 12);
+        test(tm->queueWaitTime >= 0);
+    }
+    cout << "ok" << endl;
+#endif
+
     cout << "testing metrics view enable/disable..." << flush;
 
     Ice::StringSeq disabledViews;
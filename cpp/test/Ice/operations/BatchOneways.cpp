@@ -151,6 +151,44 @@ batchOneways(const Test::MyClassPrxPtr& p)
     batch->ice_flushBatchRequests();
     batch->ice_ping();
 
+    if(batch->ice_getConnection())
+    {
+        //
+        // Wait for the dispatch of the 30 requests sent above, the last 3
+        // requests were sent with the explicit flush. The count can also
+        // include requests sent by the previous call of batchOneways so we
+        // also wait for the server to stop dispatching requests.
+        //
+        for(i = 0; i < 500 && count < 30; ++i)
+        {
+            count += p->opByteSOnewayCallCount();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(count >= 30);
+        do
+        {
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(50));
+        }
+        while(p->opByteSOnewayCallCount() > 0);
+
+        //
+        // The batch requests are flushed once the auto-flush delay elapsed,
+        // without an explicit flush.
+        //
+        Test::MyClassPrxPtr delayed = batch->ice_batchAutoFlushDelay(10);
+        test(delayed->ice_getBatchAutoFlushDelay() == 10);
+        delayed->opByteSOneway(bs1);
+        delayed->opByteSOneway(bs1);
+        delayed->opByteSOneway(bs1);
+        count = 0;
+        for(i = 0; i < 500 && count < 3; ++i)
+        {
+            count += p->opByteSOnewayCallCount();
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+        }
+        test(count == 3);
+    }
+
     if(batch->ice_getConnection() &&
        p->ice_getCommunicator()->getProperties()->getProperty("Ice.Default.Protocol") != "bt")
     {
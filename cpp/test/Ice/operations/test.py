@@ -0,0 +1,108 @@
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+import ctypes
+
+testsuite = TestSuite(__file__)
+
+#
+# Also run the client/server test with sharded client and server thread pools.
+#
+testsuite.addTestCase(ClientServerTestCase("client/server with reactors", props = {
+    "Ice.ThreadPool.Client.Reactors" : 2,
+    "Ice.ThreadPool.Server.Reactors" : 3,
+    "Ice.ThreadPool.Server.ReactorWorkStealing" : 1,
+}))
+
+#
+# And with a small read-ahead buffer to exercise messages larger than the
+# read-ahead buffer and messages split over several reads.
+#
+testsuite.addTestCase(ClientServerTestCase("client/server with small read-ahead", props = {
+    "Ice.ReadAheadSize" : 1,
+}))
+
+#
+# And with the LZ4 and Zstandard compression codecs, the test is skipped if
+# the codec library isn't available.
+#
+class CompressionTestCase(ClientServerTestCase):
+
+    def __init__(self, codec):
+        ClientServerTestCase.__init__(self, "client/server with {0} compression".format(codec), props = {
+            "Ice.Override.Compress" : 1,
+            "Ice.Compression.Codecs" : codec,
+            "Ice.Compression.MinSize" : 0,
+        }, server = Server(props = lambda p, c: {
+            "Ice.Trace.Protocol" : 1,
+            "Ice.LogFile" : c.testcase.getLogFile(),
+        }))
+        self.codec = codec
+
+    def canRun(self, current):
+        #
+        # Ice falls back to bzip2 if the codec library can't be loaded.
+        #
+        if isinstance(platform, Windows):
+            library = "lib{0}.dll".format(self.codec)
+        elif isinstance(platform, Darwin):
+            library = "lib{0}.1.dylib".format(self.codec)
+        else:
+            library = "lib{0}.so.1".format(self.codec)
+        try:
+            ctypes.CDLL(library)
+            return True
+        except OSError:
+            return False
+
+    def getLogFile(self):
+        return os.path.join(self.getPath(), "server-{0}.log".format(self.codec))
+
+    def setupServerSide(self, current):
+        if os.path.exists(self.getLogFile()):
+            os.remove(self.getLogFile())
+
+    def teardownServerSide(self, current, success):
+        #
+        # Check with the server protocol trace that the messages were
+        # compressed with the codec and not with bzip2.
+        #
+        try:
+            if success:
+                current.write("checking {0} compression codec... ".format(self.codec))
+                with open(self.getLogFile()) as f:
+                    if f.read().find("compression codec = {0}".format(self.codec)) == -1:
+                        raise RuntimeError("messages weren't compressed with {0}".format(self.codec))
+                current.writeln("ok")
+        finally:
+            if os.path.exists(self.getLogFile()):
+                os.remove(self.getLogFile())
+
+testsuite.addTestCase(CompressionTestCase("lz4"))
+testsuite.addTestCase(CompressionTestCase("zstd"))
+
+#
+# And with dispatch threads, with and without serialization.
+#
+testsuite.addTestCase(ClientServerTestCase("client/server with dispatch threads", props = {
+    "Ice.ThreadPool.Client.DispatchThreads" : 2,
+    "Ice.ThreadPool.Server.DispatchThreads" : 3,
+}))
+testsuite.addTestCase(ClientServerTestCase("client/server with serialized dispatch threads", props = {
+    "Ice.ThreadPool.Server.DispatchThreads" : 3,
+    "Ice.ThreadPool.Server.Serialize" : 1,
+}))
+
+#
+# And with the io_uring selector, the selector falls back to epoll if io_uring
+# isn't supported.
+#
+testsuite.addTestCase(ClientServerTestCase("client/server with io_uring", props = {
+    "Ice.IoUring" : 1,
+}, options = { "protocol" : ["tcp", "ws"] }))
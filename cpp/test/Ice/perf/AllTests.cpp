@@ -0,0 +1,631 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+//
+// Measures the latency and throughput of twoway, oneway, batch oneway,
+// AMI, AMD, collocated and datagram invocations over a sweep of payload
+// sizes, connection counts and server thread pool sizes. The
+// measurements are configured with the following properties:
+//
+// Perf.Iterations       Invocations per measurement (default 1000).
+// Perf.PayloadSizes     Payload sizes in bytes (default 0 1024 65536).
+// Perf.Connections      Connection counts, one client thread per
+//                       connection (default 1 4).
+// Perf.ThreadPoolSizes  Server thread pool sizes, must also be set for
+//                       the server (default 1).
+// Perf.Output           Write the results as JSON to the given file, or
+//                       to the standard output with "-".
+//
+// The latencies are in microseconds.
+//
+
+#include <Ice/Ice.h>
+#include <IceUtil/Thread.h>
+#include <TestCommon.h>
+#include <TestI.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+//
+// A histogram with logarithmic buckets, each power of two range is
+// divided in 32 linear sub-buckets which gives a precision of about 3%
+// for the recorded values.
+//
+class Histogram
+{
+public:
+
+    Histogram() : _counts(SubBuckets * 60, 0), _count(0), _sum(0), _max(0)
+    {
+    }
+
+    void
+    record(Ice::Long value)
+    {
+        if(value < 0)
+        {
+            value = 0;
+        }
+        ++_counts[index(value)];
+        ++_count;
+        _sum += value;
+        _max = std::max(_max, value);
+    }
+
+    void
+    merge(const Histogram& other)
+    {
+        for(size_t i = 0; i < _counts.size(); ++i)
+        {
+            _counts[i] += other._counts[i];
+        }
+        _count += other._count;
+        _sum += other._sum;
+        _max = std::max(_max, other._max);
+    }
+
+    Ice::Long
+    count() const
+    {
+        return _count;
+    }
+
+    double
+    mean() const
+    {
+        return _count > 0 ? static_cast<double>(_sum) / static_cast<double>(_count) : 0.0;
+    }
+
+    Ice::Long
+    max() const
+    {
+        return _max;
+    }
+
+    //
+    // Returns the highest value of the bucket containing the given
+    // percentile.
+    //
+    Ice::Long
+    percentile(double p) const
+    {
+        Ice::Long target = static_cast<Ice::Long>(static_cast<double>(_count) * p / 100.0 + 0.5);
+        if(target < 1)
+        {
+            target = 1;
+        }
+        Ice::Long total = 0;
+        for(size_t i = 0; i < _counts.size(); ++i)
+        {
+            total += _counts[i];
+            if(total >= target)
+            {
+                return std::min(highestValue(i), _max);
+            }
+        }
+        return _max;
+    }
+
+private:
+
+    enum
+    {
+        SubBucketBits = 5,
+        SubBuckets = 1 << SubBucketBits
+    };
+
+    static size_t
+    index(Ice::Long value)
+    {
+        if(value < SubBuckets)
+        {
+            return static_cast<size_t>(value);
+        }
+        int exponent = 0;
+        while((value >> exponent) >= 2 * SubBuckets)
+        {
+            ++exponent;
+        }
+        return static_cast<size_t>((exponent + 1) * SubBuckets + (value >> exponent) - SubBuckets);
+    }
+
+    static Ice::Long
+    highestValue(size_t index)
+    {
+        if(index < SubBuckets)
+        {
+            return static_cast<Ice::Long>(index);
+        }
+        int exponent = static_cast<int>(index / SubBuckets) - 1;
+        Ice::Long subBucket = static_cast<Ice::Long>(index % SubBuckets) + SubBuckets;
+        return ((subBucket + 1) << exponent) - 1;
+    }
+
+    vector<Ice::Long> _counts;
+    Ice::Long _count;
+    Ice::Long _sum;
+    Ice::Long _max;
+};
+
+struct Result
+{
+    string test;
+    string transport;
+    int payload;
+    int connections;
+    int threadPoolSize;
+    Ice::Long requests;
+    double throughput; // Requests per second.
+    Histogram latency;
+};
+
+typedef void (*Invoke)(const Test::PerfPrxPtr&, const Test::ByteSeq&);
+
+const int batchSize = 100;
+
+void
+sendBytes(const Test::PerfPrxPtr& perf, const Test::ByteSeq& seq)
+{
+    perf->sendBytes(seq);
+}
+
+void
+sendBytesAMD(const Test::PerfPrxPtr& perf, const Test::ByteSeq& seq)
+{
+    perf->sendBytesAMD(seq);
+}
+
+void
+sendBytesAMI(const Test::PerfPrxPtr& perf, const Test::ByteSeq& seq)
+{
+#ifdef ICE_CPP11_MAPPING
+    perf->sendBytesAsync(seq).get();
+#else
+    perf->end_sendBytes(perf->begin_sendBytes(seq));
+#endif
+}
+
+void
+sendBytesBatch(const Test::PerfPrxPtr& perf, const Test::ByteSeq& seq)
+{
+    for(int i = 0; i < batchSize; ++i)
+    {
+        perf->sendBytes(seq);
+    }
+    perf->ice_flushBatchRequests();
+}
+
+class Window : public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    Window(int size) : _size(size), _outstanding(0)
+    {
+    }
+
+    void
+    acquire()
+    {
+        Lock sync(*this);
+        while(_outstanding >= _size)
+        {
+            wait();
+        }
+        ++_outstanding;
+    }
+
+    void
+    release()
+    {
+        Lock sync(*this);
+        if(_outstanding-- == _size || _outstanding == 0)
+        {
+            notifyAll();
+        }
+    }
+
+    void
+    waitForCompletion()
+    {
+        Lock sync(*this);
+        while(_outstanding > 0)
+        {
+            wait();
+        }
+    }
+
+private:
+
+    const int _size;
+    int _outstanding;
+};
+
+#ifndef ICE_CPP11_MAPPING
+class Callback : public IceUtil::Shared
+{
+public:
+
+    Callback(Window& window) : _window(window)
+    {
+    }
+
+    void
+    response()
+    {
+        _window.release();
+    }
+
+    void
+    exception(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        test(false);
+    }
+
+private:
+
+    Window& _window;
+};
+typedef IceUtil::Handle<Callback> CallbackPtr;
+#endif
+
+class InvocationThread : public IceUtil::Thread
+{
+public:
+
+    InvocationThread(const Test::PerfPrxPtr& perf, const Test::ByteSeq& seq, int iterations) :
+        _perf(perf), _seq(seq), _iterations(iterations)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        for(int i = 0; i < _iterations; ++i)
+        {
+            IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            _perf->sendBytes(_seq);
+            _latency.record((IceUtil::Time::now(IceUtil::Time::Monotonic) - start).toMicroSeconds());
+        }
+    }
+
+    const Histogram&
+    latency() const
+    {
+        return _latency;
+    }
+
+private:
+
+    const Test::PerfPrxPtr _perf;
+    const Test::ByteSeq _seq;
+    const int _iterations;
+    Histogram _latency;
+};
+typedef IceUtil::Handle<InvocationThread> InvocationThreadPtr;
+
+vector<int>
+getIntList(const Ice::PropertiesPtr& properties, const string& name, const string& defaultValue)
+{
+    Ice::StringSeq values = properties->getPropertyAsList(name);
+    vector<int> result;
+    if(values.empty())
+    {
+        istringstream is(defaultValue);
+        int value;
+        while(is >> value)
+        {
+            result.push_back(value);
+        }
+    }
+    for(Ice::StringSeq::const_iterator p = values.begin(); p != values.end(); ++p)
+    {
+        result.push_back(atoi(p->c_str()));
+    }
+    return result;
+}
+
+Result
+measure(const string& test, const string& transport, Invoke invoke, const Test::PerfPrxPtr& perf,
+        const Test::PerfPrxPtr& sync, int payload, int iterations, int requestsPerCall = 1)
+{
+    Test::ByteSeq seq(static_cast<size_t>(payload), Ice::Byte(0));
+
+    for(int i = 0; i < iterations / 10; ++i)
+    {
+        invoke(perf, seq);
+    }
+    if(sync)
+    {
+        sync->ice_ping();
+    }
+
+    Result result;
+    result.test = test;
+    result.transport = transport;
+    result.payload = payload;
+    result.connections = 1;
+    result.threadPoolSize = 0;
+    result.requests = static_cast<Ice::Long>(iterations) * requestsPerCall;
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < iterations; ++i)
+    {
+        IceUtil::Time t = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        invoke(perf, seq);
+        result.latency.record((IceUtil::Time::now(IceUtil::Time::Monotonic) - t).toMicroSeconds());
+    }
+    if(sync)
+    {
+        //
+        // Oneway and batch oneway requests are only sent, wait for the
+        // server to receive them.
+        //
+        sync->ice_ping();
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    result.throughput = static_cast<double>(result.requests) / elapsed.toSecondsDouble();
+    return result;
+}
+
+Result
+measurePipelined(const string& transport, const Test::PerfPrxPtr& perf, int payload, int iterations, int window)
+{
+    Test::ByteSeq seq(static_cast<size_t>(payload), Ice::Byte(0));
+    Window w(window);
+#ifndef ICE_CPP11_MAPPING
+    CallbackPtr cb = new Callback(w);
+    Test::Callback_Perf_sendBytesPtr callback = Test::newCallback_Perf_sendBytes(cb, &Callback::response,
+                                                                                 &Callback::exception);
+#endif
+
+    Result result;
+    result.test = "ami-pipelined";
+    result.transport = transport;
+    result.payload = payload;
+    result.connections = 1;
+    result.threadPoolSize = 0;
+    result.requests = iterations;
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < iterations; ++i)
+    {
+        w.acquire();
+#ifdef ICE_CPP11_MAPPING
+        perf->sendBytesAsync(seq,
+                             [&w]() { w.release(); },
+                             [](exception_ptr ex)
+                             {
+                                 try
+                                 {
+                                     rethrow_exception(ex);
+                                 }
+                                 catch(const Ice::Exception& e)
+                                 {
+                                     cerr << e << endl;
+                                 }
+                                 test(false);
+                             });
+#else
+        perf->begin_sendBytes(seq, callback);
+#endif
+    }
+    w.waitForCompletion();
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    result.throughput = static_cast<double>(iterations) / elapsed.toSecondsDouble();
+    return result;
+}
+
+Result
+measureConcurrent(const string& test, const string& transport, const Test::PerfPrxPtr& perf, int payload,
+                  int iterations, int connections, int threadPoolSize)
+{
+    Test::ByteSeq seq(static_cast<size_t>(payload), Ice::Byte(0));
+
+    vector<InvocationThreadPtr> threads;
+    for(int i = 0; i < connections; ++i)
+    {
+        ostringstream os;
+        os << "perf-" << i;
+        Test::PerfPrxPtr proxy = perf->ice_connectionId(os.str());
+        proxy->ice_ping();
+        threads.push_back(new InvocationThread(proxy, seq, iterations));
+    }
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    vector<IceUtil::ThreadControl> controls;
+    for(vector<InvocationThreadPtr>::const_iterator p = threads.begin(); p != threads.end(); ++p)
+    {
+        controls.push_back((*p)->start());
+    }
+    for(vector<IceUtil::ThreadControl>::iterator p = controls.begin(); p != controls.end(); ++p)
+    {
+        p->join();
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+    Result result;
+    result.test = test;
+    result.transport = transport;
+    result.payload = payload;
+    result.connections = connections;
+    result.threadPoolSize = threadPoolSize;
+    result.requests = static_cast<Ice::Long>(iterations) * connections;
+    result.throughput = static_cast<double>(result.requests) / elapsed.toSecondsDouble();
+    for(vector<InvocationThreadPtr>::const_iterator p = threads.begin(); p != threads.end(); ++p)
+    {
+        result.latency.merge((*p)->latency());
+    }
+    return result;
+}
+
+void
+print(const Result& result)
+{
+    cout << "  " << left << setw(14) << result.test << setw(5) << result.transport << right
+         << setw(8) << result.payload << "B";
+    if(result.connections > 1)
+    {
+        cout << " x" << result.connections;
+    }
+    if(result.threadPoolSize > 0)
+    {
+        cout << " (server threads: " << result.threadPoolSize << ")";
+    }
+    cout << ": " << fixed << setprecision(0) << result.throughput << " req/s";
+    if(result.latency.count() > 0)
+    {
+        cout << ", p50 " << result.latency.percentile(50) << "us p99 " << result.latency.percentile(99)
+             << "us p99.9 " << result.latency.percentile(99.9) << "us";
+    }
+    cout << endl;
+}
+
+void
+writeJSON(ostream& out, const string& protocol, int iterations, const vector<Result>& results)
+{
+    out << "{\n";
+    out << "  \"version\": \"" << ICE_STRING_VERSION << "\",\n";
+#ifdef ICE_CPP11_MAPPING
+    out << "  \"mapping\": \"cpp11\",\n";
+#else
+    out << "  \"mapping\": \"cpp98\",\n";
+#endif
+    out << "  \"protocol\": \"" << protocol << "\",\n";
+    out << "  \"iterations\": " << iterations << ",\n";
+    out << "  \"results\": [";
+    for(vector<Result>::const_iterator p = results.begin(); p != results.end(); ++p)
+    {
+        out << (p == results.begin() ? "\n" : ",\n");
+        out << "    { \"test\": \"" << p->test << "\", \"transport\": \"" << p->transport << "\", "
+            << "\"payload\": " << p->payload << ", \"connections\": " << p->connections << ", "
+            << "\"threadPoolSize\": " << p->threadPoolSize << ", \"requests\": " << p->requests << ", "
+            << "\"throughput\": " << fixed << setprecision(1) << p->throughput;
+        if(p->latency.count() > 0)
+        {
+            out << ", \"latency\": { \"count\": " << p->latency.count()
+                << ", \"mean\": " << setprecision(1) << p->latency.mean()
+                << ", \"p50\": " << p->latency.percentile(50)
+                << ", \"p90\": " << p->latency.percentile(90)
+                << ", \"p99\": " << p->latency.percentile(99)
+                << ", \"p99.9\": " << p->latency.percentile(99.9)
+                << ", \"max\": " << p->latency.max() << " }";
+        }
+        out << " }";
+    }
+    out << "\n  ]\n}" << endl;
+}
+
+}
+
+Test::PerfPrxPtr
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    Ice::PropertiesPtr properties = communicator->getProperties();
+    const string protocol = getTestProtocol(properties);
+    const int iterations = properties->getPropertyAsIntWithDefault("Perf.Iterations", 1000);
+    const vector<int> payloads = getIntList(properties, "Perf.PayloadSizes", "0 1024 65536");
+    const vector<int> connections = getIntList(properties, "Perf.Connections", "1 4");
+    const vector<int> threadPoolSizes = getIntList(properties, "Perf.ThreadPoolSizes", "1");
+    test(iterations > 0);
+
+    Test::PerfPrxPtr perf = ICE_CHECKED_CAST(Test::PerfPrx,
+                                             communicator->stringToProxy("perf:" + getTestEndpoint(communicator, 0)));
+    test(perf);
+
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+    Test::PerfPrxPtr collocated = ICE_UNCHECKED_CAST(Test::PerfPrx, adapter->add(ICE_MAKE_SHARED(PerfI),
+                                                                                Ice::stringToIdentity("perf")));
+
+    vector<Result> results;
+
+    cout << "measuring invocations with " << iterations << " iterations... " << endl;
+    for(vector<int>::const_iterator p = payloads.begin(); p != payloads.end(); ++p)
+    {
+        results.push_back(measure("twoway", protocol, sendBytes, perf, 0, *p, iterations));
+        results.push_back(measure("oneway", protocol, sendBytes, perf->ice_oneway(), perf, *p, iterations));
+        results.push_back(measure("batch-oneway", protocol, sendBytesBatch, perf->ice_batchOneway(), perf, *p,
+                                  max(iterations / batchSize, 1), batchSize));
+        results.push_back(measure("ami", protocol, sendBytesAMI, perf, 0, *p, iterations));
+        results.push_back(measurePipelined(protocol, perf, *p, iterations, 100));
+        results.push_back(measure("amd", protocol, sendBytesAMD, perf, 0, *p, iterations));
+        results.push_back(measure("collocated", "none", sendBytes, collocated, 0, *p, iterations));
+    }
+    for(vector<Result>::const_iterator p = results.begin(); p != results.end(); ++p)
+    {
+        print(*p);
+    }
+
+    //
+    // Datagrams are limited to 64KB.
+    //
+    cout << "measuring datagram invocations... " << endl;
+    Test::PerfPrxPtr datagram = ICE_UNCHECKED_CAST(Test::PerfPrx, communicator->stringToProxy(
+                                                       "perf:" + getTestEndpoint(communicator, 0, "udp")))->ice_datagram();
+    for(vector<int>::const_iterator p = payloads.begin(); p != payloads.end(); ++p)
+    {
+        if(*p <= 8192)
+        {
+            results.push_back(measure("oneway", "udp", sendBytes, datagram, perf, *p, iterations));
+            print(results.back());
+        }
+    }
+
+    cout << "measuring concurrent invocations... " << endl;
+    for(vector<int>::const_iterator p = payloads.begin(); p != payloads.end(); ++p)
+    {
+        for(vector<int>::const_iterator q = connections.begin(); q != connections.end(); ++q)
+        {
+            results.push_back(measureConcurrent("twoway", protocol, perf, *p, iterations, *q, 0));
+            print(results.back());
+        }
+    }
+
+    cout << "measuring invocations with server thread pool sizes... " << endl;
+    const int maxConnections = connections.empty() ? 1 : *max_element(connections.begin(), connections.end());
+    for(size_t i = 0; i < threadPoolSizes.size(); ++i)
+    {
+        Test::PerfPrxPtr proxy = ICE_UNCHECKED_CAST(Test::PerfPrx, communicator->stringToProxy(
+                                                        "perf:" + getTestEndpoint(communicator,
+                                                                                  static_cast<int>(i) + 1)));
+        for(vector<int>::const_iterator p = payloads.begin(); p != payloads.end(); ++p)
+        {
+            results.push_back(measureConcurrent("twoway", protocol, proxy, *p, iterations, maxConnections,
+                                                threadPoolSizes[i]));
+            print(results.back());
+        }
+    }
+
+    const string output = properties->getProperty("Perf.Output");
+    if(output == "-")
+    {
+        writeJSON(cout, protocol, iterations, results);
+    }
+    else if(!output.empty())
+    {
+        ofstream out(output.c_str());
+        if(!out)
+        {
+            cerr << "cannot open `" << output << "' for writing" << endl;
+            test(false);
+        }
+        writeJSON(out, protocol, iterations, results);
+        cout << "results written to `" << output << "'" << endl;
+    }
+
+    adapter->destroy();
+    return perf;
+}
@@ -0,0 +1,189 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+//
+// Measures the cost of the operation dispatch of interfaces with 8, 32
+// and 128 operations, with the switch generated by slice2cpp and with
+// the binary search of the operation names enabled by the
+// cpp:dispatch:binary-search metadata. A dispatch interceptor
+// dispatches each request many times to the servant, the measured time
+// includes the upcall and the marshaling of the (empty) response.
+//
+// Usage: dispatch [dispatches]
+//
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Operations.h>
+
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+//
+// The operations of the Ops128 interface, Ops8 and Ops32 provide the
+// first 8 and 32 operations.
+//
+#define OPERATIONS(OP) \
+    OP(getName) OP(setValue) OP(addItem) OP(removeEntry) \
+    OP(findObject) OP(listAdapter) OP(updateSession) OP(createProperty) \
+    OP(destroyName) OP(notifyValue) OP(registerItem) OP(unregisterEntry) \
+    OP(queryObject) OP(lookupAdapter) OP(validateSession) OP(flushProperty) \
+    OP(getValue) OP(setItem) OP(addEntry) OP(removeObject) \
+    OP(findAdapter) OP(listSession) OP(updateProperty) OP(createName) \
+    OP(destroyValue) OP(notifyItem) OP(registerEntry) OP(unregisterObject) \
+    OP(queryAdapter) OP(lookupSession) OP(validateProperty) OP(flushName) \
+    OP(getItem) OP(setEntry) OP(addObject) OP(removeAdapter) \
+    OP(findSession) OP(listProperty) OP(updateName) OP(createValue) \
+    OP(destroyItem) OP(notifyEntry) OP(registerObject) OP(unregisterAdapter) \
+    OP(querySession) OP(lookupProperty) OP(validateName) OP(flushValue) \
+    OP(getEntry) OP(setObject) OP(addAdapter) OP(removeSession) \
+    OP(findProperty) OP(listName) OP(updateValue) OP(createItem) \
+    OP(destroyEntry) OP(notifyObject) OP(registerAdapter) OP(unregisterSession) \
+    OP(queryProperty) OP(lookupName) OP(validateValue) OP(flushItem) \
+    OP(getObject) OP(setAdapter) OP(addSession) OP(removeProperty) \
+    OP(findName) OP(listValue) OP(updateItem) OP(createEntry) \
+    OP(destroyObject) OP(notifyAdapter) OP(registerSession) OP(unregisterProperty) \
+    OP(queryName) OP(lookupValue) OP(validateItem) OP(flushEntry) \
+    OP(getAdapter) OP(setSession) OP(addProperty) OP(removeName) \
+    OP(findValue) OP(listItem) OP(updateEntry) OP(createObject) \
+    OP(destroyAdapter) OP(notifySession) OP(registerProperty) OP(unregisterName) \
+    OP(queryValue) OP(lookupItem) OP(validateEntry) OP(flushObject) \
+    OP(getSession) OP(setProperty) OP(addName) OP(removeValue) \
+    OP(findItem) OP(listEntry) OP(updateObject) OP(createAdapter) \
+    OP(destroySession) OP(notifyProperty) OP(registerName) OP(unregisterValue) \
+    OP(queryItem) OP(lookupEntry) OP(validateObject) OP(flushAdapter) \
+    OP(getProperty) OP(setName) OP(addValue) OP(removeItem) \
+    OP(findEntry) OP(listObject) OP(updateAdapter) OP(createSession) \
+    OP(destroyProperty) OP(notifyName) OP(registerValue) OP(unregisterItem) \
+    OP(queryEntry) OP(lookupObject) OP(validateAdapter) OP(flushSession)
+
+template<class T>
+class OpsI : public T
+{
+public:
+
+#define DEFINE_OPERATION(name) virtual void name(const Ice::Current&) {}
+    OPERATIONS(DEFINE_OPERATION)
+#undef DEFINE_OPERATION
+};
+
+class Interceptor : public Ice::DispatchInterceptor
+{
+public:
+
+    Interceptor(const Ice::ObjectPtr& servant) : _servant(servant), _iterations(0), _dispatches(0)
+    {
+    }
+
+    virtual bool
+    dispatch(Ice::Request& request)
+    {
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(int i = 0; i < _iterations; ++i)
+        {
+            _servant->ice_dispatch(request);
+        }
+        _time = _time + (IceUtil::Time::now(IceUtil::Time::Monotonic) - start);
+        _dispatches += _iterations;
+        return _servant->ice_dispatch(request);
+    }
+
+    void
+    reset(int iterations)
+    {
+        _iterations = iterations;
+        _dispatches = 0;
+        _time = IceUtil::Time();
+    }
+
+    double
+    nanoSecondsPerDispatch() const
+    {
+        return _time.toMicroSecondsDouble() * 1000.0 / static_cast<double>(_dispatches);
+    }
+
+private:
+
+    const Ice::ObjectPtr _servant;
+    int _iterations;
+    Ice::Long _dispatches;
+    IceUtil::Time _time;
+};
+ICE_DEFINE_PTR(InterceptorPtr, Interceptor);
+
+double
+dispatch(const Ice::ObjectAdapterPtr& adapter, const Ice::ObjectPtr& servant, size_t operations, int dispatches)
+{
+    InterceptorPtr interceptor = ICE_MAKE_SHARED(Interceptor, servant);
+    Ice::ObjectPrxPtr proxy = adapter->addWithUUID(interceptor);
+
+    vector<string> names;
+#define ADD_OPERATION(name) names.push_back(#name);
+    OPERATIONS(ADD_OPERATION)
+#undef ADD_OPERATION
+    names.resize(operations);
+
+    //
+    // Warm up and then dispatch each operation the same number of times.
+    //
+    vector<Ice::Byte> inParams;
+    vector<Ice::Byte> outParams;
+    interceptor->reset(1000);
+    test(proxy->ice_invoke(names.front(), Ice::ICE_ENUM(OperationMode, Normal), inParams, outParams));
+    interceptor->reset(max(dispatches / static_cast<int>(operations), 1));
+    for(vector<string>::const_iterator p = names.begin(); p != names.end(); ++p)
+    {
+        test(proxy->ice_invoke(*p, Ice::ICE_ENUM(OperationMode, Normal), inParams, outParams));
+    }
+
+    adapter->remove(proxy->ice_getIdentity());
+    return interceptor->nanoSecondsPerDispatch();
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int dispatches = argc > 1 ? atoi(argv[1]) : 1000000;
+    if(dispatches < 1)
+    {
+        cerr << "usage: " << argv[0] << " [dispatches]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        Ice::CommunicatorHolder ich(argc, argv);
+        Ice::ObjectAdapterPtr adapter = ich->createObjectAdapter("");
+
+        cout << "operation dispatch with " << dispatches << " dispatches:" << endl;
+        cout << setw(12) << "operations" << setw(16) << "switch (ns)" << setw(22) << "binary search (ns)" << endl;
+        cout << setw(12) << 8 << fixed << setprecision(1)
+             << setw(16) << dispatch(adapter, ICE_MAKE_SHARED(OpsI<Test::Ops8>), 8, dispatches)
+             << setw(22) << dispatch(adapter, ICE_MAKE_SHARED(OpsI<Test::Ops8BinarySearch>), 8, dispatches) << endl;
+        cout << setw(12) << 32 << fixed << setprecision(1)
+             << setw(16) << dispatch(adapter, ICE_MAKE_SHARED(OpsI<Test::Ops32>), 32, dispatches)
+             << setw(22) << dispatch(adapter, ICE_MAKE_SHARED(OpsI<Test::Ops32BinarySearch>), 32, dispatches) << endl;
+        cout << setw(12) << 128 << fixed << setprecision(1)
+             << setw(16) << dispatch(adapter, ICE_MAKE_SHARED(OpsI<Test::Ops128>), 128, dispatches)
+             << setw(22) << dispatch(adapter, ICE_MAKE_SHARED(OpsI<Test::Ops128BinarySearch>), 128, dispatches)
+             << endl;
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
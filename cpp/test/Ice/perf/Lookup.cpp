@@ -0,0 +1,193 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+//
+// Measures the throughput of concurrent servant lookups with 1 to 64
+// threads, with and without a thread concurrently adding and removing
+// servants. Lookups use the object adapter find() operation, which
+// performs the same servant manager lookup as the dispatch of a request.
+//
+// Usage: lookup [iterations] [servants]
+//
+
+#include <Ice/Ice.h>
+#include <IceUtil/Thread.h>
+#include <TestCommon.h>
+#include <TestI.h>
+
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+class LookupThread : public IceUtil::Thread
+{
+public:
+
+    LookupThread(const Ice::ObjectAdapterPtr& adapter, int iterations, int servants, int seed) :
+        _adapter(adapter), _iterations(iterations), _servants(servants), _seed(seed)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        Ice::Identity ident;
+        ident.category = "servant";
+        vector<string> names;
+        for(int i = 0; i < _servants; ++i)
+        {
+            ostringstream os;
+            os << i;
+            names.push_back(os.str());
+        }
+
+        for(int i = 0; i < _iterations; ++i)
+        {
+            ident.name = names[(_seed + i) % _servants];
+            test(_adapter->find(ident));
+        }
+    }
+
+private:
+
+    const Ice::ObjectAdapterPtr _adapter;
+    const int _iterations;
+    const int _servants;
+    const int _seed;
+};
+
+class UpdateThread : public IceUtil::Thread, public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    UpdateThread(const Ice::ObjectAdapterPtr& adapter) :
+        _adapter(adapter), _done(false), _updates(0)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        Ice::ObjectPtr servant = ICE_MAKE_SHARED(PerfI);
+        Ice::Identity ident;
+        ident.category = "update";
+        ident.name = "servant";
+        while(true)
+        {
+            {
+                Lock sync(*this);
+                if(_done)
+                {
+                    break;
+                }
+            }
+            _adapter->add(servant, ident);
+            _adapter->remove(ident);
+            ++_updates;
+        }
+    }
+
+    int
+    stop()
+    {
+        {
+            Lock sync(*this);
+            _done = true;
+        }
+        getThreadControl().join();
+        return _updates;
+    }
+
+private:
+
+    const Ice::ObjectAdapterPtr _adapter;
+    bool _done;
+    int _updates;
+};
+typedef IceUtil::Handle<UpdateThread> UpdateThreadPtr;
+
+double
+lookups(const Ice::ObjectAdapterPtr& adapter, int threads, int iterations, int servants, bool updates)
+{
+    UpdateThreadPtr updater;
+    if(updates)
+    {
+        updater = new UpdateThread(adapter);
+        updater->start();
+    }
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    vector<IceUtil::ThreadControl> controls;
+    for(int i = 0; i < threads; ++i)
+    {
+        IceUtil::ThreadPtr thread = new LookupThread(adapter, iterations, servants, i * 7919);
+        controls.push_back(thread->start());
+    }
+    for(vector<IceUtil::ThreadControl>::iterator p = controls.begin(); p != controls.end(); ++p)
+    {
+        p->join();
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+    if(updater)
+    {
+        updater->stop();
+    }
+    return static_cast<double>(threads) * iterations / elapsed.toSecondsDouble();
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int iterations = argc > 1 ? atoi(argv[1]) : 200000;
+    int servants = argc > 2 ? atoi(argv[2]) : 1000;
+    if(iterations < 1 || servants < 1)
+    {
+        cerr << "usage: " << argv[0] << " [iterations] [servants]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        Ice::CommunicatorHolder ich(argc, argv);
+        Ice::ObjectAdapterPtr adapter = ich->createObjectAdapter("");
+
+        Ice::ObjectPtr servant = ICE_MAKE_SHARED(PerfI);
+        Ice::Identity ident;
+        ident.category = "servant";
+        for(int i = 0; i < servants; ++i)
+        {
+            ostringstream os;
+            os << i;
+            ident.name = os.str();
+            adapter->add(servant, ident);
+        }
+
+        cout << "servant lookups with " << servants << " servants and " << iterations << " lookups per thread:"
+             << endl;
+        cout << setw(8) << "threads" << setw(16) << "lookups/s" << setw(24) << "lookups/s (updates)" << endl;
+        for(int threads = 1; threads <= 64; threads *= 2)
+        {
+            cout << setw(8) << threads << fixed << setprecision(0)
+                 << setw(16) << lookups(adapter, threads, iterations, servants, false)
+                 << setw(24) << lookups(adapter, threads, iterations, servants, true) << endl;
+        }
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,28 @@
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+$(test)_programs          = client server dispatch throughput marshal overload pipeline lookup timer
+
+$(test)_client_sources    = Test.ice Client.cpp AllTests.cpp TestI.cpp
+
+$(test)_dispatch_sources  = Dispatch.cpp Operations.ice
+
+$(test)_throughput_sources = Throughput.cpp Test.ice TestI.cpp
+
+$(test)_marshal_sources   = Marshal.cpp Structs.ice
+
+$(test)_overload_sources  = Overload.cpp Service.ice
+
+$(test)_pipeline_sources  = Pipeline.cpp Test.ice TestI.cpp
+
+$(test)_lookup_sources    = Lookup.cpp Test.ice TestI.cpp
+
+$(test)_timer_sources     = Timer.cpp
+
+tests += $(test)
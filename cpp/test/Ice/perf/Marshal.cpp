@@ -0,0 +1,112 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+//
+// Measures the marshaling and unmarshaling of sequences of fixed-size
+// structs with the streams. Sequences of Sample are copied with a single
+// memcpy, they're also marshaled member by member with the generic
+// sequence helper for comparison. Sequences of Point have padding and
+// are always marshaled member by member.
+//
+// Usage: marshal [elements] [iterations]
+//
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Structs.h>
+
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+template<typename T, Ice::StreamHelperCategory st>
+void
+measure(const Ice::CommunicatorPtr& communicator, const vector<T>& seq, int iterations, double& writeTime,
+        double& readTime)
+{
+    vector<Ice::Byte> data;
+    vector<T> result;
+
+    IceUtil::Time writeElapsed;
+    IceUtil::Time readElapsed;
+    for(int i = 0; i < iterations; ++i)
+    {
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        Ice::OutputStream out(communicator);
+        Ice::StreamSequenceHelper<T, st>::write(&out, &seq[0], &seq[0] + seq.size());
+        out.finished(data);
+        writeElapsed += IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+        start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        Ice::InputStream in(communicator, data);
+        Ice::StreamSequenceHelper<T, st>::read(&in, result);
+        readElapsed += IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+        test(result.size() == seq.size());
+    }
+    writeTime = writeElapsed.toMilliSecondsDouble() / iterations;
+    readTime = readElapsed.toMilliSecondsDouble() / iterations;
+}
+
+template<typename T, Ice::StreamHelperCategory st>
+void
+print(const Ice::CommunicatorPtr& communicator, const string& name, const vector<T>& seq, int iterations)
+{
+    double writeTime;
+    double readTime;
+    measure<T, st>(communicator, seq, iterations, writeTime, readTime);
+    cout << setw(26) << name << fixed << setprecision(2) << setw(14) << writeTime << setw(14) << readTime << endl;
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int elements = argc > 1 ? atoi(argv[1]) : 1000000;
+    int iterations = argc > 2 ? atoi(argv[2]) : 20;
+    if(elements < 1 || iterations < 1)
+    {
+        cerr << "usage: " << argv[0] << " [elements] [iterations]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        Ice::CommunicatorHolder ich(argc, argv);
+
+        Test::SampleSeq samples(elements);
+        Test::PointSeq points(elements);
+        for(int i = 0; i < elements; ++i)
+        {
+            samples[i].x = points[i].x = i * 0.5;
+            samples[i].y = points[i].y = i * 2.0;
+            samples[i].id = points[i].id = i;
+            samples[i].flags = i % 7;
+        }
+
+        cout << "marshaling of " << elements << " elements sequences, average of " << iterations << " iterations:"
+             << endl;
+        cout << setw(26) << "sequence" << setw(14) << "write (ms)" << setw(14) << "read (ms)" << endl;
+        print<Test::Sample, Ice::StreamableTraits<Test::Sample>::helper>(ich.communicator(), "Sample (packed)", samples,
+                                                                         iterations);
+        print<Test::Sample, Ice::StreamHelperCategoryStruct>(ich.communicator(), "Sample (member by member)",
+                                                             samples, iterations);
+        print<Test::Point, Ice::StreamableTraits<Test::Point>::helper>(ich.communicator(), "Point (padded)", points,
+                                                                       iterations);
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
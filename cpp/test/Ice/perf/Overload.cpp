@@ -0,0 +1,282 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+//
+// Measures the behavior of an overloaded object adapter with and without
+// admission control. The client and the server run in the same process
+// with separate communicators. The server has 2 dispatch threads and each
+// request takes 1ms, the client sends requests at twice this rate with
+// asynchronous invocations for the given number of seconds.
+//
+// For each configuration, the benchmark reports the rate of the successful,
+// rejected and timed out requests, and the latency percentiles of the
+// successful requests. The rates include the requests still queued when the
+// client stops sending. Without admission control, the requests wait longer
+// and longer in the dispatch queue.
+//
+// Usage: overload [seconds] [properties]
+//
+// The properties are used by both communicators.
+//
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Service.h>
+
+#include <algorithm>
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+const int dispatchThreads = 2;
+const int workTime = 1; // ms
+
+class ServiceI : public Test::Service
+{
+public:
+
+    virtual void
+    work(int ms, const Ice::Current&)
+    {
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(ms));
+    }
+};
+
+class Results : public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    Results() : _pending(0), _rejected(0), _timeouts(0)
+    {
+    }
+
+    void
+    sent()
+    {
+        Lock sync(*this);
+        ++_pending;
+    }
+
+    void
+    completed(const IceUtil::Time& start, const Ice::Exception* ex)
+    {
+        IceUtil::Time latency = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+        Lock sync(*this);
+        if(!ex)
+        {
+            _latencies.push_back(latency.toMilliSecondsDouble());
+        }
+        else if(dynamic_cast<const Ice::UnknownLocalException*>(ex))
+        {
+            ++_rejected;
+        }
+        else if(dynamic_cast<const Ice::InvocationTimeoutException*>(ex))
+        {
+            ++_timeouts;
+        }
+        else
+        {
+            cerr << *ex << endl;
+            test(false);
+        }
+
+        if(--_pending == 0)
+        {
+            notifyAll();
+        }
+    }
+
+    void
+    print(const string& name, int seconds)
+    {
+        Lock sync(*this);
+        while(_pending > 0)
+        {
+            wait();
+        }
+
+        sort(_latencies.begin(), _latencies.end());
+        double p50 = _latencies.empty() ? 0.0 : _latencies[_latencies.size() / 2];
+        double p99 = _latencies.empty() ? 0.0 : _latencies[_latencies.size() * 99 / 100];
+        cout << left << setw(32) << name << right << fixed << setprecision(1)
+             << setw(10) << static_cast<double>(_latencies.size()) / seconds
+             << setw(10) << static_cast<double>(_rejected) / seconds
+             << setw(10) << static_cast<double>(_timeouts) / seconds
+             << setw(10) << p50
+             << setw(10) << p99 << endl;
+    }
+
+private:
+
+    int _pending;
+    vector<double> _latencies;
+    int _rejected;
+    int _timeouts;
+};
+
+#ifndef ICE_CPP11_MAPPING
+class Cookie : public Ice::LocalObject
+{
+public:
+
+    Cookie(const IceUtil::Time& start) : start(start)
+    {
+    }
+
+    const IceUtil::Time start;
+};
+typedef IceUtil::Handle<Cookie> CookiePtr;
+
+class Callback : public IceUtil::Shared
+{
+public:
+
+    Callback(Results& results) : _results(results)
+    {
+    }
+
+    void
+    completed(const Ice::AsyncResultPtr& r)
+    {
+        const IceUtil::Time start = CookiePtr::dynamicCast(r->getCookie())->start;
+        try
+        {
+            Test::ServicePrx::uncheckedCast(r->getProxy())->end_work(r);
+            _results.completed(start, 0);
+        }
+        catch(const Ice::Exception& ex)
+        {
+            _results.completed(start, &ex);
+        }
+    }
+
+private:
+
+    Results& _results;
+};
+typedef IceUtil::Handle<Callback> CallbackPtr;
+#endif
+
+void
+run(const Ice::CommunicatorPtr& client, const Ice::PropertiesPtr& properties, const string& name,
+    const string& adapterProperties, int invocationTimeout, int seconds)
+{
+    Ice::InitializationData initData;
+    initData.properties = properties->clone();
+    initData.properties->setProperty("Ice.Warn.Dispatch", "0");
+    initData.properties->setProperty("Service.Endpoints", "tcp -h 127.0.0.1 -p 0");
+    initData.properties->setProperty("Service.ThreadPool.Size", "1");
+    ostringstream os;
+    os << dispatchThreads;
+    initData.properties->setProperty("Service.ThreadPool.DispatchThreads", os.str());
+    initData.properties->parseCommandLineOptions("Service", Ice::StringSeq(1, adapterProperties));
+    Ice::CommunicatorHolder server(initData);
+    Ice::ObjectAdapterPtr adapter = server->createObjectAdapter("Service");
+    Ice::ObjectPrxPtr obj = adapter->addWithUUID(ICE_MAKE_SHARED(ServiceI));
+    adapter->activate();
+
+    Test::ServicePrxPtr service = ICE_UNCHECKED_CAST(Test::ServicePrx, client->stringToProxy(obj->ice_toString()));
+    service->ice_ping();
+    if(invocationTimeout > 0)
+    {
+        service = service->ice_invocationTimeout(invocationTimeout);
+    }
+
+    Results results;
+#ifndef ICE_CPP11_MAPPING
+    Ice::CallbackPtr callback = Ice::newCallback(CallbackPtr(new Callback(results)), &Callback::completed);
+#endif
+
+    //
+    // Send the requests at a fixed rate, regardless of the responses.
+    //
+    const double rate = 2.0 * dispatchThreads * 1000 / workTime; // Requests per second
+    const IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    const IceUtil::Time end = start + IceUtil::Time::seconds(seconds);
+    Ice::Long sent = 0;
+    while(true)
+    {
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        if(now >= end)
+        {
+            break;
+        }
+
+        Ice::Long expected = static_cast<Ice::Long>((now - start).toSecondsDouble() * rate);
+        for(; sent < expected; ++sent)
+        {
+            results.sent();
+#ifdef ICE_CPP11_MAPPING
+            Results* r = &results;
+            service->workAsync(workTime,
+                [r, now]()
+                {
+                    r->completed(now, 0);
+                },
+                [r, now](exception_ptr e)
+                {
+                    try
+                    {
+                        rethrow_exception(e);
+                    }
+                    catch(const Ice::Exception& ex)
+                    {
+                        r->completed(now, &ex);
+                    }
+                });
+#else
+            service->begin_work(workTime, callback, new Cookie(now));
+#endif
+        }
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1));
+    }
+
+    results.print(name, seconds);
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int seconds = argc > 1 && argv[1][0] != '-' ? atoi(argv[1]) : 2;
+    if(seconds < 1)
+    {
+        cerr << "usage: " << argv[0] << " [seconds] [properties]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties(argc, argv);
+        Ice::CommunicatorHolder client(initData);
+
+        cout << "overload with " << dispatchThreads << " dispatch threads, " << workTime << "ms per request and "
+             << 2 * dispatchThreads * 1000 / workTime << " requests/s:" << endl;
+        cout << left << setw(32) << "configuration" << right << setw(10) << "ok/s" << setw(10) << "reject/s"
+             << setw(10) << "timeout/s" << setw(10) << "p50 (ms)" << setw(10) << "p99 (ms)" << endl;
+
+        run(client.communicator(), initData.properties, "no admission control", "", 0, seconds);
+        run(client.communicator(), initData.properties, "invocation timeout 100ms", "", 100, seconds);
+        run(client.communicator(), initData.properties, "AdmissionControl.MaxQueue=20",
+            "--Service.AdmissionControl.MaxQueue=20", 0, seconds);
+        run(client.communicator(), initData.properties, "AdmissionControl.Target=5",
+            "--Service.AdmissionControl.Target=5", 0, seconds);
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
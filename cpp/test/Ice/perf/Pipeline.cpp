@@ -0,0 +1,180 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+//
+// Measures the throughput of pipelined AMI invocations over a single
+// connection, with up to 5000 outstanding requests. The server runs in
+// the same process with its own communicator.
+//
+// Usage: pipeline [calls]
+//
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <TestI.h>
+
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+class Window : public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    Window(int size) : _size(size), _outstanding(0)
+    {
+    }
+
+    void
+    acquire()
+    {
+        Lock sync(*this);
+        while(_outstanding >= _size)
+        {
+            wait();
+        }
+        ++_outstanding;
+    }
+
+    void
+    release()
+    {
+        Lock sync(*this);
+        if(_outstanding-- == _size || _outstanding == 0)
+        {
+            notifyAll();
+        }
+    }
+
+    void
+    waitForCompletion()
+    {
+        Lock sync(*this);
+        while(_outstanding > 0)
+        {
+            wait();
+        }
+    }
+
+private:
+
+    const int _size;
+    int _outstanding;
+};
+
+#ifndef ICE_CPP11_MAPPING
+class Callback : public IceUtil::Shared
+{
+public:
+
+    Callback(Window& window) : _window(window)
+    {
+    }
+
+    void
+    response()
+    {
+        _window.release();
+    }
+
+    void
+    exception(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        test(false);
+    }
+
+private:
+
+    Window& _window;
+};
+typedef IceUtil::Handle<Callback> CallbackPtr;
+#endif
+
+double
+invocations(const Test::PerfPrxPtr& proxy, int window, int calls)
+{
+    Window w(window);
+    Test::ByteSeq seq;
+#ifndef ICE_CPP11_MAPPING
+    CallbackPtr cb = new Callback(w);
+    Test::Callback_Perf_sendBytesPtr callback = Test::newCallback_Perf_sendBytes(cb, &Callback::response,
+                                                                                 &Callback::exception);
+#endif
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < calls; ++i)
+    {
+        w.acquire();
+#ifdef ICE_CPP11_MAPPING
+        proxy->sendBytesAsync(seq,
+                              [&w]() { w.release(); },
+                              [](exception_ptr ex)
+                              {
+                                  try
+                                  {
+                                      rethrow_exception(ex);
+                                  }
+                                  catch(const Ice::Exception& e)
+                                  {
+                                      cerr << e << endl;
+                                  }
+                                  test(false);
+                              });
+#else
+        proxy->begin_sendBytes(seq, callback);
+#endif
+    }
+    w.waitForCompletion();
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    return calls / elapsed.toSecondsDouble();
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int calls = argc > 1 ? atoi(argv[1]) : 200000;
+    if(calls < 1)
+    {
+        cerr << "usage: " << argv[0] << " [calls]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        Ice::CommunicatorHolder server(argc, argv);
+        Ice::ObjectAdapterPtr adapter = server->createObjectAdapterWithEndpoints("TestAdapter", "tcp -h 127.0.0.1");
+        Ice::ObjectPrxPtr obj = adapter->add(ICE_MAKE_SHARED(PerfI), Ice::stringToIdentity("test"));
+        adapter->activate();
+
+        Ice::CommunicatorHolder client(argc, argv);
+        Test::PerfPrxPtr proxy = ICE_UNCHECKED_CAST(Test::PerfPrx, client->stringToProxy(server->proxyToString(obj)));
+        proxy->ice_ping();
+
+        cout << "pipelined AMI invocations with " << calls << " calls:" << endl;
+        cout << setw(12) << "outstanding" << setw(16) << "calls/s" << endl;
+        int windows[] = { 1, 10, 100, 1000, 5000 };
+        for(size_t i = 0; i < sizeof(windows) / sizeof(int); ++i)
+        {
+            cout << setw(12) << windows[i] << fixed << setprecision(0)
+                 << setw(16) << invocations(proxy, windows[i], calls) << endl;
+        }
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
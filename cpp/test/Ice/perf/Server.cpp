@@ -0,0 +1,74 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <TestI.h>
+
+DEFINE_TEST("server")
+
+using namespace std;
+
+int
+run(int, char**, const Ice::CommunicatorPtr& communicator)
+{
+    Ice::PropertiesPtr properties = communicator->getProperties();
+
+    //
+    // The main adapter also listens on UDP for the datagram measurements.
+    //
+    properties->setProperty("TestAdapter.Endpoints",
+                            getTestEndpoint(communicator, 0) + ":" + getTestEndpoint(communicator, 0, "udp"));
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(ICE_MAKE_SHARED(PerfI), Ice::stringToIdentity("perf"));
+    adapter->activate();
+
+    //
+    // One adapter with its own thread pool for each of the thread pool
+    // sizes of the sweep, the client uses the same property.
+    //
+    Ice::StringSeq sizes = properties->getPropertyAsListWithDefault("Perf.ThreadPoolSizes",
+                                                                    Ice::StringSeq(1, "1"));
+    for(size_t i = 0; i < sizes.size(); ++i)
+    {
+        ostringstream name;
+        name << "PerfAdapter" << i;
+        properties->setProperty(name.str() + ".Endpoints", getTestEndpoint(communicator, static_cast<int>(i) + 1));
+        properties->setProperty(name.str() + ".ThreadPool.Size", sizes[i]);
+        Ice::ObjectAdapterPtr perfAdapter = communicator->createObjectAdapter(name.str());
+        perfAdapter->add(ICE_MAKE_SHARED(PerfI), Ice::stringToIdentity("perf"));
+        perfAdapter->activate();
+    }
+
+    TEST_READY
+    communicator->waitForShutdown();
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+#ifdef ICE_STATIC_LIBS
+    Ice::registerIceSSL(false);
+#endif
+
+    try
+    {
+        Ice::InitializationData initData = getTestInitData(argc, argv);
+        initData.properties->setProperty("Ice.Warn.Connections", "0");
+        initData.properties->parseCommandLineOptions("Perf", Ice::argsToStringSeq(argc, argv));
+        Ice::CommunicatorHolder ich(argc, argv, initData);
+        return run(argc, argv, ich.communicator());
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return EXIT_FAILURE;
+    }
+}
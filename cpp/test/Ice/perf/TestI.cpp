@@ -0,0 +1,41 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+void
+PerfI::sendBytes(ICE_IN(Test::ByteSeq), const Ice::Current&)
+{
+}
+
+#ifdef ICE_CPP11_MAPPING
+void
+PerfI::sendBytesAMDAsync(Test::ByteSeq,
+                         function<void()> response,
+                         function<void(exception_ptr)>,
+                         const Ice::Current&)
+{
+    response();
+}
+#else
+void
+PerfI::sendBytesAMD_async(const Test::AMD_Perf_sendBytesAMDPtr& cb, const Test::ByteSeq&, const Ice::Current&)
+{
+    cb->ice_response();
+}
+#endif
+
+void
+PerfI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
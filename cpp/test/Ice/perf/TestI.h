@@ -0,0 +1,34 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+class PerfI : public Test::Perf
+{
+public:
+
+    virtual void sendBytes(ICE_IN(Test::ByteSeq), const Ice::Current&);
+
+#ifdef ICE_CPP11_MAPPING
+    virtual void sendBytesAMDAsync(Test::ByteSeq,
+                                   std::function<void()>,
+                                   std::function<void(std::exception_ptr)>,
+                                   const Ice::Current&);
+#else
+    virtual void sendBytesAMD_async(const Test::AMD_Perf_sendBytesAMDPtr&, const Test::ByteSeq&,
+                                    const Ice::Current&);
+#endif
+
+    virtual void shutdown(const Ice::Current&);
+};
+
+#endif
@@ -0,0 +1,129 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+//
+// Compares the throughput of the tcp and ws transports on the loopback
+// interface. The client and the server run in the same process with
+// separate communicators, each measurement sends byte sequences of the
+// given size with twoway invocations to the server, in the client to
+// server direction where the ws client masks the frames and the server
+// unmasks them.
+//
+// Usage: throughput [megabytes] [properties]
+//
+// The properties are used by both communicators. If the IceSSL plugin is
+// configured, the ssl transport is measured as well, for example to compare
+// the throughput with and without kernel TLS:
+//
+// throughput 64 --Ice.Plugin.IceSSL=IceSSL:createIceSSL --IceSSL.DefaultDir=../../../../certs
+//     --IceSSL.CertFile=server.p12 --IceSSL.Password=password --IceSSL.VerifyPeer=0 --IceSSL.KernelTLS=1
+//
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <TestI.h>
+
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+double
+measure(const Test::PerfPrxPtr& perf, size_t size, int megabytes)
+{
+    Test::ByteSeq seq(size, Ice::Byte(0x5A));
+    const int iterations = max(static_cast<int>((static_cast<Ice::Long>(megabytes) * 1024 * 1024) / size), 1);
+
+    //
+    // Warm up, this also establishes the connection.
+    //
+    for(int i = 0; i < 10; ++i)
+    {
+        perf->sendBytes(seq);
+    }
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < iterations; ++i)
+    {
+        perf->sendBytes(seq);
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    return static_cast<double>(size) * iterations / (1024.0 * 1024.0) / elapsed.toSecondsDouble();
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int megabytes = argc > 1 && argv[1][0] != '-' ? atoi(argv[1]) : 256;
+    if(megabytes < 1)
+    {
+        cerr << "usage: " << argv[0] << " [megabytes] [properties]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties(argc, argv);
+        initData.properties->setProperty("Ice.MessageSizeMax", "2048");
+        Ice::CommunicatorHolder client(initData);
+
+        string adapterEndpoints = "tcp -h 127.0.0.1 -p 0:ws -h 127.0.0.1 -p 0";
+        if(!initData.properties->getProperty("Ice.Plugin.IceSSL").empty())
+        {
+            adapterEndpoints += ":ssl -h 127.0.0.1 -p 0";
+        }
+        initData.properties = initData.properties->clone();
+        initData.properties->setProperty("TestAdapter.Endpoints", adapterEndpoints);
+        Ice::CommunicatorHolder server(initData);
+        Ice::ObjectAdapterPtr adapter = server->createObjectAdapter("TestAdapter");
+        Ice::ObjectPrxPtr obj = adapter->addWithUUID(ICE_MAKE_SHARED(PerfI));
+        adapter->activate();
+
+        vector<string> transports;
+        vector<Test::PerfPrxPtr> proxies;
+        Ice::EndpointSeq endpoints = obj->ice_getEndpoints();
+        for(Ice::EndpointSeq::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+        {
+            string endpoint = (*p)->toString();
+            transports.push_back(endpoint.substr(0, endpoint.find(' ')));
+            proxies.push_back(ICE_UNCHECKED_CAST(Test::PerfPrx,
+                client->stringToProxy(Ice::identityToString(obj->ice_getIdentity()) + ":" + endpoint)));
+        }
+
+        size_t sizes[] = { 1024, 16 * 1024, 256 * 1024, 1024 * 1024 };
+        cout << "throughput on the loopback interface with " << megabytes << "MB per measurement:" << endl;
+        cout << setw(12) << "size (KB)";
+        for(vector<string>::const_iterator p = transports.begin(); p != transports.end(); ++p)
+        {
+            cout << setw(14) << *p + " (MB/s)";
+        }
+        cout << endl;
+
+        for(size_t i = 0; i < sizeof(sizes) / sizeof(size_t); ++i)
+        {
+            cout << setw(12) << sizes[i] / 1024 << fixed << setprecision(1);
+            for(vector<Test::PerfPrxPtr>::const_iterator p = proxies.begin(); p != proxies.end(); ++p)
+            {
+                cout << setw(14) << measure(*p, sizes[i], megabytes);
+            }
+            cout << endl;
+        }
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,192 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+//
+// Compares the sorted queue timer with the timing wheel timer. The
+// schedule/cancel benchmark mimics invocation timeouts: each thread
+// schedules a task and cancels it once the "invocation" completes,
+// while the timer holds many other pending tasks. The expiry benchmark
+// measures how long it takes to run tasks which expire together.
+//
+// Usage: timer [threads] [iterations] [pending]
+//
+
+#include <IceUtil/Timer.h>
+#include <IceUtil/Atomic.h>
+#include <IceUtil/Random.h>
+#include <TestCommon.h>
+
+#include <cstdlib>
+#include <iomanip>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+
+class NoopTask : public IceUtil::TimerTask
+{
+public:
+
+    virtual void
+    runTimerTask()
+    {
+    }
+};
+
+class CountTask : public IceUtil::TimerTask
+{
+public:
+
+    CountTask(IceUtil::Monitor<IceUtil::Mutex>& monitor, int& count) : _monitor(monitor), _count(count)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        if(--_count == 0)
+        {
+            _monitor.notify();
+        }
+    }
+
+private:
+
+    IceUtil::Monitor<IceUtil::Mutex>& _monitor;
+    int& _count;
+};
+
+class ScheduleCancelThread : public IceUtil::Thread
+{
+public:
+
+    ScheduleCancelThread(const IceUtil::TimerPtr& timer, int iterations) :
+        _timer(timer), _iterations(iterations)
+    {
+    }
+
+    virtual void
+    run()
+    {
+        IceUtil::TimerTaskPtr task = ICE_MAKE_SHARED(NoopTask);
+        for(int i = 0; i < _iterations; ++i)
+        {
+            _timer->schedule(task, IceUtil::Time::seconds(60));
+            test(_timer->cancel(task));
+        }
+    }
+
+private:
+
+    const IceUtil::TimerPtr _timer;
+    const int _iterations;
+};
+
+IceUtil::TimerPtr
+createTimer(bool wheel)
+{
+    if(wheel)
+    {
+        return new IceUtil::Timer(IceUtil::Time::milliSeconds(1));
+    }
+    else
+    {
+        return new IceUtil::Timer();
+    }
+}
+
+double
+scheduleCancel(bool wheel, int threads, int iterations, int pending)
+{
+    IceUtil::TimerPtr timer = createTimer(wheel);
+    vector<IceUtil::TimerTaskPtr> tasks;
+    for(int i = 0; i < pending; ++i)
+    {
+        tasks.push_back(ICE_MAKE_SHARED(NoopTask));
+        timer->schedule(tasks.back(), IceUtil::Time::milliSeconds(60000 + IceUtilInternal::random(60000)));
+    }
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    vector<IceUtil::ThreadControl> controls;
+    for(int i = 0; i < threads; ++i)
+    {
+        IceUtil::ThreadPtr thread = new ScheduleCancelThread(timer, iterations);
+        controls.push_back(thread->start());
+    }
+    for(vector<IceUtil::ThreadControl>::iterator p = controls.begin(); p != controls.end(); ++p)
+    {
+        p->join();
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+    timer->destroy();
+    return static_cast<double>(threads) * iterations / elapsed.toSecondsDouble();
+}
+
+double
+expiry(bool wheel, int count)
+{
+    IceUtil::TimerPtr timer = createTimer(wheel);
+    IceUtil::Monitor<IceUtil::Mutex> monitor;
+    int remaining = count;
+
+    vector<IceUtil::TimerTaskPtr> tasks;
+    for(int i = 0; i < count; ++i)
+    {
+        tasks.push_back(ICE_MAKE_SHARED(CountTask, monitor, remaining));
+    }
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < count; ++i)
+    {
+        timer->schedule(tasks[i], IceUtil::Time::milliSeconds(i % 100));
+    }
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(monitor);
+        while(remaining > 0)
+        {
+            monitor.wait();
+        }
+    }
+    IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+    timer->destroy();
+    return elapsed.toMilliSecondsDouble();
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int threads = argc > 1 ? atoi(argv[1]) : 4;
+    int iterations = argc > 2 ? atoi(argv[2]) : 200000;
+    int pending = argc > 3 ? atoi(argv[3]) : 100000;
+    if(threads < 1 || iterations < 1 || pending < 0)
+    {
+        cerr << "usage: " << argv[0] << " [threads] [iterations] [pending]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    cout << "schedule/cancel with " << threads << " threads, " << iterations << " iterations per thread and "
+         << pending << " pending tasks:" << endl;
+    cout << "  sorted queue: " << fixed << setprecision(0) << scheduleCancel(false, threads, iterations, pending)
+         << " ops/s" << endl;
+    cout << "  timing wheel: " << fixed << setprecision(0) << scheduleCancel(true, threads, iterations, pending)
+         << " ops/s" << endl;
+
+    cout << "expiry of " << iterations << " tasks within 100ms:" << endl;
+    cout << "  sorted queue: " << fixed << setprecision(1) << expiry(false, iterations) << " ms" << endl;
+    cout << "  timing wheel: " << fixed << setprecision(1) << expiry(true, iterations) << " ms" << endl;
+
+    return EXIT_SUCCESS;
+}
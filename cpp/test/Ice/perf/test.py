@@ -0,0 +1,21 @@
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+#
+# The performance test runs with few iterations by default. To compare the
+# performance of two builds, run it with more iterations and save the JSON
+# results, for example:
+#
+# allTests.py --filter=Ice/perf --protocol=ws --cprops="Perf.Iterations=100000 Perf.Output=/tmp/perf-ws.json"
+#
+# The thread pool sizes are used by both the client and the server.
+#
+TestSuite(__file__, [
+    ClientServerTestCase(props = { "Perf.ThreadPoolSizes" : "1,4" })
+], options = { "compress" : [False], "serialize" : [False] })
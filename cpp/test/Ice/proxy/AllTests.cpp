@@ -423,6 +423,34 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(b1->ice_getLocatorCacheTimeout() == 1);
     prop->setProperty(property, "");
 
+    property = propertyPrefix + ".ParallelConnect";
+    test(b1->ice_getParallelConnect() == 1);
+    prop->setProperty(property, "3");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getParallelConnect() == 3);
+    prop->setProperty(property, "");
+
+    property = propertyPrefix + ".ConnectionPoolSize";
+    test(b1->ice_getConnectionPoolSize() == 1);
+    prop->setProperty(property, "4");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getConnectionPoolSize() == 4);
+    prop->setProperty(property, "");
+
+    property = propertyPrefix + ".BatchAutoFlushDelay";
+    test(b1->ice_getBatchAutoFlushDelay() == 0);
+    prop->setProperty(property, "5");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getBatchAutoFlushDelay() == 5);
+    prop->setProperty(property, "");
+
+    property = propertyPrefix + ".HedgingDelay";
+    test(b1->ice_getHedgingDelay() == 0);
+    prop->setProperty(property, "20");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getHedgingDelay() == 20);
+    prop->setProperty(property, "");
+
     // Now retest with an indirect proxy.
     prop->setProperty(propertyPrefix, "test");
     property = propertyPrefix + ".Locator";
@@ -484,6 +512,10 @@ allTests(const Ice::CommunicatorPtr& communicator)
     prop->setProperty(property, "Ordered");
     b1 = communicator->propertyToProxy(propertyPrefix);
     test(b1->ice_getEndpointSelection() == Ice::ICE_ENUM(EndpointSelectionType, Ordered));
+    prop->setProperty(property, "Adaptive");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getEndpointSelection() == Ice::ICE_ENUM(EndpointSelectionType, Adaptive));
+    test(b1->ice_getCommunicator()->proxyToProperty(b1, "Test")["Test.EndpointSelection"] == "Adaptive");
     prop->setProperty(property, "");
 
     property = propertyPrefix + ".CollocationOptimized";
@@ -519,6 +551,10 @@ allTests(const Ice::CommunicatorPtr& communicator)
     b1 = b1->ice_endpointSelection(Ice::ICE_ENUM(EndpointSelectionType, Ordered));
     b1 = b1->ice_locatorCacheTimeout(100);
     b1 = b1->ice_invocationTimeout(1234);
+    b1 = b1->ice_parallelConnect(2);
+    b1 = b1->ice_connectionPoolSize(3);
+    b1 = b1->ice_batchAutoFlushDelay(10);
+    b1 = b1->ice_hedgingDelay(50);
     Ice::EncodingVersion v = { 1, 0 };
     b1 = b1->ice_encodingVersion(v);
     Ice::ObjectPrxPtr router = communicator->stringToProxy("router");
@@ -541,7 +577,7 @@ allTests(const Ice::CommunicatorPtr& communicator)
     b1 = b1->ice_locator(ICE_UNCHECKED_CAST(Ice::LocatorPrx, locator));
 
     Ice::PropertyDict proxyProps = communicator->proxyToProperty(b1, "Test");
-    test(proxyProps.size() == 21);
+    test(proxyProps.size() == 33);
 
     test(proxyProps["Test"] == "test -t -e 1.0");
     test(proxyProps["Test.CollocationOptimized"] == "1");
@@ -550,6 +586,10 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(proxyProps["Test.EndpointSelection"] == "Ordered");
     test(proxyProps["Test.LocatorCacheTimeout"] == "100");
     test(proxyProps["Test.InvocationTimeout"] == "1234");
+    test(proxyProps["Test.ParallelConnect"] == "2");
+    test(proxyProps["Test.ConnectionPoolSize"] == "3");
+    test(proxyProps["Test.BatchAutoFlushDelay"] == "10");
+    test(proxyProps["Test.HedgingDelay"] == "50");
 
     test(proxyProps["Test.Locator"] == "locator -t -e " + Ice::encodingVersionToString(Ice::currentEncoding));
     // Locator collocation optimization is always disabled.
@@ -559,6 +599,10 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(proxyProps["Test.Locator.EndpointSelection"] == "Random");
     test(proxyProps["Test.Locator.LocatorCacheTimeout"] == "300");
     test(proxyProps["Test.Locator.InvocationTimeout"] == "1500");
+    test(proxyProps["Test.Locator.ParallelConnect"] == "1");
+    test(proxyProps["Test.Locator.ConnectionPoolSize"] == "1");
+    test(proxyProps["Test.Locator.BatchAutoFlushDelay"] == "0");
+    test(proxyProps["Test.Locator.HedgingDelay"] == "0");
 
     test(proxyProps["Test.Locator.Router"] == "router -t -e " + Ice::encodingVersionToString(Ice::currentEncoding));
     test(proxyProps["Test.Locator.Router.CollocationOptimized"] == "0");
@@ -677,6 +721,78 @@ allTests(const Ice::CommunicatorPtr& communicator)
     {
     }
 
+    try
+    {
+        base->ice_parallelConnect(1);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+        test(false);
+    }
+
+    try
+    {
+        base->ice_parallelConnect(0);
+        test(false);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+    }
+
+    try
+    {
+        base->ice_connectionPoolSize(1);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+        test(false);
+    }
+
+    try
+    {
+        base->ice_connectionPoolSize(0);
+        test(false);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+    }
+
+    try
+    {
+        base->ice_batchAutoFlushDelay(0);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+        test(false);
+    }
+
+    try
+    {
+        base->ice_batchAutoFlushDelay(-1);
+        test(false);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+    }
+
+    try
+    {
+        base->ice_hedgingDelay(0);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+        test(false);
+    }
+
+    try
+    {
+        base->ice_hedgingDelay(-1);
+        test(false);
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+    }
+
     cout << "ok" << endl;
 
     cout << "testing proxy comparison... " << flush;
@@ -797,6 +913,26 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(Ice::targetLess(compObj1->ice_locatorCacheTimeout(10), compObj1->ice_locatorCacheTimeout(20)));
     test(Ice::targetGreaterEqual(compObj1->ice_locatorCacheTimeout(20), compObj1->ice_locatorCacheTimeout(10)));
 
+    test(Ice::targetEqualTo(compObj1->ice_parallelConnect(2), compObj1->ice_parallelConnect(2)));
+    test(Ice::targetNotEqualTo(compObj1->ice_parallelConnect(1), compObj1->ice_parallelConnect(2)));
+    test(Ice::targetLess(compObj1->ice_parallelConnect(1), compObj1->ice_parallelConnect(2)));
+    test(Ice::targetGreaterEqual(compObj1->ice_parallelConnect(2), compObj1->ice_parallelConnect(1)));
+
+    test(Ice::targetEqualTo(compObj1->ice_connectionPoolSize(2), compObj1->ice_connectionPoolSize(2)));
+    test(Ice::targetNotEqualTo(compObj1->ice_connectionPoolSize(1), compObj1->ice_connectionPoolSize(2)));
+    test(Ice::targetLess(compObj1->ice_connectionPoolSize(1), compObj1->ice_connectionPoolSize(2)));
+    test(Ice::targetGreaterEqual(compObj1->ice_connectionPoolSize(2), compObj1->ice_connectionPoolSize(1)));
+
+    test(Ice::targetEqualTo(compObj1->ice_batchAutoFlushDelay(5), compObj1->ice_batchAutoFlushDelay(5)));
+    test(Ice::targetNotEqualTo(compObj1->ice_batchAutoFlushDelay(5), compObj1->ice_batchAutoFlushDelay(10)));
+    test(Ice::targetLess(compObj1->ice_batchAutoFlushDelay(5), compObj1->ice_batchAutoFlushDelay(10)));
+    test(Ice::targetGreaterEqual(compObj1->ice_batchAutoFlushDelay(10), compObj1->ice_batchAutoFlushDelay(5)));
+
+    test(Ice::targetEqualTo(compObj1->ice_hedgingDelay(5), compObj1->ice_hedgingDelay(5)));
+    test(Ice::targetNotEqualTo(compObj1->ice_hedgingDelay(5), compObj1->ice_hedgingDelay(10)));
+    test(Ice::targetLess(compObj1->ice_hedgingDelay(5), compObj1->ice_hedgingDelay(10)));
+    test(Ice::targetGreaterEqual(compObj1->ice_hedgingDelay(10), compObj1->ice_hedgingDelay(5)));
+
     test(Ice::targetEqualTo(compObj1->ice_invocationTimeout(20), compObj1->ice_invocationTimeout(20)));
     test(Ice::targetNotEqualTo(compObj1->ice_invocationTimeout(10), compObj1->ice_invocationTimeout(20)));
     test(Ice::targetLess(compObj1->ice_invocationTimeout(10), compObj1->ice_invocationTimeout(20)));
@@ -965,6 +1101,26 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(compObj1->ice_locatorCacheTimeout(10) < compObj1->ice_locatorCacheTimeout(20));
     test(!(compObj1->ice_locatorCacheTimeout(20) < compObj1->ice_locatorCacheTimeout(10)));
 
+    test(compObj1->ice_parallelConnect(2) == compObj1->ice_parallelConnect(2));
+    test(compObj1->ice_parallelConnect(1) != compObj1->ice_parallelConnect(2));
+    test(compObj1->ice_parallelConnect(1) < compObj1->ice_parallelConnect(2));
+    test(!(compObj1->ice_parallelConnect(2) < compObj1->ice_parallelConnect(1)));
+
+    test(compObj1->ice_connectionPoolSize(2) == compObj1->ice_connectionPoolSize(2));
+    test(compObj1->ice_connectionPoolSize(1) != compObj1->ice_connectionPoolSize(2));
+    test(compObj1->ice_connectionPoolSize(1) < compObj1->ice_connectionPoolSize(2));
+    test(!(compObj1->ice_connectionPoolSize(2) < compObj1->ice_connectionPoolSize(1)));
+
+    test(compObj1->ice_batchAutoFlushDelay(5) == compObj1->ice_batchAutoFlushDelay(5));
+    test(compObj1->ice_batchAutoFlushDelay(5) != compObj1->ice_batchAutoFlushDelay(10));
+    test(compObj1->ice_batchAutoFlushDelay(5) < compObj1->ice_batchAutoFlushDelay(10));
+    test(!(compObj1->ice_batchAutoFlushDelay(10) < compObj1->ice_batchAutoFlushDelay(5)));
+
+    test(compObj1->ice_hedgingDelay(5) == compObj1->ice_hedgingDelay(5));
+    test(compObj1->ice_hedgingDelay(5) != compObj1->ice_hedgingDelay(10));
+    test(compObj1->ice_hedgingDelay(5) < compObj1->ice_hedgingDelay(10));
+    test(!(compObj1->ice_hedgingDelay(10) < compObj1->ice_hedgingDelay(5)));
+
     test(compObj1->ice_invocationTimeout(20) == compObj1->ice_invocationTimeout(20));
     test(compObj1->ice_invocationTimeout(10) != compObj1->ice_invocationTimeout(20));
     test(compObj1->ice_invocationTimeout(10) < compObj1->ice_invocationTimeout(20));
@@ -787,6 +787,106 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
 #endif
     }
 
+    {
+        //
+        // Sequences of structs without padding are copied with a single
+        // memcpy, the encoding must match the encoding of each struct.
+        //
+        test(Ice::StreamableTraits<PackedStruct>::helper == Ice::StreamHelperCategoryStructPacked);
+        test(Ice::StreamableTraits<NestedPackedStruct>::helper == Ice::StreamHelperCategoryStructPacked);
+        test(Ice::StreamableTraits<PaddedStruct>::helper ==
+             (sizeof(PaddedStruct) == 20 ? Ice::StreamHelperCategoryStructPacked : Ice::StreamHelperCategoryStruct));
+
+        PackedStructS arr;
+        NestedPackedStructS nestedArr;
+        PaddedStructS paddedArr;
+        for(int i = 0; i < 300; ++i)
+        {
+            PackedStruct s;
+            s.x = i * 1.5;
+            s.y = -i * 2.5;
+            s.id = i;
+            s.flags = 0x01020304 + i;
+            arr.push_back(s);
+
+            NestedPackedStruct n;
+            n.s = s;
+            n.l = static_cast<Ice::Long>(i) << 40;
+            nestedArr.push_back(n);
+
+            PaddedStruct p;
+            p.x = s.x;
+            p.y = s.y;
+            p.id = s.id;
+            paddedArr.push_back(p);
+        }
+
+        Ice::OutputStream out(communicator);
+        out.write(arr);
+        out.write(nestedArr);
+        out.write(paddedArr);
+        out.write(PackedStructS());
+        out.finished(data);
+
+        Ice::OutputStream expected(communicator);
+        expected.writeSize(static_cast<Ice::Int>(arr.size()));
+        for(PackedStructS::const_iterator p = arr.begin(); p != arr.end(); ++p)
+        {
+            expected.write(p->x);
+            expected.write(p->y);
+            expected.write(p->id);
+            expected.write(p->flags);
+        }
+        expected.writeSize(static_cast<Ice::Int>(nestedArr.size()));
+        for(NestedPackedStructS::const_iterator p = nestedArr.begin(); p != nestedArr.end(); ++p)
+        {
+            expected.write(p->s.x);
+            expected.write(p->s.y);
+            expected.write(p->s.id);
+            expected.write(p->s.flags);
+            expected.write(p->l);
+        }
+        expected.writeSize(static_cast<Ice::Int>(paddedArr.size()));
+        for(PaddedStructS::const_iterator p = paddedArr.begin(); p != paddedArr.end(); ++p)
+        {
+            expected.write(p->x);
+            expected.write(p->y);
+            expected.write(p->id);
+        }
+        expected.writeSize(0);
+        vector<Ice::Byte> expectedData;
+        expected.finished(expectedData);
+        test(data == expectedData);
+
+        Ice::InputStream in(communicator, data);
+        PackedStructS arr2;
+        in.read(arr2);
+        test(arr2 == arr);
+        NestedPackedStructS nestedArr2;
+        in.read(nestedArr2);
+        test(nestedArr2 == nestedArr);
+        PaddedStructS paddedArr2;
+        in.read(paddedArr2);
+        test(paddedArr2 == paddedArr);
+        in.read(arr2);
+        test(arr2.empty());
+
+        //
+        // The sequence size is checked before copying the elements.
+        //
+        data.resize(data.size() / 2);
+        Ice::InputStream in2(communicator, data);
+        in2.read(arr2);
+        try
+        {
+            in2.read(nestedArr2);
+            test(false);
+        }
+        catch(const Ice::UnmarshalOutOfBoundsException&)
+        {
+        }
+    }
+
     {
         MyClassS arr;
         for(int i = 0; i < 4; ++i)
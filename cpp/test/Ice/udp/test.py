@@ -0,0 +1,21 @@
+# -*- coding: utf-8 -*-
+# **********************************************************************
+#
+# Copyright (c) 2003-2017 ZeroC, Inc. All rights reserved.
+#
+# This copy of Ice is licensed to you under the terms described in the
+# ICE_LICENSE file included in this distribution.
+#
+# **********************************************************************
+
+servers=range(0, 5)
+
+options=lambda current: { "protocol": ["tcp", "ws"] } if current.config.uwp else {}
+
+TestSuite(__file__, [
+    ClientServerTestCase(client=Client(args=[5]), servers=[Server(args=[i], ready="McastTestAdapter") for i in servers]),
+    ClientServerTestCase("client/server with batched reads",
+                         client=Client(args=[5]),
+                         servers=[Server(args=[i], ready="McastTestAdapter") for i in servers],
+                         props={ "Ice.UDP.RcvBatchSize" : 8 })
+], multihost=False, options=options)
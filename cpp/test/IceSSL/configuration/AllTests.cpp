@@ -2412,6 +2412,78 @@ allTests(const CommunicatorPtr& communicator, const string& testDir, bool p12)
     cout << "ok" << endl;
 #endif
 
+#ifdef ICE_USE_OPENSSL
+    cout << "testing session resumption... " << flush;
+    {
+        //
+        // New connections to the server resume the session of the previous
+        // connection, with session tickets or with the server session cache.
+        //
+        const char* tickets[] = { "1", "0", 0 };
+        for(int i = 0; tickets[i] != 0; ++i)
+        {
+            InitializationData initData;
+            initData.properties = createClientProps(defaultProps, p12, "c_rsa_ca1", "cacert1");
+            initData.properties->setProperty("IceSSL.SessionCacheSize", "10");
+            CommunicatorPtr comm = initialize(initData);
+            Test::ServerFactoryPrxPtr fact = ICE_CHECKED_CAST(Test::ServerFactoryPrx, comm->stringToProxy(factoryRef));
+            test(fact);
+            Test::Properties d = createServerProps(defaultProps, p12, "s_rsa_ca1", "cacert1");
+            d["IceSSL.VerifyPeer"] = "2";
+            d["IceSSL.SessionCacheSize"] = "10";
+            d["IceSSL.SessionTickets"] = tickets[i];
+            Test::ServerPrxPtr server = fact->createServer(d);
+            IceSSL::CertificatePtr clientCert = IceSSL::Certificate::load(defaultDir + "/c_rsa_ca1_pub.pem");
+            try
+            {
+                for(int j = 0; j < 3; ++j)
+                {
+                    //
+                    // The certificates of the peer are also available with a resumed session.
+                    //
+                    server->checkCert(clientCert->getSubjectDN(), clientCert->getIssuerDN());
+                    IceSSL::ConnectionInfoPtr info =
+                        ICE_DYNAMIC_CAST(IceSSL::ConnectionInfo, server->ice_getConnection()->getInfo());
+                    test(info->resumed == (j > 0));
+                    test(info->verified);
+                    test(info->certs.size() == 2);
+                    server->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+                }
+            }
+            catch(const LocalException& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+            fact->destroyServer(server);
+
+            //
+            // Sessions aren't resumed if the server doesn't cache them.
+            //
+            d = createServerProps(defaultProps, p12, "s_rsa_ca1", "cacert1");
+            server = fact->createServer(d);
+            try
+            {
+                for(int j = 0; j < 2; ++j)
+                {
+                    IceSSL::ConnectionInfoPtr info =
+                        ICE_DYNAMIC_CAST(IceSSL::ConnectionInfo, server->ice_getConnection()->getInfo());
+                    test(!info->resumed);
+                    server->ice_getConnection()->close(Ice::ICE_SCOPED_ENUM(ConnectionClose, GracefullyWithWait));
+                }
+            }
+            catch(const LocalException& ex)
+            {
+                cerr << ex << endl;
+                test(false);
+            }
+            fact->destroyServer(server);
+            comm->destroy();
+        }
+    }
+    cout << "ok" << endl;
+#endif
+
     //
     // IceSSL.CAs is not supported with UWP
     //
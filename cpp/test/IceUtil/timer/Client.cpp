@@ -152,11 +152,28 @@ private:
 };
 ICE_DEFINE_PTR(DestroyTaskPtr, DestroyTask);
 
-int main(int, char**)
+namespace
+{
+
+IceUtil::TimerPtr
+createTimer(bool wheel)
 {
-    cout << "testing timer... " << flush;
+    if(wheel)
     {
-        IceUtil::TimerPtr timer = new IceUtil::Timer();
+        return new IceUtil::Timer(IceUtil::Time::milliSeconds(1));
+    }
+    else
+    {
+        return new IceUtil::Timer();
+    }
+}
+
+void
+allTests(bool wheel)
+{
+    cout << (wheel ? "testing timing wheel timer... " : "testing timer... ") << flush;
+    {
+        IceUtil::TimerPtr timer = createTimer(wheel);
 
         {
             TestTaskPtr task = ICE_MAKE_SHARED(TestTask);
@@ -239,14 +256,33 @@ int main(int, char**)
             test(count == task->getCount() || count + 1 == task->getCount());
         }
 
+        {
+            vector<TestTaskPtr> tasks;
+            for(int i = 0; i < 1000; ++i)
+            {
+                tasks.push_back(ICE_MAKE_SHARED(TestTask));
+                timer->schedule(tasks.back(), IceUtil::Time::milliSeconds(200 + (i * 7919) % 100000));
+            }
+            for(vector<TestTaskPtr>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+            {
+                test(timer->cancel(*p));
+                test(!timer->cancel(*p));
+            }
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(300));
+            for(vector<TestTaskPtr>::const_iterator p = tasks.begin(); p != tasks.end(); ++p)
+            {
+                test(!(*p)->hasRun());
+            }
+        }
+
         timer->destroy();
     }
     cout << "ok" << endl;
 
-    cout << "testing timer destroy... " << flush;
+    cout << (wheel ? "testing timing wheel timer destroy... " : "testing timer destroy... ") << flush;
     {
         {
-            IceUtil::TimerPtr timer = new IceUtil::Timer();
+            IceUtil::TimerPtr timer = createTimer(wheel);
             DestroyTaskPtr destroyTask = ICE_MAKE_SHARED(DestroyTask, timer);
             timer->schedule(destroyTask, IceUtil::Time());
             destroyTask->waitForRun();
@@ -260,7 +296,7 @@ int main(int, char**)
             }
         }
         {
-            IceUtil::TimerPtr timer = new IceUtil::Timer();
+            IceUtil::TimerPtr timer = createTimer(wheel);
             TestTaskPtr testTask = ICE_MAKE_SHARED(TestTask);
             timer->schedule(testTask, IceUtil::Time());
             timer->destroy();
@@ -275,6 +311,13 @@ int main(int, char**)
         }
     }
     cout << "ok" << endl;
+}
+
+}
 
+int main(int, char**)
+{
+    allTests(false);
+    allTests(true);
     return EXIT_SUCCESS;
 }
@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ..\config\PropertyNames.xml, Mon Mar 27 16:51:58 2017
+// Generated by makeprops.py from file ../config/PropertyNames.xml, Sat Oct 17 09:07:13 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -30,17 +30,27 @@ namespace IceInternal
              new Property(@"^Ice\.ACM\.Server\.Heartbeat$", false, null),
              new Property(@"^Ice\.ACM\.Server\.Close$", false, null),
              new Property(@"^Ice\.ACM\.Server$", false, null),
+             new Property(@"^Ice\.AdaptiveSelection\.DecayTime$", false, null),
              new Property(@"^Ice\.Admin\.ACM\.Timeout$", false, null),
              new Property(@"^Ice\.Admin\.ACM\.Heartbeat$", false, null),
              new Property(@"^Ice\.Admin\.ACM\.Close$", false, null),
              new Property(@"^Ice\.Admin\.ACM$", false, null),
              new Property(@"^Ice\.Admin\.AdapterId$", false, null),
+             new Property(@"^Ice\.Admin\.AdmissionControl\.Target$", false, null),
+             new Property(@"^Ice\.Admin\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^Ice\.Admin\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^Ice\.Admin\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^Ice\.Admin\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^Ice\.Admin\.Endpoints$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.EndpointSelection$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.ConnectionCached$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.PreferSecure$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Ice\.Admin\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^Ice\.Admin\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Admin\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Ice\.Admin\.Locator\.HedgingDelay$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.Locator$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.Router$", false, null),
              new Property(@"^Ice\.Admin\.Locator\.CollocationOptimized$", false, null),
@@ -52,7 +62,11 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.Router\.ConnectionCached$", false, null),
              new Property(@"^Ice\.Admin\.Router\.PreferSecure$", false, null),
              new Property(@"^Ice\.Admin\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Ice\.Admin\.Router\.ParallelConnect$", false, null),
+             new Property(@"^Ice\.Admin\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Admin\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Admin\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Ice\.Admin\.Router\.HedgingDelay$", false, null),
              new Property(@"^Ice\.Admin\.Router\.Locator$", false, null),
              new Property(@"^Ice\.Admin\.Router\.Router$", false, null),
              new Property(@"^Ice\.Admin\.Router\.CollocationOptimized$", false, null),
@@ -66,6 +80,9 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.Admin\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^Ice\.Admin\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^Ice\.Admin\.MessageSizeMax$", false, null),
              new Property(@"^Ice\.Admin\.DelayCreation$", false, null),
              new Property(@"^Ice\.Admin\.Enabled$", false, null),
@@ -77,15 +94,22 @@ namespace IceInternal
              new Property(@"^Ice\.Admin\.ServerId$", false, null),
              new Property(@"^Ice\.BackgroundLocatorCacheUpdates$", false, null),
              new Property(@"^Ice\.BatchAutoFlush$", true, null),
+             new Property(@"^Ice\.BatchAutoFlushDelay$", false, null),
              new Property(@"^Ice\.BatchAutoFlushSize$", false, null),
+             new Property(@"^Ice\.BufferPool$", false, null),
+             new Property(@"^Ice\.BufferPool\.MaxMemory$", false, null),
              new Property(@"^Ice\.ChangeUser$", false, null),
              new Property(@"^Ice\.ClassGraphDepthMax$", false, null),
              new Property(@"^Ice\.ClientAccessPolicyProtocol$", false, null),
+             new Property(@"^Ice\.Compression\.Codecs$", false, null),
              new Property(@"^Ice\.Compression\.Level$", false, null),
+             new Property(@"^Ice\.Compression\.MinSize$", false, null),
              new Property(@"^Ice\.CollectObjects$", false, null),
              new Property(@"^Ice\.Config$", false, null),
+             new Property(@"^Ice\.ConnectionPoolSelection$", false, null),
              new Property(@"^Ice\.ConsoleListener$", false, null),
              new Property(@"^Ice\.Default\.CollocationOptimized$", false, null),
+             new Property(@"^Ice\.Default\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Default\.EncodingVersion$", false, null),
              new Property(@"^Ice\.Default\.EndpointSelection$", false, null),
              new Property(@"^Ice\.Default\.Host$", false, null),
@@ -93,7 +117,11 @@ namespace IceInternal
              new Property(@"^Ice\.Default\.Locator\.ConnectionCached$", false, null),
              new Property(@"^Ice\.Default\.Locator\.PreferSecure$", false, null),
              new Property(@"^Ice\.Default\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Ice\.Default\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^Ice\.Default\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Default\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Default\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Ice\.Default\.Locator\.HedgingDelay$", false, null),
              new Property(@"^Ice\.Default\.Locator\.Locator$", false, null),
              new Property(@"^Ice\.Default\.Locator\.Router$", false, null),
              new Property(@"^Ice\.Default\.Locator\.CollocationOptimized$", false, null),
@@ -102,13 +130,18 @@ namespace IceInternal
              new Property(@"^Ice\.Default\.LocatorCacheTimeout$", false, null),
              new Property(@"^Ice\.Default\.InvocationTimeout$", false, null),
              new Property(@"^Ice\.Default\.Package$", false, null),
+             new Property(@"^Ice\.Default\.ParallelConnect$", false, null),
              new Property(@"^Ice\.Default\.PreferSecure$", false, null),
              new Property(@"^Ice\.Default\.Protocol$", false, null),
              new Property(@"^Ice\.Default\.Router\.EndpointSelection$", false, null),
              new Property(@"^Ice\.Default\.Router\.ConnectionCached$", false, null),
              new Property(@"^Ice\.Default\.Router\.PreferSecure$", false, null),
              new Property(@"^Ice\.Default\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Ice\.Default\.Router\.ParallelConnect$", false, null),
+             new Property(@"^Ice\.Default\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^Ice\.Default\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Ice\.Default\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Ice\.Default\.Router\.HedgingDelay$", false, null),
              new Property(@"^Ice\.Default\.Router\.Locator$", false, null),
              new Property(@"^Ice\.Default\.Router\.Router$", false, null),
              new Property(@"^Ice\.Default\.Router\.CollocationOptimized$", false, null),
@@ -119,10 +152,17 @@ namespace IceInternal
              new Property(@"^Ice\.Default\.Timeout$", false, null),
              new Property(@"^Ice\.EventLog\.Source$", false, null),
              new Property(@"^Ice\.FactoryAssemblies$", false, null),
+             new Property(@"^Ice\.HedgingDelay$", false, null),
+             new Property(@"^Ice\.HedgingMaxLoad$", false, null),
+             new Property(@"^Ice\.HedgingPercentile$", false, null),
              new Property(@"^Ice\.HTTPProxyHost$", false, null),
              new Property(@"^Ice\.HTTPProxyPort$", false, null),
+             new Property(@"^Ice\.HostResolver\.CacheTTL$", false, null),
+             new Property(@"^Ice\.HostResolver\.NegativeCacheTTL$", false, null),
+             new Property(@"^Ice\.HostResolver\.Threads$", false, null),
              new Property(@"^Ice\.ImplicitContext$", false, null),
              new Property(@"^Ice\.InitPlugins$", false, null),
+             new Property(@"^Ice\.IoUring$", false, null),
              new Property(@"^Ice\.IPv4$", false, null),
              new Property(@"^Ice\.IPv6$", false, null),
              new Property(@"^Ice\.LogFile$", false, null),
@@ -137,6 +177,7 @@ namespace IceInternal
              new Property(@"^Ice\.Override\.Timeout$", false, null),
              new Property(@"^Ice\.Override\.Secure$", false, null),
              new Property(@"^Ice\.Package\.[^\s]+$", false, null),
+             new Property(@"^Ice\.ParallelConnectDelay$", false, null),
              new Property(@"^Ice\.Plugin\.[^\s]+$", false, null),
              new Property(@"^Ice\.PluginLoadOrder$", false, null),
              new Property(@"^Ice\.PreferIPv6Address$", false, null),
@@ -145,6 +186,7 @@ namespace IceInternal
              new Property(@"^Ice\.PrintProcessId$", false, null),
              new Property(@"^Ice\.PrintStackTraces$", false, null),
              new Property(@"^Ice\.ProgramName$", false, null),
+             new Property(@"^Ice\.ReadAheadSize$", false, null),
              new Property(@"^Ice\.RetryIntervals$", false, null),
              new Property(@"^Ice\.ServerIdleTime$", false, null),
              new Property(@"^Ice\.SOCKSProxyHost$", false, null),
@@ -159,6 +201,9 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Client\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Client\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.Reactors$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.ReactorWorkStealing$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Client\.DispatchThreads$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.Size$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeMax$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.SizeWarn$", false, null),
@@ -166,7 +211,12 @@ namespace IceInternal
              new Property(@"^Ice\.ThreadPool\.Server\.Serialize$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadIdleTime$", false, null),
              new Property(@"^Ice\.ThreadPool\.Server\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.Reactors$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.ReactorWorkStealing$", false, null),
+             new Property(@"^Ice\.ThreadPool\.Server\.DispatchThreads$", false, null),
              new Property(@"^Ice\.ThreadPriority$", false, null),
+             new Property(@"^Ice\.Timer\.Wheel$", false, null),
+             new Property(@"^Ice\.Timer\.WheelTick$", false, null),
              new Property(@"^Ice\.ToStringMode$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Properties$", false, null),
              new Property(@"^Ice\.Trace\.Admin\.Logger$", false, null),
@@ -176,6 +226,7 @@ namespace IceInternal
              new Property(@"^Ice\.Trace\.Retry$", false, null),
              new Property(@"^Ice\.Trace\.Slicing$", false, null),
              new Property(@"^Ice\.Trace\.ThreadPool$", false, null),
+             new Property(@"^Ice\.UDP\.RcvBatchSize$", false, null),
              new Property(@"^Ice\.UDP\.RcvSize$", false, null),
              new Property(@"^Ice\.UDP\.SndSize$", false, null),
              new Property(@"^Ice\.TCP\.Backlog$", false, null),
@@ -190,6 +241,8 @@ namespace IceInternal
              new Property(@"^Ice\.Warn\.Endpoints$", false, null),
              new Property(@"^Ice\.Warn\.UnknownProperties$", false, null),
              new Property(@"^Ice\.Warn\.UnusedProperties$", false, null),
+             new Property(@"^Ice\.WriteCoalesceCount$", false, null),
+             new Property(@"^Ice\.WriteCoalesceSize$", false, null),
              new Property(@"^Ice\.CacheMessageBuffers$", false, null),
              new Property(@"^Ice\.ThreadInterruptSafe$", false, null),
              new Property(@"^Ice\.Voip$", false, null),
@@ -214,12 +267,21 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.ACM\.Close$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ACM$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.AdapterId$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Endpoints$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Locator\.CollocationOptimized$", false, null),
@@ -231,7 +293,11 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.Router$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.Router\.CollocationOptimized$", false, null),
@@ -245,18 +311,30 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceDiscovery\.Multicast\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceDiscovery\.Multicast\.MessageSizeMax$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM\.Close$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ACM$", false, null),
              new Property(@"^IceDiscovery\.Reply\.AdapterId$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Endpoints$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Locator\.CollocationOptimized$", false, null),
@@ -268,7 +346,11 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.Router$", false, null),
              new Property(@"^IceDiscovery\.Reply\.Router\.CollocationOptimized$", false, null),
@@ -282,18 +364,30 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceDiscovery\.Reply\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceDiscovery\.Reply\.MessageSizeMax$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM\.Close$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ACM$", false, null),
              new Property(@"^IceDiscovery\.Locator\.AdapterId$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Endpoints$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.Router$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Locator\.CollocationOptimized$", false, null),
@@ -305,7 +399,11 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.PreferSecure$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.Locator$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.Router$", false, null),
              new Property(@"^IceDiscovery\.Locator\.Router\.CollocationOptimized$", false, null),
@@ -319,6 +417,9 @@ namespace IceInternal
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceDiscovery\.Locator\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceDiscovery\.Locator\.MessageSizeMax$", false, null),
              new Property(@"^IceDiscovery\.Lookup$", false, null),
              new Property(@"^IceDiscovery\.Timeout$", false, null),
@@ -338,12 +439,21 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.ACM\.Close$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ACM$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.AdapterId$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Endpoints$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.Locator$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Locator\.CollocationOptimized$", false, null),
@@ -355,7 +465,11 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.PreferSecure$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.Locator$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.Router\.CollocationOptimized$", false, null),
@@ -369,18 +483,30 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Reply\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceLocatorDiscovery\.Reply\.MessageSizeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM\.Close$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ACM$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.AdapterId$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Endpoints$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.Locator$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Locator\.CollocationOptimized$", false, null),
@@ -392,7 +518,11 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.PreferSecure$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.Locator$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.Router$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.Router\.CollocationOptimized$", false, null),
@@ -406,6 +536,9 @@ namespace IceInternal
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceLocatorDiscovery\.Locator\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceLocatorDiscovery\.Locator\.MessageSizeMax$", false, null),
              new Property(@"^IceLocatorDiscovery\.Lookup$", false, null),
              new Property(@"^IceLocatorDiscovery\.Timeout$", false, null),
@@ -446,7 +579,11 @@ namespace IceInternal
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.ConnectionCached$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.PreferSecure$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.ParallelConnect$", false, null),
+             new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.ConnectionPoolSize$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.InvocationTimeout$", false, null),
+             new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.HedgingDelay$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Locator$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.Router$", false, null),
              new Property(@"^IceBoxAdmin\.ServiceManager\.Proxy\.CollocationOptimized$", false, null),
@@ -473,12 +610,21 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ACM\.Close$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ACM$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.AdapterId$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Endpoints$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Locator\.CollocationOptimized$", false, null),
@@ -490,7 +636,11 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.Router\.CollocationOptimized$", false, null),
@@ -504,18 +654,30 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Reply\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Reply\.MessageSizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Timeout$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Heartbeat$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM\.Close$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ACM$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.AdapterId$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Endpoints$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Locator\.CollocationOptimized$", false, null),
@@ -527,7 +689,11 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.Locator$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.Router$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.Router\.CollocationOptimized$", false, null),
@@ -541,6 +707,9 @@ namespace IceInternal
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGridAdmin\.Discovery\.Locator\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGridAdmin\.Discovery\.Locator\.MessageSizeMax$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.Observers$", false, null),
              new Property(@"^IceGridAdmin\.Trace\.SaveToRegistry$", false, null),
@@ -554,12 +723,21 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ACM$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.AdapterId$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Endpoints$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Locator\.CollocationOptimized$", false, null),
@@ -571,7 +749,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.Router\.CollocationOptimized$", false, null),
@@ -585,6 +767,9 @@ namespace IceInternal
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGrid\.AdminRouter\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGrid\.AdminRouter\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.InstanceName$", false, null),
              new Property(@"^IceGrid\.Node\.ACM\.Timeout$", false, null),
@@ -592,12 +777,21 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Node\.ACM$", false, null),
              new Property(@"^IceGrid\.Node\.AdapterId$", false, null),
+             new Property(@"^IceGrid\.Node\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGrid\.Node\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGrid\.Node\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGrid\.Node\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGrid\.Node\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGrid\.Node\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Node\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Node\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.Locator\.CollocationOptimized$", false, null),
@@ -609,7 +803,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Node\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Node\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.Router\.CollocationOptimized$", false, null),
@@ -623,6 +821,9 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Node\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGrid\.Node\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGrid\.Node\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Node\.AllowRunningServersAsRoot$", false, null),
              new Property(@"^IceGrid\.Node\.AllowEndpointsOverride$", false, null),
@@ -646,7 +847,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.UserAccountMapper\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Node\.UserAccountMapper\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Node\.UserAccountMapper\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Node\.UserAccountMapper\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.Locator$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.Router$", false, null),
              new Property(@"^IceGrid\.Node\.UserAccountMapper\.CollocationOptimized$", false, null),
@@ -658,7 +863,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -670,12 +879,21 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ACM$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.AdapterId$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Locator\.CollocationOptimized$", false, null),
@@ -687,7 +905,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.Router\.CollocationOptimized$", false, null),
@@ -701,12 +923,19 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSessionManager\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSessionManager\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.AdminSSLPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -717,12 +946,21 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ACM$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.AdapterId$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Locator\.CollocationOptimized$", false, null),
@@ -734,7 +972,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.Router\.CollocationOptimized$", false, null),
@@ -748,6 +990,9 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGrid\.Registry\.Client\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGrid\.Registry\.Client\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.CryptPasswords$", false, null),
              new Property(@"^IceGrid\.Registry\.DefaultTemplates$", false, null),
@@ -756,12 +1001,21 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ACM$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.AdapterId$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Locator\.CollocationOptimized$", false, null),
@@ -773,7 +1027,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Router\.CollocationOptimized$", false, null),
@@ -787,6 +1045,9 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGrid\.Registry\.Discovery\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Enabled$", false, null),
              new Property(@"^IceGrid\.Registry\.Discovery\.Address$", false, null),
@@ -798,12 +1059,21 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ACM$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.AdapterId$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Locator\.CollocationOptimized$", false, null),
@@ -815,7 +1085,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.Router\.CollocationOptimized$", false, null),
@@ -829,6 +1103,9 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGrid\.Registry\.Internal\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGrid\.Registry\.Internal\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.MapSize$", false, null),
              new Property(@"^IceGrid\.Registry\.LMDB\.Path$", false, null),
@@ -837,7 +1114,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.PermissionsVerifier\.CollocationOptimized$", false, null),
@@ -852,12 +1133,21 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ACM$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.AdapterId$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Locator\.CollocationOptimized$", false, null),
@@ -869,7 +1159,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.Router\.CollocationOptimized$", false, null),
@@ -883,6 +1177,9 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGrid\.Registry\.Server\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGrid\.Registry\.Server\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionFilters$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Timeout$", false, null),
@@ -890,12 +1187,21 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM\.Close$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ACM$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.AdapterId$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Endpoints$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Locator\.CollocationOptimized$", false, null),
@@ -907,7 +1213,11 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.Router\.CollocationOptimized$", false, null),
@@ -921,13 +1231,20 @@ namespace IceInternal
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IceGrid\.Registry\.SessionManager\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionManager\.MessageSizeMax$", false, null),
              new Property(@"^IceGrid\.Registry\.SessionTimeout$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.EndpointSelection$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ParallelConnect$", false, null),
+             new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.ConnectionPoolSize$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.HedgingDelay$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^IceGrid\.Registry\.SSLPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -957,12 +1274,21 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ACM\.Close$", false, null),
              new Property(@"^IcePatch2\.ACM$", false, null),
              new Property(@"^IcePatch2\.AdapterId$", false, null),
+             new Property(@"^IcePatch2\.AdmissionControl\.Target$", false, null),
+             new Property(@"^IcePatch2\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^IcePatch2\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^IcePatch2\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^IcePatch2\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^IcePatch2\.Endpoints$", false, null),
              new Property(@"^IcePatch2\.Locator\.EndpointSelection$", false, null),
              new Property(@"^IcePatch2\.Locator\.ConnectionCached$", false, null),
              new Property(@"^IcePatch2\.Locator\.PreferSecure$", false, null),
              new Property(@"^IcePatch2\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IcePatch2\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^IcePatch2\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^IcePatch2\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^IcePatch2\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IcePatch2\.Locator\.HedgingDelay$", false, null),
              new Property(@"^IcePatch2\.Locator\.Locator$", false, null),
              new Property(@"^IcePatch2\.Locator\.Router$", false, null),
              new Property(@"^IcePatch2\.Locator\.CollocationOptimized$", false, null),
@@ -974,7 +1300,11 @@ namespace IceInternal
              new Property(@"^IcePatch2\.Router\.ConnectionCached$", false, null),
              new Property(@"^IcePatch2\.Router\.PreferSecure$", false, null),
              new Property(@"^IcePatch2\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^IcePatch2\.Router\.ParallelConnect$", false, null),
+             new Property(@"^IcePatch2\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^IcePatch2\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^IcePatch2\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^IcePatch2\.Router\.HedgingDelay$", false, null),
              new Property(@"^IcePatch2\.Router\.Locator$", false, null),
              new Property(@"^IcePatch2\.Router\.Router$", false, null),
              new Property(@"^IcePatch2\.Router\.CollocationOptimized$", false, null),
@@ -988,6 +1318,9 @@ namespace IceInternal
              new Property(@"^IcePatch2\.ThreadPool\.Serialize$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^IcePatch2\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^IcePatch2\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^IcePatch2\.MessageSizeMax$", false, null),
              new Property(@"^IcePatch2\.Directory$", false, null),
              new Property(@"^IcePatch2\.InstanceName$", false, null),
@@ -1024,6 +1357,7 @@ namespace IceInternal
              new Property(@"^IceSSL\.FindCert$", false, null),
              new Property(@"^IceSSL\.FindCert\.[^\s]+$", true, null),
              new Property(@"^IceSSL\.InitOpenSSL$", false, null),
+             new Property(@"^IceSSL\.KernelTLS$", false, null),
              new Property(@"^IceSSL\.KeyFile$", true, null),
              new Property(@"^IceSSL\.Keychain$", false, null),
              new Property(@"^IceSSL\.KeychainPassword$", false, null),
@@ -1038,6 +1372,10 @@ namespace IceInternal
              new Property(@"^IceSSL\.ProtocolVersionMin$", false, null),
              new Property(@"^IceSSL\.Random$", false, null),
              new Property(@"^IceSSL\.SchannelStrongCrypto$", false, null),
+             new Property(@"^IceSSL\.SessionCacheSize$", false, null),
+             new Property(@"^IceSSL\.SessionCacheTimeout$", false, null),
+             new Property(@"^IceSSL\.SessionTicketKeyRotation$", false, null),
+             new Property(@"^IceSSL\.SessionTickets$", false, null),
              new Property(@"^IceSSL\.Trace\.Security$", false, null),
              new Property(@"^IceSSL\.TrustOnly$", false, null),
              new Property(@"^IceSSL\.TrustOnly\.Client$", false, null),
@@ -1075,12 +1413,21 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ACM\.Close$", false, null),
              new Property(@"^Glacier2\.Client\.ACM$", false, null),
              new Property(@"^Glacier2\.Client\.AdapterId$", false, null),
+             new Property(@"^Glacier2\.Client\.AdmissionControl\.Target$", false, null),
+             new Property(@"^Glacier2\.Client\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^Glacier2\.Client\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^Glacier2\.Client\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^Glacier2\.Client\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^Glacier2\.Client\.Endpoints$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.EndpointSelection$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.ConnectionCached$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Glacier2\.Client\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^Glacier2\.Client\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Client\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Glacier2\.Client\.Locator\.HedgingDelay$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.Locator$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.Locator\.CollocationOptimized$", false, null),
@@ -1092,7 +1439,11 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.Router\.ConnectionCached$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Glacier2\.Client\.Router\.ParallelConnect$", false, null),
+             new Property(@"^Glacier2\.Client\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Client\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Glacier2\.Client\.Router\.HedgingDelay$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.Locator$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.Router$", false, null),
              new Property(@"^Glacier2\.Client\.Router\.CollocationOptimized$", false, null),
@@ -1106,6 +1457,9 @@ namespace IceInternal
              new Property(@"^Glacier2\.Client\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Client\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^Glacier2\.Client\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^Glacier2\.Client\.MessageSizeMax$", false, null),
              new Property(@"^Glacier2\.Client\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Client\.Buffered$", false, null),
@@ -1127,7 +1481,11 @@ namespace IceInternal
              new Property(@"^Glacier2\.PermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Glacier2\.PermissionsVerifier\.ParallelConnect$", false, null),
+             new Property(@"^Glacier2\.PermissionsVerifier\.ConnectionPoolSize$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.PermissionsVerifier\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Glacier2\.PermissionsVerifier\.HedgingDelay$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.Locator$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.Router$", false, null),
              new Property(@"^Glacier2\.PermissionsVerifier\.CollocationOptimized$", false, null),
@@ -1138,7 +1496,11 @@ namespace IceInternal
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.ConnectionCached$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Glacier2\.SSLPermissionsVerifier\.ParallelConnect$", false, null),
+             new Property(@"^Glacier2\.SSLPermissionsVerifier\.ConnectionPoolSize$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.SSLPermissionsVerifier\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Glacier2\.SSLPermissionsVerifier\.HedgingDelay$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.Locator$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.Router$", false, null),
              new Property(@"^Glacier2\.SSLPermissionsVerifier\.CollocationOptimized$", false, null),
@@ -1150,12 +1512,21 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ACM\.Close$", false, null),
              new Property(@"^Glacier2\.Server\.ACM$", false, null),
              new Property(@"^Glacier2\.Server\.AdapterId$", false, null),
+             new Property(@"^Glacier2\.Server\.AdmissionControl\.Target$", false, null),
+             new Property(@"^Glacier2\.Server\.AdmissionControl\.Interval$", false, null),
+             new Property(@"^Glacier2\.Server\.AdmissionControl\.MaxQueue$", false, null),
+             new Property(@"^Glacier2\.Server\.AdmissionControl\.PriorityOperations$", false, null),
+             new Property(@"^Glacier2\.Server\.AdmissionControl\.PriorityContext$", false, null),
              new Property(@"^Glacier2\.Server\.Endpoints$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.EndpointSelection$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.ConnectionCached$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Glacier2\.Server\.Locator\.ParallelConnect$", false, null),
+             new Property(@"^Glacier2\.Server\.Locator\.ConnectionPoolSize$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Server\.Locator\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Glacier2\.Server\.Locator\.HedgingDelay$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.Locator$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.Locator\.CollocationOptimized$", false, null),
@@ -1167,7 +1538,11 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.Router\.ConnectionCached$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Glacier2\.Server\.Router\.ParallelConnect$", false, null),
+             new Property(@"^Glacier2\.Server\.Router\.ConnectionPoolSize$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.Server\.Router\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Glacier2\.Server\.Router\.HedgingDelay$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.Locator$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.Router$", false, null),
              new Property(@"^Glacier2\.Server\.Router\.CollocationOptimized$", false, null),
@@ -1181,6 +1556,9 @@ namespace IceInternal
              new Property(@"^Glacier2\.Server\.ThreadPool\.Serialize$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadIdleTime$", false, null),
              new Property(@"^Glacier2\.Server\.ThreadPool\.ThreadPriority$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.Reactors$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.ReactorWorkStealing$", false, null),
+             new Property(@"^Glacier2\.Server\.ThreadPool\.DispatchThreads$", false, null),
              new Property(@"^Glacier2\.Server\.MessageSizeMax$", false, null),
              new Property(@"^Glacier2\.Server\.AlwaysBatch$", false, null),
              new Property(@"^Glacier2\.Server\.Buffered$", false, null),
@@ -1192,7 +1570,11 @@ namespace IceInternal
              new Property(@"^Glacier2\.SessionManager\.ConnectionCached$", false, null),
              new Property(@"^Glacier2\.SessionManager\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.SessionManager\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Glacier2\.SessionManager\.ParallelConnect$", false, null),
+             new Property(@"^Glacier2\.SessionManager\.ConnectionPoolSize$", false, null),
              new Property(@"^Glacier2\.SessionManager\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.SessionManager\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Glacier2\.SessionManager\.HedgingDelay$", false, null),
              new Property(@"^Glacier2\.SessionManager\.Locator$", false, null),
              new Property(@"^Glacier2\.SessionManager\.Router$", false, null),
              new Property(@"^Glacier2\.SessionManager\.CollocationOptimized$", false, null),
@@ -1202,7 +1584,11 @@ namespace IceInternal
              new Property(@"^Glacier2\.SSLSessionManager\.ConnectionCached$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.PreferSecure$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.LocatorCacheTimeout$", false, null),
+             new Property(@"^Glacier2\.SSLSessionManager\.ParallelConnect$", false, null),
+             new Property(@"^Glacier2\.SSLSessionManager\.ConnectionPoolSize$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.InvocationTimeout$", false, null),
+             new Property(@"^Glacier2\.SSLSessionManager\.BatchAutoFlushDelay$", false, null),
+             new Property(@"^Glacier2\.SSLSessionManager\.HedgingDelay$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.Locator$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.Router$", false, null),
              new Property(@"^Glacier2\.SSLSessionManager\.CollocationOptimized$", false, null),
@@ -1482,7 +1482,12 @@ namespace IceInternal
             switch(getEndpointSelection())
             {
                 case Ice.EndpointSelectionType.Random:
+                case Ice.EndpointSelectionType.Adaptive:
                 {
+                    //
+                    // The Adaptive endpoint selection is only implemented by the
+                    // C++ mapping, the endpoints are used in random order.
+                    //
                     lock(rand_)
                     {
                         for(int i = 0; i < endpoints.Count - 1; ++i)
@@ -762,7 +762,12 @@ public class RoutableReference extends Reference
         switch(getEndpointSelection())
         {
             case Random:
+            case Adaptive:
             {
+                //
+                // The Adaptive endpoint selection is only implemented by the
+                // C++ mapping, the endpoints are used in random order.
+                //
                 java.util.Collections.shuffle(endpoints);
                 break;
             }
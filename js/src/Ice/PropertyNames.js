@@ -6,7 +6,7 @@
 // ICE_LICENSE file included in this distribution.
 //
 // **********************************************************************
-// Generated by makeprops.py from file ..\config\PropertyNames.xml, Mon Mar 27 16:51:58 2017
+// Generated by makeprops.py from file ../config/PropertyNames.xml, Sat Oct 17 09:07:13 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -31,17 +31,27 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ACM\.Server\.Heartbeat/", false, null),
     new Property("/^Ice\.ACM\.Server\.Close/", false, null),
     new Property("/^Ice\.ACM\.Server/", false, null),
+    new Property("/^Ice\.AdaptiveSelection\.DecayTime/", false, null),
     new Property("/^Ice\.Admin\.ACM\.Timeout/", false, null),
     new Property("/^Ice\.Admin\.ACM\.Heartbeat/", false, null),
     new Property("/^Ice\.Admin\.ACM\.Close/", false, null),
     new Property("/^Ice\.Admin\.ACM/", false, null),
     new Property("/^Ice\.Admin\.AdapterId/", false, null),
+    new Property("/^Ice\.Admin\.AdmissionControl\.Target/", false, null),
+    new Property("/^Ice\.Admin\.AdmissionControl\.Interval/", false, null),
+    new Property("/^Ice\.Admin\.AdmissionControl\.MaxQueue/", false, null),
+    new Property("/^Ice\.Admin\.AdmissionControl\.PriorityOperations/", false, null),
+    new Property("/^Ice\.Admin\.AdmissionControl\.PriorityContext/", false, null),
     new Property("/^Ice\.Admin\.Endpoints/", false, null),
     new Property("/^Ice\.Admin\.Locator\.EndpointSelection/", false, null),
     new Property("/^Ice\.Admin\.Locator\.ConnectionCached/", false, null),
     new Property("/^Ice\.Admin\.Locator\.PreferSecure/", false, null),
     new Property("/^Ice\.Admin\.Locator\.LocatorCacheTimeout/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.ParallelConnect/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Admin\.Locator\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.BatchAutoFlushDelay/", false, null),
+    new Property("/^Ice\.Admin\.Locator\.HedgingDelay/", false, null),
     new Property("/^Ice\.Admin\.Locator\.Locator/", false, null),
     new Property("/^Ice\.Admin\.Locator\.Router/", false, null),
     new Property("/^Ice\.Admin\.Locator\.CollocationOptimized/", false, null),
@@ -53,7 +63,11 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.Router\.ConnectionCached/", false, null),
     new Property("/^Ice\.Admin\.Router\.PreferSecure/", false, null),
     new Property("/^Ice\.Admin\.Router\.LocatorCacheTimeout/", false, null),
+    new Property("/^Ice\.Admin\.Router\.ParallelConnect/", false, null),
+    new Property("/^Ice\.Admin\.Router\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Admin\.Router\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Admin\.Router\.BatchAutoFlushDelay/", false, null),
+    new Property("/^Ice\.Admin\.Router\.HedgingDelay/", false, null),
     new Property("/^Ice\.Admin\.Router\.Locator/", false, null),
     new Property("/^Ice\.Admin\.Router\.Router/", false, null),
     new Property("/^Ice\.Admin\.Router\.CollocationOptimized/", false, null),
@@ -67,6 +81,9 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ThreadPool\.Serialize/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadPriority/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.Reactors/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.ReactorWorkStealing/", false, null),
+    new Property("/^Ice\.Admin\.ThreadPool\.DispatchThreads/", false, null),
     new Property("/^Ice\.Admin\.MessageSizeMax/", false, null),
     new Property("/^Ice\.Admin\.DelayCreation/", false, null),
     new Property("/^Ice\.Admin\.Enabled/", false, null),
@@ -78,15 +95,22 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ServerId/", false, null),
     new Property("/^Ice\.BackgroundLocatorCacheUpdates/", false, null),
     new Property("/^Ice\.BatchAutoFlush/", true, null),
+    new Property("/^Ice\.BatchAutoFlushDelay/", false, null),
     new Property("/^Ice\.BatchAutoFlushSize/", false, null),
+    new Property("/^Ice\.BufferPool/", false, null),
+    new Property("/^Ice\.BufferPool\.MaxMemory/", false, null),
     new Property("/^Ice\.ChangeUser/", false, null),
     new Property("/^Ice\.ClassGraphDepthMax/", false, null),
     new Property("/^Ice\.ClientAccessPolicyProtocol/", false, null),
+    new Property("/^Ice\.Compression\.Codecs/", false, null),
     new Property("/^Ice\.Compression\.Level/", false, null),
+    new Property("/^Ice\.Compression\.MinSize/", false, null),
     new Property("/^Ice\.CollectObjects/", false, null),
     new Property("/^Ice\.Config/", false, null),
+    new Property("/^Ice\.ConnectionPoolSelection/", false, null),
     new Property("/^Ice\.ConsoleListener/", false, null),
     new Property("/^Ice\.Default\.CollocationOptimized/", false, null),
+    new Property("/^Ice\.Default\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Default\.EncodingVersion/", false, null),
     new Property("/^Ice\.Default\.EndpointSelection/", false, null),
     new Property("/^Ice\.Default\.Host/", false, null),
@@ -94,7 +118,11 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.Locator\.ConnectionCached/", false, null),
     new Property("/^Ice\.Default\.Locator\.PreferSecure/", false, null),
     new Property("/^Ice\.Default\.Locator\.LocatorCacheTimeout/", false, null),
+    new Property("/^Ice\.Default\.Locator\.ParallelConnect/", false, null),
+    new Property("/^Ice\.Default\.Locator\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Default\.Locator\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Default\.Locator\.BatchAutoFlushDelay/", false, null),
+    new Property("/^Ice\.Default\.Locator\.HedgingDelay/", false, null),
     new Property("/^Ice\.Default\.Locator\.Locator/", false, null),
     new Property("/^Ice\.Default\.Locator\.Router/", false, null),
     new Property("/^Ice\.Default\.Locator\.CollocationOptimized/", false, null),
@@ -103,13 +131,18 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.LocatorCacheTimeout/", false, null),
     new Property("/^Ice\.Default\.InvocationTimeout/", false, null),
     new Property("/^Ice\.Default\.Package/", false, null),
+    new Property("/^Ice\.Default\.ParallelConnect/", false, null),
     new Property("/^Ice\.Default\.PreferSecure/", false, null),
     new Property("/^Ice\.Default\.Protocol/", false, null),
     new Property("/^Ice\.Default\.Router\.EndpointSelection/", false, null),
     new Property("/^Ice\.Default\.Router\.ConnectionCached/", false, null),
     new Property("/^Ice\.Default\.Router\.PreferSecure/", false, null),
     new Property("/^Ice\.Default\.Router\.LocatorCacheTimeout/", false, null),
+    new Property("/^Ice\.Default\.Router\.ParallelConnect/", false, null),
+    new Property("/^Ice\.Default\.Router\.ConnectionPoolSize/", false, null),
     new Property("/^Ice\.Default\.Router\.InvocationTimeout/", false, null),
+    new Property("/^Ice\.Default\.Router\.BatchAutoFlushDelay/", false, null),
+    new Property("/^Ice\.Default\.Router\.HedgingDelay/", false, null),
     new Property("/^Ice\.Default\.Router\.Locator/", false, null),
     new Property("/^Ice\.Default\.Router\.Router/", false, null),
     new Property("/^Ice\.Default\.Router\.CollocationOptimized/", false, null),
@@ -120,10 +153,17 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.Timeout/", false, null),
     new Property("/^Ice\.EventLog\.Source/", false, null),
     new Property("/^Ice\.FactoryAssemblies/", false, null),
+    new Property("/^Ice\.HedgingDelay/", false, null),
+    new Property("/^Ice\.HedgingMaxLoad/", false, null),
+    new Property("/^Ice\.HedgingPercentile/", false, null),
     new Property("/^Ice\.HTTPProxyHost/", false, null),
     new Property("/^Ice\.HTTPProxyPort/", false, null),
+    new Property("/^Ice\.HostResolver\.CacheTTL/", false, null),
+    new Property("/^Ice\.HostResolver\.NegativeCacheTTL/", false, null),
+    new Property("/^Ice\.HostResolver\.Threads/", false, null),
     new Property("/^Ice\.ImplicitContext/", false, null),
     new Property("/^Ice\.InitPlugins/", false, null),
+    new Property("/^Ice\.IoUring/", false, null),
     new Property("/^Ice\.IPv4/", false, null),
     new Property("/^Ice\.IPv6/", false, null),
     new Property("/^Ice\.LogFile/", false, null),
@@ -138,6 +178,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Override\.Timeout/", false, null),
     new Property("/^Ice\.Override\.Secure/", false, null),
     new Property("/^Ice\.Package\../", false, null),
+    new Property("/^Ice\.ParallelConnectDelay/", false, null),
     new Property("/^Ice\.Plugin\../", false, null),
     new Property("/^Ice\.PluginLoadOrder/", false, null),
     new Property("/^Ice\.PreferIPv6Address/", false, null),
@@ -146,6 +187,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.PrintProcessId/", false, null),
     new Property("/^Ice\.PrintStackTraces/", false, null),
     new Property("/^Ice\.ProgramName/", false, null),
+    new Property("/^Ice\.ReadAheadSize/", false, null),
     new Property("/^Ice\.RetryIntervals/", false, null),
     new Property("/^Ice\.ServerIdleTime/", false, null),
     new Property("/^Ice\.SOCKSProxyHost/", false, null),
@@ -160,6 +202,9 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Client\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Client\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.Reactors/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.ReactorWorkStealing/", false, null),
+    new Property("/^Ice\.ThreadPool\.Client\.DispatchThreads/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.Size/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeMax/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.SizeWarn/", false, null),
@@ -167,7 +212,12 @@ PropertyNames.IceProps =
     new Property("/^Ice\.ThreadPool\.Server\.Serialize/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.ThreadPool\.Server\.ThreadPriority/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.Reactors/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.ReactorWorkStealing/", false, null),
+    new Property("/^Ice\.ThreadPool\.Server\.DispatchThreads/", false, null),
     new Property("/^Ice\.ThreadPriority/", false, null),
+    new Property("/^Ice\.Timer\.Wheel/", false, null),
+    new Property("/^Ice\.Timer\.WheelTick/", false, null),
     new Property("/^Ice\.ToStringMode/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Properties/", false, null),
     new Property("/^Ice\.Trace\.Admin\.Logger/", false, null),
@@ -177,6 +227,7 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Trace\.Retry/", false, null),
     new Property("/^Ice\.Trace\.Slicing/", false, null),
     new Property("/^Ice\.Trace\.ThreadPool/", false, null),
+    new Property("/^Ice\.UDP\.RcvBatchSize/", false, null),
     new Property("/^Ice\.UDP\.RcvSize/", false, null),
     new Property("/^Ice\.UDP\.SndSize/", false, null),
     new Property("/^Ice\.TCP\.Backlog/", false, null),
@@ -191,6 +242,8 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Warn\.Endpoints/", false, null),
     new Property("/^Ice\.Warn\.UnknownProperties/", false, null),
     new Property("/^Ice\.Warn\.UnusedProperties/", false, null),
+    new Property("/^Ice\.WriteCoalesceCount/", false, null),
+    new Property("/^Ice\.WriteCoalesceSize/", false, null),
     new Property("/^Ice\.CacheMessageBuffers/", false, null),
     new Property("/^Ice\.ThreadInterruptSafe/", false, null),
     new Property("/^Ice\.Voip/", false, null),
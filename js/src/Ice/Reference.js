@@ -2218,9 +2218,11 @@ class RoutableReference extends Reference
         switch(this.getEndpointSelection())
         {
             case EndpointSelectionType.Random:
+            case EndpointSelectionType.Adaptive:
             {
                 //
-                // Shuffle the endpoints.
+                // Shuffle the endpoints. The Adaptive endpoint selection is
+                // only implemented by the C++ mapping.
                 //
                 ArrayUtil.shuffle(endpoints);
                 break;